@@ -0,0 +1,109 @@
+# !/usr/bin/env python3
+import argparse
+import os
+import socket
+import stat
+import struct
+
+# This is a reader for the frames published by the StreamingSink of SPHinXsys.
+# It connects to the Unix domain socket or opens the named pipe given by the path,
+# decodes the frames and prints a short summary of each frame.
+# The functions can also be imported to decode the frames for other monitoring tools.
+
+FRAME_MAGIC = 0x53485053
+FRAME_HEADER = struct.Struct("=IIQd")
+QUANTITY_FRAME = 1
+PARTICLE_SNAPSHOT_FRAME = 2
+
+
+class FrameReader:
+
+    def __init__(self, stream):
+        self.stream = stream
+
+    def read_exactly(self, size):
+        data = bytearray()
+        while len(data) < size:
+            chunk = self.stream.read(size - len(data))
+            if not chunk:
+                raise EOFError("the stream is closed")
+            data.extend(chunk)
+        return bytes(data)
+
+    def read_frame(self):
+        magic, frame_type, payload_size, time = FRAME_HEADER.unpack(self.read_exactly(FRAME_HEADER.size))
+        if magic != FRAME_MAGIC:
+            raise ValueError("the stream is not aligned to a frame")
+        return frame_type, time, self.read_exactly(payload_size)
+
+
+class PayloadDecoder:
+
+    def __init__(self, payload):
+        self.payload = payload
+        self.position = 0
+
+    def read(self, fmt):
+        values = struct.unpack_from("=" + fmt, self.payload, self.position)
+        self.position += struct.calcsize("=" + fmt)
+        return values
+
+    def read_string(self):
+        length, = self.read("I")
+        value = self.payload[self.position:self.position + length].decode()
+        self.position += length
+        return value
+
+
+def decode_quantity(payload):
+    decoder = PayloadDecoder(payload)
+    name = decoder.read_string()
+    number_of_values, = decoder.read("I")
+    return name, list(decoder.read(f"{number_of_values}d"))
+
+
+def decode_particle_snapshot(payload):
+    decoder = PayloadDecoder(payload)
+    body_name = decoder.read_string()
+    number_of_particles, number_of_arrays = decoder.read("QI")
+    arrays = {}
+    for _ in range(number_of_arrays):
+        name = decoder.read_string()
+        number_of_components, = decoder.read("I")
+        values = decoder.read(f"{number_of_particles * number_of_components}d")
+        arrays[name] = [values[i:i + number_of_components] for i in range(0, len(values), number_of_components)]
+    return body_name, number_of_particles, arrays
+
+
+def open_stream(path):
+    if stat.S_ISFIFO(os.stat(path).st_mode):
+        return open(path, "rb")
+    client = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+    client.connect(path)
+    return client.makefile("rb")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Decode the state stream of a SPHinXsys run.")
+    parser.add_argument("path", help="path of the Unix domain socket or named pipe")
+    parser.add_argument("--frames", type=int, default=0, help="stop after the given number of frames")
+    args = parser.parse_args()
+
+    reader = FrameReader(open_stream(args.path))
+    number_of_frames = 0
+    try:
+        while args.frames == 0 or number_of_frames < args.frames:
+            frame_type, time, payload = reader.read_frame()
+            if frame_type == QUANTITY_FRAME:
+                name, values = decode_quantity(payload)
+                print(f"time {time:.6g} quantity {name} {values}")
+            elif frame_type == PARTICLE_SNAPSHOT_FRAME:
+                body_name, number_of_particles, arrays = decode_particle_snapshot(payload)
+                print(f"time {time:.6g} body {body_name} particles {number_of_particles} arrays {list(arrays)}")
+            number_of_frames += 1
+    except EOFError:
+        pass
+
+
+if __name__ == "__main__":
+    main()
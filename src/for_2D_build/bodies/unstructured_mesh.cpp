@@ -166,9 +166,9 @@ void NeighborBuilderInFVM::initializeRelation(Neighborhood &neighborhood, Real &
 {
     size_t current_size = neighborhood.current_size_;
     neighborhood.j_[current_size] = j_index;
-    neighborhood.dW_ij_[current_size] = dW_ij;
-    neighborhood.r_ij_[current_size] = distance;
-    neighborhood.e_ij_[current_size] = interface_normal_direction;
+    neighborhood.dW_ij_.setValue(current_size, dW_ij);
+    neighborhood.r_ij_.setValue(current_size, distance);
+    neighborhood.e_ij_.setValue(current_size, interface_normal_direction);
 }
 //=================================================================================================//
 InnerRelationInFVM::InnerRelationInFVM(RealBody &real_body, ANSYSMesh &ansys_mesh)
@@ -184,12 +184,12 @@ void InnerRelationInFVM::searchNeighborsByParticles(size_t total_particles, Base
         [&](const IndexRange &r)
         {
             StdLargeVec<Vecd> &pos_n = source_particles.pos_;
-            StdLargeVec<Real> &Vol_n = source_particles.Vol_;
+            StdLargeVec<StorageReal> &Vol_n = source_particles.Vol_;
             for (size_t num = r.begin(); num != r.end(); ++num)
             {
                 size_t index_i = get_particle_index(num);
                 Vecd &particle_position = pos_n[index_i];
-                Real &Vol_i = Vol_n[index_i];
+                Real Vol_i = Vol_n[index_i];
 
                 Neighborhood &neighborhood = particle_configuration[index_i];
                 for (std::size_t neighbor = 0; neighbor != mesh_topology_[index_i].size(); ++neighbor)
@@ -333,6 +333,12 @@ void BodyStatesRecordingInMeshToVtp::writeWithFileName(const std::string &sequen
             {
                 fs::remove(filefullpath);
             }
+            if (appended_data_ != nullptr)
+            {
+                writeAppendedDataFile(filefullpath, *body);
+                body->setNotNewlyUpdated();
+                continue;
+            }
             std::ofstream out_file(filefullpath.c_str(), std::ios::trunc);
             // begin of the XML file
             out_file << "<?xml version=\"1.0\"?>\n";
@@ -400,11 +406,72 @@ void BodyStatesRecordingInMeshToVtp::writeWithFileName(const std::string &sequen
     }
 }
 //=================================================================================================//
+void BodyStatesRecordingInMeshToVtp::writeAppendedDataFile(const std::string &filefullpath, SPHBody &body)
+{
+    size_t total_nodes = node_coordinates_.size();
+    size_t total_elements = elements_nodes_connection_.size();
+    appended_data_->clear();
+
+    Real *points = appended_data_->addDataArray<Real>("Points", total_nodes, 3);
+    for (size_t node = 0; node != total_nodes; ++node)
+    {
+        Eigen::Map<Vec3d>(points + 3 * node) = upgradeToVec3d(node_coordinates_[node]);
+    }
+
+    size_t total_vertices = 0;
+    for (const auto &element : elements_nodes_connection_)
+    {
+        total_vertices += element.size();
+    }
+    int *connectivity = appended_data_->addDataArray<int>("connectivity", total_vertices);
+    int *offsets = appended_data_->addDataArray<int>("offsets", total_elements);
+    size_t offset = 0;
+    for (size_t element = 0; element != total_elements; ++element)
+    {
+        for (const auto &vertex : elements_nodes_connection_[element])
+        {
+            connectivity[offset++] = int(vertex);
+        }
+        offsets[element] = int(offset);
+    }
+
+    body.getBaseParticles().writeParticlesToVtkAppendedData(*appended_data_);
+    appended_data_->encodeDataArrays();
+
+    std::ofstream out_file(filefullpath.c_str(), std::ios::trunc | std::ios::binary);
+    out_file << "<?xml version=\"1.0\"?>\n";
+    out_file << "<VTKFile type=\"PolyData\" version=\"1.0\" byte_order=\"LittleEndian\"";
+    appended_data_->writeFileAttributes(out_file);
+    out_file << ">\n";
+    out_file << "<PolyData>\n";
+    out_file << "<Piece NumberOfPoints=\"" << total_nodes
+             << "\" NumberOfVerts=\"0\" NumberOfLines=\"0\" NumberOfStrips=\"0\" NumberOfPolys=\""
+             << total_elements << "\">\n";
+    out_file << "<Points>\n";
+    appended_data_->writeDataArray(out_file, 0);
+    out_file << "</Points>\n";
+    out_file << "<Polys>\n";
+    appended_data_->writeDataArray(out_file, 1);
+    appended_data_->writeDataArray(out_file, 2);
+    out_file << "</Polys>\n";
+    out_file << "<CellData>\n";
+    for (size_t k = 3; k != appended_data_->size(); ++k)
+    {
+        appended_data_->writeDataArray(out_file, k);
+    }
+    out_file << "</CellData>\n";
+    out_file << "</Piece>\n";
+    out_file << "</PolyData>\n";
+    appended_data_->writeAppendedData(out_file);
+    out_file << "</VTKFile>\n";
+    out_file.close();
+}
+//=================================================================================================//
 BoundaryConditionSetupInFVM::
     BoundaryConditionSetupInFVM(BaseInnerRelationInFVM &inner_relation, GhostCreationFromMesh &ghost_creation)
     : fluid_dynamics::FluidDataInner(inner_relation), rho_(particles_->rho_),
       Vol_(particles_->Vol_), mass_(particles_->mass_),
-      p_(*particles_->getVariableByName<Real>("Pressure")),
+      p_(*particles_->getVariableByName<StorageReal>("Pressure")),
       vel_(particles_->vel_), pos_(particles_->pos_),
       mom_(*particles_->getVariableByName<Vecd>("Momentum")),
       ghost_bound_(ghost_creation.ghost_bound_),
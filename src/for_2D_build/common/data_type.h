@@ -31,12 +31,14 @@
 
 #include "base_data_type.h"
 #include "scalar_functions.h"
+#include "symmetric_matrix.h"
 
 namespace SPH
 {
 using Arrayi = Array2i;
 using Vecd = Vec2d;
 using Matd = Mat2d;
+using SymMatd = SymMat2d;
 using AlignedBox = AlignedBox2d;
 using AngularVecd = Real;
 using Rotation = Rotation2d;
@@ -279,6 +279,24 @@ Vecd MultiPolygonShape::findClosestPoint(const Vecd &probe_point)
     return multi_polygon_.findClosestPoint(probe_point);
 }
 //=================================================================================================//
+uint64_t MultiPolygonShape::getSourceHash()
+{
+    uint64_t hash = hashBytes(nullptr, 0);
+    auto hash_ring = [&](const auto &ring)
+    {
+        hash = hashData(ring.size(), hash);
+        for (const auto &point : ring)
+            hash = hashData(Vecd(point.x(), point.y()), hash);
+    };
+    for (const boost_poly &poly : multi_polygon_.getBoostMultiPoly())
+    {
+        hash_ring(poly.outer());
+        for (const auto &inner_ring : poly.inners())
+            hash_ring(inner_ring);
+    }
+    return hash;
+}
+//=================================================================================================//
 BoundingBox MultiPolygonShape::findBounds()
 {
     return multi_polygon_.findBounds();
@@ -109,6 +109,8 @@ class MultiPolygonShape : public Shape
     virtual bool isValid() override;
     virtual bool checkContain(const Vecd &probe_point, bool BOUNDARY_INCLUDED = true) override;
     virtual Vecd findClosestPoint(const Vecd &probe_point) override;
+    /** hash of the points of all polygon rings */
+    virtual uint64_t getSourceHash() override;
 
   protected:
     MultiPolygon multi_polygon_;
@@ -44,4 +44,21 @@ void CellLinkedList::searchNeighborsByParticles(
                  });
 }
 //=================================================================================================//
+template <typename FunctionOnListData>
+void CellLinkedList::forEachListDataAroundPosition(const Vecd &position, int search_depth,
+                                                   const FunctionOnListData &function)
+{
+    Array2i target_cell_index = CellIndexFromPosition(position);
+    mesh_for_each(
+        Array2i::Zero().max(target_cell_index - search_depth * Array2i::Ones()),
+        all_cells_.min(target_cell_index + (search_depth + 1) * Array2i::Ones()),
+        [&](int l, int m)
+        {
+            for (const ListData &list_data : cell_data_lists_[l][m])
+            {
+                function(list_data);
+            }
+        });
+}
+//=================================================================================================//
 } // namespace SPH
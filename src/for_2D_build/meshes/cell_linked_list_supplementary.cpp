@@ -84,7 +84,7 @@ void CellLinkedList ::InsertListDataEntry(size_t particle_index, const Vecd &par
 ListData CellLinkedList::findNearestListDataEntry(const Vecd &position)
 {
     Real min_distance_sqr = MaxReal;
-    ListData nearest_entry(MaxSize_t, MaxReal * Vecd::Ones());
+    ListData nearest_entry(MaxParticleIndex, MaxReal * Vecd::Ones());
 
     Array2i cell = CellIndexFromPosition(position);
     mesh_for_each(
@@ -40,7 +40,7 @@ void GridDataPackage<PKG_SIZE, ADDRS_BUFFER>::
 template <int PKG_SIZE, int ADDRS_BUFFER>
 template <class DataType>
 DataType GridDataPackage<PKG_SIZE, ADDRS_BUFFER>::
-    probeDataPackage(PackageDataAddress<DataType> &pkg_data_addrs, const Vecd &position)
+    probeDataPackage(const PackageDataAddress<DataType> &pkg_data_addrs, const Vecd &position)
 {
     Arrayi grid_idx = CellIndexFromPosition(position);
     Vecd grid_pos = GridPositionFromIndex(grid_idx);
@@ -61,8 +61,8 @@ void GridDataPackage<PKG_SIZE, ADDRS_BUFFER>::
     computeGradient(const MeshVariable<InDataType> &in_variable,
                     const MeshVariable<OutDataType> &out_variable)
 {
-    auto &in_variable_addrs = getPackageDataAddress(in_variable);
-    auto &out_variable_addrs = getPackageDataAddress(out_variable);
+    auto in_variable_addrs = getPackageDataAddress(in_variable);
+    auto out_variable_addrs = getPackageDataAddress(out_variable);
 
     for_each_addrs(
         [&](int i, int j)
@@ -90,27 +90,8 @@ void GridDataPackage<PKG_SIZE, ADDRS_BUFFER>::
 //=================================================================================================//
 template <int PKG_SIZE, int ADDRS_BUFFER>
 template <typename DataType>
-void GridDataPackage<PKG_SIZE, ADDRS_BUFFER>::AssignSingularPackageDataAddress<DataType>::
-operator()(DataContainerAssemble<PackageData> &all_pkg_data,
-           DataContainerAssemble<PackageDataAddress> &all_pkg_data_addrs)
-{
-    constexpr int type_index = DataTypeIndex<DataType>::value;
-    for (size_t l = 0; l != std::get<type_index>(all_pkg_data).size(); ++l)
-    {
-        PackageData<DataType> &pkg_data = std::get<type_index>(all_pkg_data)[l];
-        PackageDataAddress<DataType> &pkg_data_addrs = std::get<type_index>(all_pkg_data_addrs)[l];
-        for (int i = 0; i != pkg_addrs_size; ++i)
-            for (int j = 0; j != pkg_addrs_size; ++j)
-            {
-                pkg_data_addrs[i][j] = &pkg_data[0][0];
-            }
-    }
-}
-//=================================================================================================//
-template <int PKG_SIZE, int ADDRS_BUFFER>
-template <typename DataType>
 DataType GridDataPackage<PKG_SIZE, ADDRS_BUFFER>::
-    CornerAverage(PackageDataAddress<DataType> &pkg_data_addrs, Arrayi addrs_index, Arrayi corner_direction)
+    CornerAverage(const PackageDataAddress<DataType> &pkg_data_addrs, Arrayi addrs_index, Arrayi corner_direction)
 {
     DataType average = ZeroData<DataType>::value;
     for (int i = 0; i != 2; ++i)
@@ -123,23 +104,6 @@ DataType GridDataPackage<PKG_SIZE, ADDRS_BUFFER>::
     return average * 0.25;
 }
 //=================================================================================================//
-template <int PKG_SIZE, int ADDRS_BUFFER>
-template <typename DataType>
-void GridDataPackage<PKG_SIZE, ADDRS_BUFFER>::AssignPackageDataAddress<DataType>::
-operator()(DataContainerAssemble<PackageDataAddress> &all_pkg_data_addrs,
-           const Arrayi &addrs_index,
-           DataContainerAssemble<PackageData> &all_pkg_data,
-           const Arrayi &data_index)
-{
-    constexpr int type_index = DataTypeIndex<DataType>::value;
-    for (size_t l = 0; l != std::get<type_index>(all_pkg_data).size(); ++l)
-    {
-        PackageData<DataType> &pkg_data = std::get<type_index>(all_pkg_data)[l];
-        PackageDataAddress<DataType> &pkg_data_addrs = std::get<type_index>(all_pkg_data_addrs)[l];
-        pkg_data_addrs[addrs_index[0]][addrs_index[1]] = &pkg_data[data_index[0]][data_index[1]];
-    }
-}
-//=================================================================================================//
 template <class GridDataPackageType>
 template <typename DataType>
 DataType MeshWithGridDataPackages<GridDataPackageType>::
@@ -168,15 +132,11 @@ void MeshWithGridDataPackages<GridDataPackageType>::
     GridDataPackageType *data_pkg = data_pkg_addrs_[i][j];
     if (data_pkg->isInnerPackage())
     {
-        for (int l = 0; l != pkg_addrs_size; ++l)
-            for (int m = 0; m != pkg_addrs_size; ++m)
+        for (int l = -1; l != 2; ++l)
+            for (int m = -1; m != 2; ++m)
             {
-                std::pair<int, int> x_pair = CellShiftAndDataIndex(l);
-                std::pair<int, int> y_pair = CellShiftAndDataIndex(m);
-                data_pkg->assignPackageDataAddress(
-                    Arrayi(l, m),
-                    data_pkg_addrs_[i + x_pair.first][j + y_pair.first],
-                    Arrayi(x_pair.second, y_pair.second));
+                int neighbor = 3 * (l + 1) + m + 1;
+                data_pkg->assignNeighborPackageId(neighbor, data_pkg_addrs_[i + l][j + m]->PackageId());
             }
     }
 }
@@ -214,7 +174,7 @@ DataType MeshWithGridDataPackages<GridDataPackageType>::
 {
     Arrayi grid_index = CellIndexFromPosition(position);
     GridDataPackageType *data_pkg = data_pkg_addrs_[grid_index[0]][grid_index[1]];
-    auto &pkg_data_addrs = data_pkg->getPackageDataAddress(mesh_variable);
+    auto pkg_data_addrs = data_pkg->getPackageDataAddress(mesh_variable);
     return data_pkg->isInnerPackage() ? data_pkg->GridDataPackageType::
                                             template probeDataPackage<DataType>(pkg_data_addrs, position)
                                       : *pkg_data_addrs[0][0];
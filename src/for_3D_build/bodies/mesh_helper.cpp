@@ -497,18 +497,38 @@ namespace SPH
         out_file << "\n</DataArray>\n";
     }
 
+    uint8_t MeshFileHelpers::vtuCellType(size_t number_of_nodes)
+    {
+        switch (number_of_nodes)
+        {
+        case 4:
+            return 10; // tetrahedron
+        case 5:
+            return 14; // pyramid
+        case 6:
+            return 13; // wedge
+        case 8:
+            return 12; // hexahedron
+        default:
+            std::cout << "\n Error: no VTK cell type for an element with " << number_of_nodes << " nodes!" << std::endl;
+            std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+            exit(1);
+        }
+    }
+
     void MeshFileHelpers::vtuFileTypeOfCell(std::ofstream& out_file, StdLargeVec<StdVec<size_t>>& elements_nodes_connection_)
     {
-        size_t type = 10;
-        //Specifies type of cell 10 = tetrahedral
-        out_file << "<DataArray type=\"UInt8\" Name=\"types\" format=\"ascii\" RangeMin=\"10\" RangeMax=\"10\">\n";
-        for (const auto& types : elements_nodes_connection_)
+        int range_min = 255, range_max = 0;
+        for (const auto& element : elements_nodes_connection_)
         {
-            for (size_t i = 0; i < types.size(); ++i)
-            {
-                out_file << type << " ";
-            }
-            out_file << "\n";
+            range_min = SMIN(range_min, int(vtuCellType(element.size())));
+            range_max = SMAX(range_max, int(vtuCellType(element.size())));
+        }
+        out_file << "<DataArray type=\"UInt8\" Name=\"types\" format=\"ascii\" RangeMin=\"" << range_min
+                 << "\" RangeMax=\"" << range_max << "\">\n";
+        for (const auto& element : elements_nodes_connection_)
+        {
+            out_file << int(vtuCellType(element.size())) << "\n";
         }
         // Write face attribute data
         out_file << "</DataArray>\n";
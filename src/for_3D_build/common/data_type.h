@@ -30,12 +30,14 @@
 
 #include "base_data_type.h"
 #include "scalar_functions.h"
+#include "symmetric_matrix.h"
 
 namespace SPH
 {
 using Arrayi = Array3i;
 using Vecd = Vec3d;
 using Matd = Mat3d;
+using SymMatd = SymMat3d;
 using AlignedBox = AlignedBox3d;
 using AngularVecd = Vec3d;
 using Rotation = Rotation3d;
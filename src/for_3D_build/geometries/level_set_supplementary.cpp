@@ -13,11 +13,18 @@ LevelSet::LevelSet(BoundingBox tentative_bounds, Real data_spacing,
                    Shape &shape, SPHAdaptation &sph_adaptation)
     : LevelSet(tentative_bounds, data_spacing, 4, shape, sph_adaptation)
 {
-    mesh_parallel_for(MeshRange(Arrayi::Zero(), all_cells_),
-                      [&](size_t i, size_t j, size_t k)
-                      {
-                          initializeDataInACell(Arrayi(i, j, k));
-                      });
+    if (is_narrow_band_)
+    {
+        initializeNarrowBandData();
+    }
+    else
+    {
+        mesh_parallel_for(MeshRange(Arrayi::Zero(), all_cells_),
+                          [&](size_t i, size_t j, size_t k)
+                          {
+                              initializeDataInACell(Arrayi(i, j, k));
+                          });
+    }
 
     finishDataPackages();
 }
@@ -55,8 +62,10 @@ void LevelSet::finishDataPackages()
                           initializePackageAddressesInACell(Arrayi(i, j, k));
                       });
 
+    if (is_narrow_band_)
+        redistanceByFastSweeping(true);
     updateLevelSetGradient();
-    updateKernelIntegrals();
+    resetKernelIntegrals();
 }
 //=================================================================================================//
 bool LevelSet::isWithinCorePackage(Vecd position)
@@ -82,8 +91,8 @@ void LevelSet::diffuseLevelSetSign()
         inner_data_pkgs_,
         [&](LevelSetDataPackage *data_pkg)
         {
-            auto &phi_addrs = data_pkg->getPackageDataAddress(phi_);
-            auto &near_interface_id_addrs = data_pkg->getPackageDataAddress(near_interface_id_);
+            auto phi_addrs = data_pkg->getPackageDataAddress(phi_);
+            auto near_interface_id_addrs = data_pkg->getPackageDataAddress(near_interface_id_);
 
             data_pkg->for_each_addrs(
                 [&](int i, int j, int k)
@@ -115,8 +124,8 @@ void LevelSet::reinitializeLevelSet()
         inner_data_pkgs_,
         [&](LevelSetDataPackage *data_pkg)
         {
-            auto &phi_addrs = data_pkg->getPackageDataAddress(phi_);
-            auto &near_interface_id_addrs_ = data_pkg->getPackageDataAddress(near_interface_id_);
+            auto phi_addrs = data_pkg->getPackageDataAddress(phi_);
+            auto near_interface_id_addrs_ = data_pkg->getPackageDataAddress(near_interface_id_);
 
             data_pkg->for_each_addrs(
                 [&](int i, int j, int k)
@@ -143,8 +152,8 @@ void LevelSet::markNearInterface(Real small_shift_factor)
         inner_data_pkgs_,
         [&](LevelSetDataPackage *data_pkg)
         {
-            auto &phi_addrs = data_pkg->getPackageDataAddress(phi_);
-            auto &near_interface_id_addrs = data_pkg->getPackageDataAddress(near_interface_id_);
+            auto phi_addrs = data_pkg->getPackageDataAddress(phi_);
+            auto near_interface_id_addrs = data_pkg->getPackageDataAddress(near_interface_id_);
 
             // corner averages, note that the first row and first column are not used
             LevelSetDataPackage::PackageTemporaryData<Real> corner_averages;
@@ -207,8 +216,8 @@ void LevelSet::redistanceInterfaceForAPackage(LevelSetDataPackage *core_data_pkg
     int l = (int)core_data_pkg->CellIndexOnMesh()[0];
     int m = (int)core_data_pkg->CellIndexOnMesh()[1];
     int n = (int)core_data_pkg->CellIndexOnMesh()[2];
-    auto &phi_addrs = core_data_pkg->getPackageDataAddress(phi_);
-    auto &near_interface_id_addrs = core_data_pkg->getPackageDataAddress(near_interface_id_);
+    auto phi_addrs = core_data_pkg->getPackageDataAddress(phi_);
+    auto near_interface_id_addrs = core_data_pkg->getPackageDataAddress(near_interface_id_);
 
     core_data_pkg->for_each_addrs(
         [&](int i, int j, int k)
@@ -287,6 +296,7 @@ void LevelSet::redistanceInterfaceForAPackage(LevelSetDataPackage *core_data_pkg
 //=================================================================================================//
 void LevelSet::writeMeshFieldToPlt(std::ofstream &output_file)
 {
+    updateKernelIntegrals();
     Arrayi number_of_operation = global_mesh_.AllGridPoints();
 
     output_file << "\n";
@@ -0,0 +1,410 @@
+#include "triangle_mesh_bvh.h"
+
+#include "tbb/parallel_invoke.h"
+
+#include <algorithm>
+#include <iostream>
+
+namespace SPH
+{
+//=================================================================================================//
+TriangleMeshBVH::TriangleMeshBVH(const StdVec<Vec3d> &vertices, const StdVec<Array3i> &faces)
+    : vertices_(vertices), faces_(faces), number_of_nodes_(1), length_tolerance_(0)
+{
+    size_t number_of_triangles = faces_.size();
+    if (number_of_triangles == 0)
+    {
+        std::cout << "\n Error: the triangle mesh for the BVH has no faces!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+
+    face_normals_.resize(number_of_triangles);
+    centroids_.resize(number_of_triangles);
+    face_lower_.resize(number_of_triangles);
+    face_upper_.resize(number_of_triangles);
+    sorted_triangles_.resize(number_of_triangles);
+    parallel_for(
+        IndexRange(0, number_of_triangles),
+        [&](const IndexRange &r)
+        {
+            for (size_t i = r.begin(); i != r.end(); ++i)
+            {
+                const Vec3d &a = vertices_[faces_[i][0]];
+                const Vec3d &b = vertices_[faces_[i][1]];
+                const Vec3d &c = vertices_[faces_[i][2]];
+                Vec3d normal = (b - a).cross(c - a);
+                face_normals_[i] = normal / (normal.norm() + TinyReal);
+                centroids_[i] = (a + b + c) / 3.0;
+                face_lower_[i] = a.cwiseMin(b).cwiseMin(c);
+                face_upper_[i] = a.cwiseMax(b).cwiseMax(c);
+                sorted_triangles_[i] = i;
+            }
+        },
+        ap);
+
+    Vec3d lower, upper;
+    findRangeBounds(0, number_of_triangles, lower, upper);
+    length_tolerance_ = 1.0e2 * std::numeric_limits<Real>::epsilon() * (upper - lower).norm();
+
+    /** a binary tree with at most one triangle per leaf has less inner nodes than triangles. */
+    nodes_.resize(number_of_triangles);
+    buildNode(0, 0, number_of_triangles, 0);
+    nodes_.resize(number_of_nodes_);
+}
+//=================================================================================================//
+void TriangleMeshBVH::findRangeBounds(int begin, int end, Vec3d &lower, Vec3d &upper) const
+{
+    lower = Vec3d::Constant(MaxReal);
+    upper = Vec3d::Constant(-MaxReal);
+    for (int i = begin; i != end; ++i)
+    {
+        lower = lower.cwiseMin(face_lower_[sorted_triangles_[i]]);
+        upper = upper.cwiseMax(face_upper_[sorted_triangles_[i]]);
+    }
+}
+//=================================================================================================//
+int TriangleMeshBVH::partitionRange(int begin, int end, int depth)
+{
+    Vec3d centroid_lower = Vec3d::Constant(MaxReal);
+    Vec3d centroid_upper = Vec3d::Constant(-MaxReal);
+    for (int i = begin; i != end; ++i)
+    {
+        centroid_lower = centroid_lower.cwiseMin(centroids_[sorted_triangles_[i]]);
+        centroid_upper = centroid_upper.cwiseMax(centroids_[sorted_triangles_[i]]);
+    }
+    Vec3d extent = centroid_upper - centroid_lower;
+    int largest_axis = 0;
+    extent.maxCoeff(&largest_axis);
+    if (extent[largest_axis] <= 0.0)
+        return (begin + end) / 2;
+
+    auto binIndex = [&](int triangle, int axis)
+    {
+        Real scale = Real(number_of_bins_) / extent[axis];
+        return SMIN(int((centroids_[triangle][axis] - centroid_lower[axis]) * scale), number_of_bins_ - 1);
+    };
+
+    /** binned SAH, the deep subtrees are split at the median to bound the tree depth. */
+    if (depth < max_sah_depth_)
+    {
+        Real best_cost = MaxReal;
+        int best_axis = -1, best_bin = -1;
+        for (int axis = 0; axis != 3; ++axis)
+        {
+            if (extent[axis] <= 0.0)
+                continue;
+
+            std::array<int, number_of_bins_> bin_count{};
+            std::array<Vec3d, number_of_bins_> bin_lower, bin_upper;
+            bin_lower.fill(Vec3d::Constant(MaxReal));
+            bin_upper.fill(Vec3d::Constant(-MaxReal));
+            for (int i = begin; i != end; ++i)
+            {
+                int triangle = sorted_triangles_[i];
+                int bin = binIndex(triangle, axis);
+                bin_count[bin]++;
+                bin_lower[bin] = bin_lower[bin].cwiseMin(face_lower_[triangle]);
+                bin_upper[bin] = bin_upper[bin].cwiseMax(face_upper_[triangle]);
+            }
+
+            auto halfArea = [](const Vec3d &lower, const Vec3d &upper)
+            {
+                Vec3d box = (upper - lower).cwiseMax(Vec3d::Zero());
+                return box[0] * box[1] + box[1] * box[2] + box[2] * box[0];
+            };
+            std::array<Real, number_of_bins_> right_cost{};
+            Vec3d lower = Vec3d::Constant(MaxReal), upper = Vec3d::Constant(-MaxReal);
+            int count = 0;
+            for (int bin = number_of_bins_ - 1; bin > 0; --bin)
+            {
+                lower = lower.cwiseMin(bin_lower[bin]);
+                upper = upper.cwiseMax(bin_upper[bin]);
+                count += bin_count[bin];
+                right_cost[bin] = count == 0 ? MaxReal : halfArea(lower, upper) * count;
+            }
+            lower = Vec3d::Constant(MaxReal), upper = Vec3d::Constant(-MaxReal);
+            count = 0;
+            for (int bin = 0; bin != number_of_bins_ - 1; ++bin)
+            {
+                lower = lower.cwiseMin(bin_lower[bin]);
+                upper = upper.cwiseMax(bin_upper[bin]);
+                count += bin_count[bin];
+                if (count == 0 || right_cost[bin + 1] == MaxReal)
+                    continue;
+                Real cost = halfArea(lower, upper) * count + right_cost[bin + 1];
+                if (cost < best_cost)
+                {
+                    best_cost = cost;
+                    best_axis = axis;
+                    best_bin = bin;
+                }
+            }
+        }
+
+        if (best_axis >= 0)
+        {
+            int *middle = std::partition(sorted_triangles_.data() + begin, sorted_triangles_.data() + end,
+                                         [&](int triangle)
+                                         { return binIndex(triangle, best_axis) <= best_bin; });
+            int middle_index = middle - sorted_triangles_.data();
+            if (middle_index != begin && middle_index != end)
+                return middle_index;
+        }
+    }
+
+    int middle_index = (begin + end) / 2;
+    std::nth_element(sorted_triangles_.data() + begin, sorted_triangles_.data() + middle_index,
+                     sorted_triangles_.data() + end, [&](int triangle_a, int triangle_b)
+                     { return centroids_[triangle_a][largest_axis] < centroids_[triangle_b][largest_axis]; });
+    return middle_index;
+}
+//=================================================================================================//
+void TriangleMeshBVH::buildNode(int node_index, int begin, int end, int depth)
+{
+    Node &node = nodes_[node_index];
+    if (end - begin <= leaf_size_) // only for the root of a very small mesh
+    {
+        setChild(node_index, 0, begin, end, depth);
+        node.lower_.col(1).setConstant(MaxReal);
+        node.upper_.col(1).setConstant(-MaxReal);
+        node.child_[1] = -1 - end;
+        node.count_[1] = 0;
+        return;
+    }
+
+    int middle = partitionRange(begin, end, depth);
+    if (end - begin > 4096)
+    {
+        tbb::parallel_invoke([&]()
+                             { setChild(node_index, 0, begin, middle, depth); },
+                             [&]()
+                             { setChild(node_index, 1, middle, end, depth); });
+    }
+    else
+    {
+        setChild(node_index, 0, begin, middle, depth);
+        setChild(node_index, 1, middle, end, depth);
+    }
+}
+//=================================================================================================//
+void TriangleMeshBVH::setChild(int node_index, int k, int begin, int end, int depth)
+{
+    Vec3d lower, upper;
+    findRangeBounds(begin, end, lower, upper);
+    Node &node = nodes_[node_index];
+    node.lower_.col(k) = lower.array();
+    node.upper_.col(k) = upper.array();
+    if (end - begin <= leaf_size_)
+    {
+        node.child_[k] = -1 - begin;
+        node.count_[k] = end - begin;
+    }
+    else
+    {
+        int child_index = number_of_nodes_.fetch_add(1);
+        node.child_[k] = child_index;
+        node.count_[k] = 0;
+        buildNode(child_index, begin, end, depth + 1);
+    }
+}
+//=================================================================================================//
+Vec3d TriangleMeshBVH::closestPointOnTriangle(const Vec3d &probe_point, int face_id) const
+{
+    const Vec3d &a = vertices_[faces_[face_id][0]];
+    const Vec3d &b = vertices_[faces_[face_id][1]];
+    const Vec3d &c = vertices_[faces_[face_id][2]];
+    Vec3d ab = b - a, ac = c - a, from_a = probe_point - a;
+    Real d1 = ab.dot(from_a), d2 = ac.dot(from_a);
+    if (d1 <= 0.0 && d2 <= 0.0)
+        return a;
+
+    Vec3d from_b = probe_point - b;
+    Real d3 = ab.dot(from_b), d4 = ac.dot(from_b);
+    if (d3 >= 0.0 && d4 <= d3)
+        return b;
+
+    Real vc = d1 * d4 - d3 * d2;
+    if (vc <= 0.0 && d1 >= 0.0 && d3 <= 0.0)
+        return a + ab * d1 / (d1 - d3);
+
+    Vec3d from_c = probe_point - c;
+    Real d5 = ab.dot(from_c), d6 = ac.dot(from_c);
+    if (d6 >= 0.0 && d5 <= d6)
+        return c;
+
+    Real vb = d5 * d2 - d1 * d6;
+    if (vb <= 0.0 && d2 >= 0.0 && d6 <= 0.0)
+        return a + ac * d2 / (d2 - d6);
+
+    Real va = d3 * d6 - d5 * d4;
+    if (va <= 0.0 && (d4 - d3) >= 0.0 && (d5 - d6) >= 0.0)
+        return b + (c - b) * (d4 - d3) / ((d4 - d3) + (d5 - d6));
+
+    Real denominator = 1.0 / (va + vb + vc);
+    return a + ab * vb * denominator + ac * vc * denominator;
+}
+//=================================================================================================//
+Vec3d TriangleMeshBVH::findClosestPoint(const Vec3d &probe_point, int &face_id) const
+{
+    Real best_distance = MaxReal; // squared
+    Vec3d closest_point = probe_point;
+    face_id = -1;
+
+    std::array<std::pair<int, Real>, stack_size_> stack;
+    int top = 0;
+    stack[top++] = {0, 0.0};
+    ChildBounds probe = probe_point.array().replicate<1, 2>();
+    while (top != 0)
+    {
+        std::pair<int, Real> entry = stack[--top];
+        if (entry.second >= best_distance)
+            continue;
+
+        const Node &node = nodes_[entry.first];
+        Eigen::Array<Real, 1, 2> box_distance =
+            ((node.lower_ - probe).max(0.0) + (probe - node.upper_).max(0.0)).square().colwise().sum();
+        int nearer = box_distance[0] <= box_distance[1] ? 0 : 1;
+        std::array<int, 2> order = {nearer, 1 - nearer};
+        std::array<int, 2> inner_children;
+        int number_of_inner_children = 0;
+        for (int k : order)
+        {
+            if (box_distance[k] >= best_distance)
+                continue;
+            if (node.child_[k] >= 0)
+            {
+                inner_children[number_of_inner_children++] = k;
+                continue;
+            }
+            int first = -1 - node.child_[k];
+            for (int i = first; i != first + node.count_[k]; ++i)
+            {
+                int triangle = sorted_triangles_[i];
+                Vec3d point = closestPointOnTriangle(probe_point, triangle);
+                Real distance = (point - probe_point).squaredNorm();
+                if (distance < best_distance)
+                {
+                    best_distance = distance;
+                    closest_point = point;
+                    face_id = triangle;
+                }
+            }
+        }
+        /** the nearer child is pushed last to be visited first. */
+        for (int l = number_of_inner_children - 1; l >= 0; --l)
+        {
+            int k = inner_children[l];
+            stack[top++] = {node.child_[k], box_distance[k]};
+        }
+    }
+    return closest_point;
+}
+//=================================================================================================//
+Vec3d TriangleMeshBVH::findClosestPoint(const Vec3d &probe_point) const
+{
+    int face_id;
+    return findClosestPoint(probe_point, face_id);
+}
+//=================================================================================================//
+Vec3d TriangleMeshBVH::getFaceNormal(int face_id) const
+{
+    return face_normals_[face_id];
+}
+//=================================================================================================//
+bool TriangleMeshBVH::countRayCrossings(const Vec3d &origin, const Vec3d &direction,
+                                        int &crossings, bool &on_surface) const
+{
+    const Real tolerance = 1.0e2 * std::numeric_limits<Real>::epsilon();
+    crossings = 0;
+    on_surface = false;
+
+    std::array<int, stack_size_> stack;
+    int top = 0;
+    stack[top++] = 0;
+    ChildBounds ray_origin = origin.array().replicate<1, 2>();
+    ChildBounds inverse_direction = direction.array().inverse().replicate<1, 2>();
+    while (top != 0)
+    {
+        const Node &node = nodes_[stack[--top]];
+        ChildBounds t_lower = (node.lower_ - ray_origin) * inverse_direction;
+        ChildBounds t_upper = (node.upper_ - ray_origin) * inverse_direction;
+        Eigen::Array<Real, 1, 2> t_enter = t_lower.min(t_upper).colwise().maxCoeff();
+        Eigen::Array<Real, 1, 2> t_exit = t_lower.max(t_upper).colwise().minCoeff();
+        for (int k = 0; k != 2; ++k)
+        {
+            if (t_exit[k] < SMAX(t_enter[k], Real(0)))
+                continue;
+            if (node.child_[k] >= 0)
+            {
+                stack[top++] = node.child_[k];
+                continue;
+            }
+
+            int first = -1 - node.child_[k];
+            for (int i = first; i != first + node.count_[k]; ++i)
+            {
+                const Array3i &face = faces_[sorted_triangles_[i]];
+                const Vec3d &a = vertices_[face[0]];
+                Vec3d edge_1 = vertices_[face[1]] - a;
+                Vec3d edge_2 = vertices_[face[2]] - a;
+                Vec3d p = direction.cross(edge_2);
+                Real determinant = edge_1.dot(p);
+                Real area_scale = edge_1.cross(edge_2).norm();
+                Vec3d s = origin - a;
+                if (ABS(determinant) <= tolerance * area_scale)
+                {
+                    /** a ray parallel to the triangle is ambiguous only within its plane. */
+                    if (ABS(s.dot(face_normals_[sorted_triangles_[i]])) <= length_tolerance_)
+                        return false;
+                    continue;
+                }
+
+                Real inverse_determinant = 1.0 / determinant;
+                Real u = s.dot(p) * inverse_determinant;
+                if (u < -tolerance || u > 1.0 + tolerance)
+                    continue;
+                Vec3d q = s.cross(edge_1);
+                Real v = direction.dot(q) * inverse_determinant;
+                if (v < -tolerance || u + v > 1.0 + tolerance)
+                    continue;
+                Real t = edge_2.dot(q) * inverse_determinant;
+                if (t < -length_tolerance_)
+                    continue;
+                if (t <= length_tolerance_)
+                {
+                    on_surface = true;
+                    return true;
+                }
+                if (u <= tolerance || v <= tolerance || u + v >= 1.0 - tolerance)
+                    return false;
+                crossings++;
+            }
+        }
+    }
+    return true;
+}
+//=================================================================================================//
+bool TriangleMeshBVH::checkContain(const Vec3d &probe_point, bool BOUNDARY_INCLUDED) const
+{
+    /** directions not aligned with the axes or the typical mesh edges, tried in turn when a ray is ambiguous. */
+    static const std::array<Vec3d, 3> directions = {Vec3d(0.5371, 0.3261, 0.7781).normalized(),
+                                                    Vec3d(-0.2873, 0.8669, -0.4073).normalized(),
+                                                    Vec3d(0.7237, -0.5119, -0.4627).normalized()};
+    for (const Vec3d &direction : directions)
+    {
+        int crossings = 0;
+        bool on_surface = false;
+        if (countRayCrossings(probe_point, direction, crossings, on_surface))
+            return on_surface ? BOUNDARY_INCLUDED : crossings % 2 == 1;
+    }
+
+    /** fall back to the side of the closest face. */
+    int face_id;
+    Vec3d from_face_to_point = probe_point - findClosestPoint(probe_point, face_id);
+    if (from_face_to_point.norm() <= length_tolerance_)
+        return BOUNDARY_INCLUDED;
+    return face_normals_[face_id].dot(from_face_to_point) < 0.0;
+}
+//=================================================================================================//
+} // namespace SPH
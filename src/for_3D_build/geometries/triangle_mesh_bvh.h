@@ -0,0 +1,98 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	triangle_mesh_bvh.h
+ * @brief 	Bounding volume hierarchy of a triangle mesh for fast geometric queries.
+ * @author	Chi Zhang and Xiangyu Hu
+ */
+
+#ifndef TRIANGLE_MESH_BVH_H
+#define TRIANGLE_MESH_BVH_H
+
+#include "base_data_type.h"
+#include "large_data_containers.h"
+#include "scalar_functions.h"
+
+#include <array>
+#include <atomic>
+
+namespace SPH
+{
+/**
+ * @class TriangleMeshBVH
+ * @brief Bounding volume hierarchy of triangles built with the binned surface area heuristic (SAH).
+ * @details Each node keeps the bounds of its two children side by side,
+ * 			so that both children are tested together by vectorized array operations.
+ * 			The subtrees are built in parallel. All queries are const and keep their traversal
+ * 			stack locally, therefore they are thread safe and can be called from particle or package loops.
+ * 			The containment test counts the ray crossings (parity) and assumes a closed mesh.
+ */
+class TriangleMeshBVH
+{
+  public:
+    TriangleMeshBVH(const StdVec<Vec3d> &vertices, const StdVec<Array3i> &faces);
+    virtual ~TriangleMeshBVH(){};
+
+    size_t NumberOfTriangles() const { return faces_.size(); };
+    size_t NumberOfNodes() const { return nodes_.size(); };
+    /** closest point on the mesh and the face it locates. */
+    Vec3d findClosestPoint(const Vec3d &probe_point, int &face_id) const;
+    Vec3d findClosestPoint(const Vec3d &probe_point) const;
+    Vec3d getFaceNormal(int face_id) const;
+    bool checkContain(const Vec3d &probe_point, bool BOUNDARY_INCLUDED = true) const;
+
+  protected:
+    using ChildBounds = Eigen::Array<Real, 3, 2>;
+    /** Children with index less than zero are leaves with the triangles
+     * from sorted_triangles_[-1 - child_] to sorted_triangles_[-1 - child_ + count_]. */
+    struct Node
+    {
+        ChildBounds lower_, upper_;
+        std::array<int, 2> child_;
+        std::array<int, 2> count_;
+    };
+    static constexpr int leaf_size_ = 4;
+    static constexpr int number_of_bins_ = 16;
+    static constexpr int max_sah_depth_ = 48;
+    static constexpr int stack_size_ = 128;
+
+    StdVec<Vec3d> vertices_;
+    StdVec<Array3i> faces_;
+    StdVec<Vec3d> face_normals_;
+    StdVec<Vec3d> centroids_;
+    StdVec<Vec3d> face_lower_, face_upper_;
+    StdVec<int> sorted_triangles_;
+    StdVec<Node> nodes_;
+    std::atomic<int> number_of_nodes_;
+    Real length_tolerance_; /**< for detecting probe points on the surface. */
+
+    void findRangeBounds(int begin, int end, Vec3d &lower, Vec3d &upper) const;
+    int partitionRange(int begin, int end, int depth);
+    void buildNode(int node_index, int begin, int end, int depth);
+    void setChild(int node_index, int k, int begin, int end, int depth);
+    Vec3d closestPointOnTriangle(const Vec3d &probe_point, int face_id) const;
+    /** returns false if the ray grazes an edge or vertex, or starts on the surface. */
+    bool countRayCrossings(const Vec3d &origin, const Vec3d &direction, int &crossings, bool &on_surface) const;
+};
+} // namespace SPH
+#endif // TRIANGLE_MESH_BVH_H
@@ -29,8 +29,36 @@ SimTK::ContactGeometry::TriangleMesh *TriangleMeshShape::getTriangleMesh()
     return triangle_mesh_;
 }
 //=================================================================================================//
+void TriangleMeshShape::buildBVH()
+{
+    SimTK::ContactGeometry::TriangleMesh *triangle_mesh = getTriangleMesh();
+    StdVec<Vec3d> vertices(triangle_mesh->getNumVertices());
+    for (size_t i = 0; i != vertices.size(); ++i)
+        vertices[i] = SimTKToEigen(triangle_mesh->getVertexPosition(i));
+    StdVec<Array3i> faces(triangle_mesh->getNumFaces());
+    for (size_t i = 0; i != faces.size(); ++i)
+        for (int k = 0; k != 3; ++k)
+            faces[i][k] = triangle_mesh->getFaceVertex(i, k);
+    bvh_ = bvh_ptr_keeper_.createPtr<TriangleMeshBVH>(vertices, faces);
+}
+//=================================================================================================//
+uint64_t TriangleMeshShape::getSourceHash()
+{
+    SimTK::ContactGeometry::TriangleMesh *triangle_mesh = getTriangleMesh();
+    uint64_t hash = hashBytes(nullptr, 0);
+    for (int i = 0; i != triangle_mesh->getNumVertices(); ++i)
+        hash = hashData(SimTKToEigen(triangle_mesh->getVertexPosition(i)), hash);
+    for (int i = 0; i != triangle_mesh->getNumFaces(); ++i)
+        for (int k = 0; k != 3; ++k)
+            hash = hashData(triangle_mesh->getFaceVertex(i, k), hash);
+    return hash;
+}
+//=================================================================================================//
 bool TriangleMeshShape::checkContain(const Vec3d &probe_point, bool BOUNDARY_INCLUDED)
 {
+    if (bvh_ != nullptr)
+        return bvh_->checkContain(probe_point, BOUNDARY_INCLUDED);
+
     SimTKVec2 uv_coordinate;
     bool inside = false; // note that direct prediction is not reliable sometime.
     int face_id;
@@ -66,6 +94,9 @@ bool TriangleMeshShape::checkContain(const Vec3d &probe_point, bool BOUNDARY_INC
 //=================================================================================================//
 Vecd TriangleMeshShape::findClosestPoint(const Vecd &probe_point)
 {
+    if (bvh_ != nullptr)
+        return bvh_->findClosestPoint(probe_point);
+
     bool inside = false;
     int face_id;
     SimTKVec2 norm;
@@ -111,6 +142,7 @@ TriangleMeshShapeSTL::TriangleMeshShapeSTL(const std::string &filepathname, Vecd
     polymesh.loadStlFile(filepathname);
     polymesh.scaleMesh(scale_factor);
     triangle_mesh_ = generateTriangleMesh(polymesh.transformMesh(SimTKVec3(translation[0], translation[1], translation[2])));
+    buildBVH();
 }
 //=================================================================================================//
 TriangleMeshShapeSTL::TriangleMeshShapeSTL(const std::string &filepathname, Mat3d rotation,
@@ -132,6 +164,7 @@ TriangleMeshShapeSTL::TriangleMeshShapeSTL(const std::string &filepathname, Mat3
                                                                             (double)rotation(2, 0), (double)rotation(2, 1), (double)rotation(2, 2))),
                                         SimTKVec3((double)translation[0], (double)translation[1], (double)translation[2]));
     triangle_mesh_ = generateTriangleMesh(polymesh.transformMesh(transform));
+    buildBVH();
 }
 //=================================================================================================//
 #ifdef __EMSCRIPTEN__
@@ -143,6 +176,7 @@ TriangleMeshShapeSTL::TriangleMeshShapeSTL(const uint8_t *buffer, Vecd translati
     polymesh.loadStlBuffer(buffer);
     polymesh.scaleMesh(scale_factor);
     triangle_mesh_ = generateTriangleMesh(polymesh.transformMesh(SimTKVec3(translation[0], translation[1], translation[2])));
+    buildBVH();
 }
 #endif
 //=================================================================================================//
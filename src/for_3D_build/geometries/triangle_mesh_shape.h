@@ -32,6 +32,7 @@
 
 #include "all_simbody.h"
 #include "base_geometry.h"
+#include "triangle_mesh_bvh.h"
 
 #include <filesystem>
 #include <fstream>
@@ -49,10 +50,11 @@ class TriangleMeshShape : public Shape
 {
   private:
     UniquePtrKeeper<SimTK::ContactGeometry::TriangleMesh> triangle_mesh_ptr_keeper_;
+    UniquePtrKeeper<TriangleMeshBVH> bvh_ptr_keeper_;
 
   public:
     explicit TriangleMeshShape(const std::string &shape_name, const SimTK::PolygonalMesh *mesh = nullptr)
-        : Shape(shape_name), triangle_mesh_(nullptr)
+        : Shape(shape_name), triangle_mesh_(nullptr), bvh_(nullptr)
     {
         if (mesh)
             triangle_mesh_ = generateTriangleMesh(*mesh);
@@ -62,11 +64,18 @@ class TriangleMeshShape : public Shape
      * when probe distance is far from the surface. */
     virtual bool checkContain(const Vec3d &probe_point, bool BOUNDARY_INCLUDED = true) override;
     virtual Vec3d findClosestPoint(const Vec3d &probe_point) override;
+    /** hash of the vertices and faces of the triangle mesh */
+    virtual uint64_t getSourceHash() override;
 
     SimTK::ContactGeometry::TriangleMesh *getTriangleMesh();
+    /** Build the bounding volume hierarchy of the triangles. After that, the containment
+     * and closest-point queries use it instead of SimTK, which is much faster for large meshes.
+     * The containment is then given by ray parity and requires a closed mesh. */
+    void buildBVH();
 
   protected:
     SimTK::ContactGeometry::TriangleMesh *triangle_mesh_;
+    TriangleMeshBVH *bvh_;
 
     /** generate triangle mesh from polygon mesh */
     SimTK::ContactGeometry::TriangleMesh *generateTriangleMesh(const SimTK::PolygonalMesh &poly_mesh);
@@ -76,6 +85,7 @@ class TriangleMeshShape : public Shape
 /**
  * @class TriangleMeshShapeSTL
  * @brief Input triangle mesh with stl file.
+ * The bounding volume hierarchy is built after loading, so that the file should give a closed mesh.
  */
 class TriangleMeshShapeSTL : public TriangleMeshShape
 {
@@ -45,4 +45,21 @@ void CellLinkedList::searchNeighborsByParticles(
                  });
 }
 //=================================================================================================//
+template <typename FunctionOnListData>
+void CellLinkedList::forEachListDataAroundPosition(const Vecd &position, int search_depth,
+                                                   const FunctionOnListData &function)
+{
+    Array3i target_cell_index = CellIndexFromPosition(position);
+    mesh_for_each(
+        Array3i::Zero().max(target_cell_index - search_depth * Array3i::Ones()),
+        all_cells_.min(target_cell_index + (search_depth + 1) * Array3i::Ones()),
+        [&](int l, int m, int n)
+        {
+            for (const ListData &list_data : cell_data_lists_[l][m][n])
+            {
+                function(list_data);
+            }
+        });
+}
+//=================================================================================================//
 } // namespace SPH
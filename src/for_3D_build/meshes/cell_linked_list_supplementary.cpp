@@ -81,7 +81,7 @@ void CellLinkedList ::InsertListDataEntry(size_t particle_index, const Vecd &par
 ListData CellLinkedList::findNearestListDataEntry(const Vecd &position)
 {
     Real min_distance_sqr = MaxReal;
-    ListData nearest_entry = std::make_pair(MaxSize_t, MaxReal * Vecd::Ones());
+    ListData nearest_entry = std::make_pair(MaxParticleIndex, MaxReal * Vecd::Ones());
 
     Array3i cell = CellIndexFromPosition(position);
     mesh_for_each(
@@ -41,7 +41,7 @@ void GridDataPackage<PKG_SIZE, ADDRS_BUFFER>::
 template <int PKG_SIZE, int ADDRS_BUFFER>
 template <class DataType>
 DataType GridDataPackage<PKG_SIZE, ADDRS_BUFFER>::
-    probeDataPackage(PackageDataAddress<DataType> &pkg_data_addrs, const Vecd &position)
+    probeDataPackage(const PackageDataAddress<DataType> &pkg_data_addrs, const Vecd &position)
 {
     Arrayi grid_idx = CellIndexFromPosition(position);
     Vecd grid_pos = GridPositionFromIndex(grid_idx);
@@ -65,8 +65,8 @@ void GridDataPackage<PKG_SIZE, ADDRS_BUFFER>::
     computeGradient(const MeshVariable<InDataType> &in_variable,
                     const MeshVariable<OutDataType> &out_variable)
 {
-    auto &in_variable_addrs = getPackageDataAddress(in_variable);
-    auto &out_variable_addrs = getPackageDataAddress(out_variable);
+    auto in_variable_addrs = getPackageDataAddress(in_variable);
+    auto out_variable_addrs = getPackageDataAddress(out_variable);
 
     for_each_addrs(
         [&](int i, int j, int k)
@@ -96,46 +96,8 @@ void GridDataPackage<PKG_SIZE, ADDRS_BUFFER>::
 //=================================================================================================//
 template <int PKG_SIZE, int ADDRS_BUFFER>
 template <typename DataType>
-void GridDataPackage<PKG_SIZE, ADDRS_BUFFER>::AssignSingularPackageDataAddress<DataType>::
-operator()(DataContainerAssemble<PackageData> &all_pkg_data,
-           DataContainerAssemble<PackageDataAddress> &all_pkg_data_addrs)
-{
-    constexpr int type_index = DataTypeIndex<DataType>::value;
-    for (size_t l = 0; l != std::get<type_index>(all_pkg_data).size(); ++l)
-    {
-        PackageData<DataType> &pkg_data = std::get<type_index>(all_pkg_data)[l];
-        PackageDataAddress<DataType> &pkg_data_addrs = std::get<type_index>(all_pkg_data_addrs)[l];
-        for (int i = 0; i != pkg_addrs_size; ++i)
-            for (int j = 0; j != pkg_addrs_size; ++j)
-                for (int k = 0; k != pkg_addrs_size; ++k)
-                {
-                    pkg_data_addrs[i][j][k] = &pkg_data[0][0][0];
-                }
-    }
-}
-//=================================================================================================//
-template <int PKG_SIZE, int ADDRS_BUFFER>
-template <typename DataType>
-void GridDataPackage<PKG_SIZE, ADDRS_BUFFER>::AssignPackageDataAddress<DataType>::
-operator()(DataContainerAssemble<PackageDataAddress> &all_pkg_data_addrs,
-           const Arrayi &addrs_index,
-           DataContainerAssemble<PackageData> &all_pkg_data,
-           const Arrayi &data_index)
-{
-    constexpr int type_index = DataTypeIndex<DataType>::value;
-    for (size_t l = 0; l != std::get<type_index>(all_pkg_data).size(); ++l)
-    {
-        PackageData<DataType> &pkg_data = std::get<type_index>(all_pkg_data)[l];
-        PackageDataAddress<DataType> &pkg_data_addrs = std::get<type_index>(all_pkg_data_addrs)[l];
-        pkg_data_addrs[addrs_index[0]][addrs_index[1]][addrs_index[2]] =
-            &pkg_data[data_index[0]][data_index[1]][data_index[2]];
-    }
-}
-//=================================================================================================//
-template <int PKG_SIZE, int ADDRS_BUFFER>
-template <typename DataType>
 DataType GridDataPackage<PKG_SIZE, ADDRS_BUFFER>::
-    CornerAverage(PackageDataAddress<DataType> &pkg_data_addrs, Arrayi addrs_index, Arrayi corner_direction)
+    CornerAverage(const PackageDataAddress<DataType> &pkg_data_addrs, Arrayi addrs_index, Arrayi corner_direction)
 {
     DataType average = ZeroData<DataType>::value;
     for (int i = 0; i != 2; ++i)
@@ -180,18 +142,12 @@ void MeshWithGridDataPackages<GridDataPackageType>::
     GridDataPackageType *data_pkg = data_pkg_addrs_[i][j][k];
     if (data_pkg->isInnerPackage())
     {
-        for (int l = 0; l != pkg_addrs_size; ++l)
-            for (int m = 0; m != pkg_addrs_size; ++m)
-                for (int n = 0; n != pkg_addrs_size; ++n)
+        for (int l = -1; l != 2; ++l)
+            for (int m = -1; m != 2; ++m)
+                for (int n = -1; n != 2; ++n)
                 {
-                    std::pair<int, int> x_pair = CellShiftAndDataIndex(l);
-                    std::pair<int, int> y_pair = CellShiftAndDataIndex(m);
-                    std::pair<int, int> z_pair = CellShiftAndDataIndex(n);
-
-                    data_pkg->assignPackageDataAddress(
-                        Arrayi(l, m, n),
-                        data_pkg_addrs_[i + x_pair.first][j + y_pair.first][k + z_pair.first],
-                        Arrayi(x_pair.second, y_pair.second, z_pair.second));
+                    int neighbor = 9 * (l + 1) + 3 * (m + 1) + n + 1;
+                    data_pkg->assignNeighborPackageId(neighbor, data_pkg_addrs_[i + l][j + m][k + n]->PackageId());
                 }
     }
 }
@@ -229,7 +185,7 @@ DataType MeshWithGridDataPackages<GridDataPackageType>::
 {
     Arrayi index = CellIndexFromPosition(position);
     GridDataPackageType *data_pkg = data_pkg_addrs_[index[0]][index[1]][index[2]];
-    auto &pkg_data_addrs = data_pkg->getPackageDataAddress(mesh_variable);
+    auto pkg_data_addrs = data_pkg->getPackageDataAddress(mesh_variable);
     return data_pkg->isInnerPackage() ? data_pkg->GridDataPackageType::
                                             template probeDataPackage<DataType>(pkg_data_addrs, position)
                                       : *pkg_data_addrs[0][0][0];
@@ -116,7 +116,7 @@ class BarCorrectConfiguration : public LocalDynamics, public BarDataInner
     };
 
   protected:
-    StdLargeVec<Real> &Vol_;
+    StdLargeVec<StorageReal> &Vol_;
     StdLargeVec<Matd> &B_;
     StdLargeVec<Vecd> &n0_;
     StdLargeVec<Vecd> &b_n0_;
@@ -161,7 +161,7 @@ class BarDeformationGradientTensor : public LocalDynamics, public BarDataInner
     };
 
   protected:
-    StdLargeVec<Real> &Vol_;
+    StdLargeVec<StorageReal> &Vol_;
     StdLargeVec<Vecd> &pos_, &pseudo_n_, &n0_;
     StdLargeVec<Matd> &B_, &F_, &F_bending_;
     StdLargeVec<Matd> &transformation_matrix_;
@@ -181,7 +181,8 @@ class BaseBarRelaxation : public LocalDynamics, public BarDataInner
     virtual ~BaseBarRelaxation(){};
 
   protected:
-    StdLargeVec<Real> &rho_, &thickness_, &mass_, &Vol_;
+    StdLargeVec<Real> &rho_, &thickness_, &mass_;
+    StdLargeVec<StorageReal> &Vol_;
     StdLargeVec<Vecd> &pos_, &vel_, &force_, &force_prior_;
     StdLargeVec<Vecd> &n0_, &pseudo_n_, &dpseudo_n_dt_, &dpseudo_n_d2t_, &rotation_,
         &angular_vel_, &dangular_vel_dt_;
@@ -248,7 +249,7 @@ class BarStressRelaxationFirstHalf : public BaseBarRelaxation
 
   protected:
     ElasticSolid &elastic_solid_;
-    StdLargeVec<Real>& Vol_;
+    StdLargeVec<StorageReal> &Vol_;
     StdLargeVec<Matd> &global_stress_, &global_moment_, &mid_surface_cauchy_stress_, &numerical_damping_scaling_;
     StdLargeVec<Vecd> &global_shear_stress_, &n_;
 
@@ -16,7 +16,8 @@ SPHAdaptation::SPHAdaptation(Real resolution_ref, Real h_spacing_ratio, Real sys
       h_ref_(h_spacing_ratio_ * spacing_ref_), kernel_ptr_(makeUnique<KernelWendlandC2>(h_ref_)),
       sigma0_ref_(computeLatticeNumberDensity(Vecd())),
       spacing_min_(this->MostRefinedSpacingRegular(spacing_ref_, local_refinement_level_)),
-      Vol_min_(pow(spacing_min_, Dimensions)), h_ratio_max_(spacing_ref_ / spacing_min_){};
+      Vol_min_(pow(spacing_min_, Dimensions)), h_ratio_max_(spacing_ref_ / spacing_min_),
+      is_narrow_band_level_set_(false){};
 //=================================================================================================//
 Real SPHAdaptation::MostRefinedSpacing(Real coarse_particle_spacing, int local_refinement_level)
 {
@@ -97,6 +98,12 @@ UniquePtr<BaseLevelSet> SPHAdaptation::createLevelSet(Shape &shape, Real refinem
     return makeUnique<RefinedLevelSet>(shape.getBounds(), *coarser_level_sets.getMeshLevels().back(), shape, *this);
 }
 //=================================================================================================//
+UniquePtr<BaseLevelSet> SPHAdaptation::createFarFieldLevelSet(Shape &shape, Real refinement_ratio)
+{
+    // the same mesh as the finest level set from createLevelSet
+    return makeUnique<LevelSet>(shape.getBounds(), ReferenceSpacing() / refinement_ratio, 4, shape, *this);
+}
+//=================================================================================================//
 ParticleWithLocalRefinement::
     ParticleWithLocalRefinement(Real resolution_ref, Real h_spacing_ratio, Real system_refinement_ratio,
                                 int local_refinement_level)
@@ -142,6 +149,12 @@ UniquePtr<BaseLevelSet> ParticleWithLocalRefinement::createLevelSet(Shape &shape
                                           getLevelSetTotalLevel(), shape, *this);
 }
 //=================================================================================================//
+UniquePtr<BaseLevelSet> ParticleWithLocalRefinement::createFarFieldLevelSet(Shape &shape, Real refinement_ratio)
+{
+    return makeUnique<MultilevelLevelSet>(shape.getBounds(), ReferenceSpacing() / refinement_ratio,
+                                          getLevelSetTotalLevel(), 4, shape, *this);
+}
+//=================================================================================================//
 Real ParticleRefinementByShape::smoothedSpacing(const Real &measure, const Real &transition_thickness)
 {
     Real ratio_ref = measure / (2.0 * transition_thickness);
@@ -62,6 +62,7 @@ class SPHAdaptation
     Real spacing_min_;             /**< minimum particle spacing determined by local refinement level */
     Real Vol_min_;                 /**< minimum particle volume measure determined by local refinement level */
     Real h_ratio_max_;             /**< the ratio between the reference smoothing length to the minimum smoothing length */
+    bool is_narrow_band_level_set_; /**< level set is built with the narrow-band approach, false by default */
 
   public:
     explicit SPHAdaptation(Real resolution_ref, Real h_spacing_ratio = 1.3, Real system_refinement_ratio = 1.0);
@@ -78,9 +79,15 @@ class SPHAdaptation
     virtual Real SmoothingLengthRatio(size_t particle_index_i) { return 1.0; };
     void resetAdaptationRatios(Real h_spacing_ratio, Real new_system_refinement_ratio = 1.0);
     virtual void initializeAdaptationVariables(BaseParticles &base_particles){};
+    /** The narrow-band level set queries the shape only in the core packages near the surface,
+     * which is much faster for complex geometries, see LevelSet. */
+    void setNarrowBandLevelSet(bool is_narrow_band = true) { is_narrow_band_level_set_ = is_narrow_band; };
+    bool isNarrowBandLevelSet() { return is_narrow_band_level_set_; };
 
     virtual UniquePtr<BaseCellLinkedList> createCellLinkedList(const BoundingBox &domain_bounds);
     virtual UniquePtr<BaseLevelSet> createLevelSet(Shape &shape, Real refinement_ratio);
+    /** level set with the same meshes as createLevelSet but only far field initialized, e.g. to be read from a cache. */
+    virtual UniquePtr<BaseLevelSet> createFarFieldLevelSet(Shape &shape, Real refinement_ratio);
 
     template <class KernelType, typename... Args>
     void resetKernel(Args &&...args)
@@ -119,6 +126,7 @@ class ParticleWithLocalRefinement : public SPHAdaptation
     virtual void initializeAdaptationVariables(BaseParticles &base_particles) override;
     virtual UniquePtr<BaseCellLinkedList> createCellLinkedList(const BoundingBox &domain_bounds) override;
     virtual UniquePtr<BaseLevelSet> createLevelSet(Shape &shape, Real refinement_ratio) override;
+    virtual UniquePtr<BaseLevelSet> createFarFieldLevelSet(Shape &shape, Real refinement_ratio) override;
 
   protected:
     Real finest_spacing_bound_;   /**< the adaptation bound for finest particles */
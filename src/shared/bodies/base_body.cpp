@@ -8,7 +8,7 @@ namespace SPH
 {
 //=================================================================================================//
 SPHBody::SPHBody(SPHSystem &sph_system, Shape &shape, const std::string &name)
-    : sph_system_(sph_system), body_name_(name), newly_updated_(true),
+    : sph_system_(sph_system), body_name_(name), newly_updated_(true), state_version_(0),
       base_particles_(nullptr), is_bound_set_(false), initial_shape_(&shape),
       sph_adaptation_(sph_adaptation_ptr_keeper_.createPtr<SPHAdaptation>(sph_system.ReferenceResolution())),
       base_material_(nullptr)
@@ -119,6 +119,16 @@ void SPHBody::readFromXmlForReloadParticle(std::string &filefullpath)
     base_particles_->readFromXmlForReloadParticle(filefullpath);
 }
 //=================================================================================================//
+void SPHBody::writeToBinaryForReloadParticle(std::string &filefullpath, uint64_t source_checksum)
+{
+    base_particles_->writeToBinaryForReloadParticle(filefullpath, source_checksum);
+}
+//=================================================================================================//
+bool SPHBody::readFromBinaryForReloadParticle(std::string &filefullpath, const std::string &source_filefullpath)
+{
+    return base_particles_->readFromBinaryForReloadParticle(filefullpath, source_filefullpath);
+}
+//=================================================================================================//
 BaseCellLinkedList &RealBody::getCellLinkedList()
 {
     if (!cell_linked_list_created_)
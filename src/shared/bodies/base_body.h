@@ -72,6 +72,7 @@ class SPHBody
     SPHSystem &sph_system_;
     std::string body_name_;
     bool newly_updated_;            /**< whether this body is in a newly updated state */
+    size_t state_version_;          /**< counter increased whenever the body state is updated */
     BaseParticles *base_particles_; /**< Base particles for dynamic cast DataDelegate  */
     bool is_bound_set_;             /**< whether the bounding box is set */
     BoundingBox bound_;             /**< bounding box of the body */
@@ -99,7 +100,12 @@ class SPHBody
     IndexRange LoopRange() { return IndexRange(0, base_particles_->total_real_particles_); };
     size_t SizeOfLoopRange() { return base_particles_->total_real_particles_; };
     Real getSPHBodyResolutionRef() { return sph_adaptation_->ReferenceSpacing(); };
-    void setNewlyUpdated() { newly_updated_ = true; };
+    void setNewlyUpdated()
+    {
+        newly_updated_ = true;
+        ++state_version_;
+    };
+    size_t StateVersion() { return state_version_; };
     void setNotNewlyUpdated() { newly_updated_ = false; };
     bool checkNewlyUpdated() { return newly_updated_; };
     void setSPHBodyBounds(const BoundingBox &bound);
@@ -208,6 +214,8 @@ class SPHBody
     virtual void readParticlesFromXmlForRestart(std::string &filefullpath);
     virtual void writeToXmlForReloadParticle(std::string &filefullpath);
     virtual void readFromXmlForReloadParticle(std::string &filefullpath);
+    virtual void writeToBinaryForReloadParticle(std::string &filefullpath, uint64_t source_checksum = 0);
+    virtual bool readFromBinaryForReloadParticle(std::string &filefullpath, const std::string &source_filefullpath = "");
     virtual SPHBody *ThisObjectPtr() { return this; };
 };
 
@@ -71,6 +71,8 @@ namespace SPH
         static void vtuFileCellConnectivity(std::ofstream& out_file, StdLargeVec<StdVec<size_t>>& elements_nodes_connection_, StdLargeVec<Vecd>& node_coordinates_);
         static void vtuFileOffsets(std::ofstream& out_file, StdLargeVec<StdVec<size_t>>& elements_nodes_connection_);
         static void vtuFileTypeOfCell(std::ofstream& out_file, StdLargeVec<StdVec<size_t>>& elements_nodes_connection_);
+        /** VTK cell type of a 3D element given by its number of nodes */
+        static uint8_t vtuCellType(size_t number_of_nodes);
 
         /*Functions for .msh file from FLUENT*/
         static void numberofNodesFluent(ifstream& mesh_file, size_t& number_of_points, string& text_line);
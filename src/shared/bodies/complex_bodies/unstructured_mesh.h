@@ -164,7 +164,7 @@ class GhostCreationFromMesh : public GeneralDataDelegateSimple
     StdLargeVec<Vecd> &node_coordinates_;
     vector<vector<vector<size_t>>> &mesh_topology_;
     StdLargeVec<Vecd> &pos_;
-    StdLargeVec<Real> &Vol_;
+    StdLargeVec<StorageReal> &Vol_;
     void addGhostParticleAndSetInConfiguration();
 
   public:
@@ -184,23 +184,37 @@ class BodyStatesRecordingInMeshToVtp : public BodyStatesRecording
   public:
     BodyStatesRecordingInMeshToVtp(SPHBody &body, ANSYSMesh &ansys_mesh);
     virtual ~BodyStatesRecordingInMeshToVtp(){};
+    /** write the data arrays in appended binary format, optionally compressed by zlib */
+    void setAppendedDataOutput(VtkAppendedData::Encoding encoding, bool zlib_compression = false)
+    {
+        appended_data_ = makeUnique<VtkAppendedData>(encoding, zlib_compression);
+    };
 
   protected:
     virtual void writeWithFileName(const std::string &sequence) override;
+    void writeAppendedDataFile(const std::string &filefullpath, SPHBody &body);
     StdLargeVec<Vecd> &node_coordinates_;
     StdLargeVec<StdVec<size_t>>&elements_nodes_connection_;
+    UniquePtr<VtkAppendedData> appended_data_;
 };
 class BodyStatesRecordingInMeshToVtu : public BodyStatesRecording
 {
 public:
     BodyStatesRecordingInMeshToVtu(SPHBody& body, ANSYSMesh& ansys_mesh);
     virtual ~BodyStatesRecordingInMeshToVtu() {};
+    /** write the data arrays in appended binary format, optionally compressed by zlib */
+    void setAppendedDataOutput(VtkAppendedData::Encoding encoding, bool zlib_compression = false)
+    {
+        appended_data_ = makeUnique<VtkAppendedData>(encoding, zlib_compression);
+    };
 
 protected:
     virtual void writeWithFileName(const std::string& sequence) override;
+    void writeAppendedDataFile(const std::string &filefullpath, SPHBody &body);
     StdLargeVec<Vecd>& node_coordinates_;
     StdLargeVec<StdVec<size_t>>& elements_nodes_connection_;
     SPHBody& bounds_;
+    UniquePtr<VtkAppendedData> appended_data_;
 };
 //----------------------------------------------------------------------
 //	BoundaryConditionSetupInFVM
@@ -223,7 +237,10 @@ class BoundaryConditionSetupInFVM : public fluid_dynamics::FluidDataInner
     void resetBoundaryConditions();
 
   protected:
-    StdLargeVec<Real> &rho_, &Vol_, &mass_, &p_;
+    StdLargeVec<Real> &rho_;
+    StdLargeVec<StorageReal> &Vol_;
+    StdLargeVec<Real> &mass_;
+    StdLargeVec<StorageReal> &p_;
     StdLargeVec<Vecd> &vel_, &pos_, &mom_;
     std::pair<size_t, size_t> &ghost_bound_;
     vector<vector<size_t>> &each_boundary_type_with_all_ghosts_index_;
@@ -22,6 +22,11 @@ BaseInnerRelation::BaseInnerRelation(RealBody &real_body)
     : SPHRelation(real_body), real_body_(&real_body)
 {
     subscribeToBody();
+    resizeConfiguration();
+}
+//=================================================================================================//
+void BaseInnerRelation::resizeConfiguration()
+{
     inner_configuration_.resize(base_particles_.real_particles_bound_, Neighborhood());
 }
 //=================================================================================================//
@@ -44,6 +49,11 @@ BaseContactRelation::BaseContactRelation(SPHBody &sph_body, RealBodyVector conta
 {
     subscribeToBody();
     contact_configuration_.resize(contact_bodies_.size());
+    resizeConfiguration();
+}
+//=================================================================================================//
+void BaseContactRelation::resizeConfiguration()
+{
     for (size_t k = 0; k != contact_bodies_.size(); ++k)
     {
         contact_configuration_[k].resize(base_particles_.real_particles_bound_, Neighborhood());
@@ -116,6 +116,8 @@ class SPHRelation
 
     void subscribeToBody() { sph_body_.body_relations_.push_back(this); };
     virtual void updateConfiguration() = 0;
+    /** resize the configurations after the particle bounds are changed */
+    virtual void resizeConfiguration(){};
 };
 
 /**
@@ -132,6 +134,7 @@ class BaseInnerRelation : public SPHRelation
     ParticleConfiguration inner_configuration_; /**< inner configuration for the neighbor relations. */
     explicit BaseInnerRelation(RealBody &real_body);
     virtual ~BaseInnerRelation(){};
+    virtual void resizeConfiguration() override;
     BaseInnerRelation &getRelation() { return *this; };
 };
 
@@ -152,6 +155,7 @@ class BaseContactRelation : public SPHRelation
     BaseContactRelation(SPHBody &sph_body, BodyPartVector contact_body_parts)
         : BaseContactRelation(sph_body, BodyPartsToRealBodies(contact_body_parts)){};
     virtual ~BaseContactRelation(){};
+    virtual void resizeConfiguration() override;
     BaseContactRelation &getRelation() { return *this; };
 };
 } // namespace SPH
@@ -51,13 +51,21 @@ using DataContainerAddressKeeper = StdVec<ContainedDataType *>;
 template <typename ContainedDataType>
 using DataContainerUniquePtrKeeper = UniquePtrsKeeper<ContainedDataType>;
 
+/** In mixed precision mode, the scalars in storage precision are assembled as an extra data type. */
 template <template <typename> typename KeeperType, template <typename> typename ContainerType>
 using DataAssemble = std::tuple<KeeperType<ContainerType<Real>>,
                                 KeeperType<ContainerType<Vec2d>>,
                                 KeeperType<ContainerType<Vec3d>>,
                                 KeeperType<ContainerType<Mat2d>>,
                                 KeeperType<ContainerType<Mat3d>>,
-                                KeeperType<ContainerType<int>>>;
+                                KeeperType<ContainerType<int>>,
+                                KeeperType<ContainerType<SymMat2d>>,
+                                KeeperType<ContainerType<SymMat3d>>
+#if SPHINXSYS_USE_MIXED_PRECISION
+                                ,
+                                KeeperType<ContainerType<StorageReal>>
+#endif
+                                >;
 /** Generalized data container assemble type */
 template <template <typename> typename ContainerType>
 using DataContainerAssemble = DataAssemble<DataContainerKeeper, ContainerType>;
@@ -78,6 +86,11 @@ class DataAssembleOperation
     OperationType<Mat2d> matrix2d_operation;
     OperationType<Mat3d> matrix3d_operation;
     OperationType<int> integer_operation;
+    OperationType<SymMat2d> symmetric_matrix2d_operation;
+    OperationType<SymMat3d> symmetric_matrix3d_operation;
+#if SPHINXSYS_USE_MIXED_PRECISION
+    OperationType<StorageReal> storage_scalar_operation;
+#endif
 
   public:
     template <typename... Args>
@@ -87,7 +100,14 @@ class DataAssembleOperation
           vector3d_operation(std::forward<Args>(args)...),
           matrix2d_operation(std::forward<Args>(args)...),
           matrix3d_operation(std::forward<Args>(args)...),
-          integer_operation(std::forward<Args>(args)...){};
+          integer_operation(std::forward<Args>(args)...),
+          symmetric_matrix2d_operation(std::forward<Args>(args)...),
+          symmetric_matrix3d_operation(std::forward<Args>(args)...)
+#if SPHINXSYS_USE_MIXED_PRECISION
+          ,
+          storage_scalar_operation(std::forward<Args>(args)...)
+#endif
+              {};
     template <typename... OperationArgs>
     void operator()(OperationArgs &&... operation_args)
     {
@@ -97,6 +117,11 @@ class DataAssembleOperation
         matrix2d_operation(std::forward<OperationArgs>(operation_args)...);
         matrix3d_operation(std::forward<OperationArgs>(operation_args)...);
         integer_operation(std::forward<OperationArgs>(operation_args)...);
+        symmetric_matrix2d_operation(std::forward<OperationArgs>(operation_args)...);
+        symmetric_matrix3d_operation(std::forward<OperationArgs>(operation_args)...);
+#if SPHINXSYS_USE_MIXED_PRECISION
+        storage_scalar_operation(std::forward<OperationArgs>(operation_args)...);
+#endif
     }
 };
 
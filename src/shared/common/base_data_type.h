@@ -33,6 +33,7 @@
 #include <cassert>
 #include <climits>
 #include <cmath>
+#include <cstdint>
 #include <iostream>
 #include <limits>
 #include <map>
@@ -73,6 +74,27 @@ using Real = double;
 using EigMat = Eigen::MatrixXd;
 #endif
 
+/** Float point number for storage of large data in mixed precision mode.
+ *  The neighbor data and the bulk particle variables which are not integrated in time,
+ *  i.e. volume and pressure, are stored with it. The integrated variables, e.g. position, velocity,
+ *  density and mass (integrated by Eulerian schemes), and the rates of change are kept in Real. */
+#if SPHINXSYS_USE_FLOAT && SPHINXSYS_USE_MIXED_PRECISION
+#error "SPHINXSYS_USE_MIXED_PRECISION requires Real to be double, i.e. SPHINXSYS_USE_FLOAT off."
+#endif
+#if SPHINXSYS_USE_MIXED_PRECISION
+using StorageReal = float;
+#else
+using StorageReal = Real;
+#endif
+
+/** Particle index saved in large data, such as neighbor and cell lists.
+ *  Note that size_t is still used for indices at the interfaces. */
+#if SPHINXSYS_USE_32BIT_INDEX
+using ParticleIndex = uint32_t;
+#else
+using ParticleIndex = size_t;
+#endif
+
 /** Vector with integers. */
 using Array2i = Eigen::Array<int, 2, 1>;
 using Array3i = Eigen::Array<int, 3, 1>;
@@ -89,6 +111,23 @@ using AlignedBox3d = Eigen::AlignedBox<Real, 3>;
 using Rotation2d = Eigen::Rotation2D<Real>;
 using Rotation3d = Eigen::AngleAxis<Real>;
 
+/** Type trait for the storage type of a data type. */
+template <typename DataType>
+struct StorageDataType
+{
+    using type = DataType;
+};
+template <>
+struct StorageDataType<Real>
+{
+    using type = StorageReal;
+};
+template <int Rows, int Cols, int Options, int MaxRows, int MaxCols>
+struct StorageDataType<Eigen::Matrix<Real, Rows, Cols, Options, MaxRows, MaxCols>>
+{
+    using type = Eigen::Matrix<StorageReal, Rows, Cols, Options, MaxRows, MaxCols>;
+};
+
 /** Unified initialize to zero for all data type. */
 /**
  * NOTE: Eigen::Matrix<> constexpr constructor?
@@ -152,6 +191,13 @@ struct DataTypeIndex<int>
 {
     static constexpr int value = 5;
 };
+#if SPHINXSYS_USE_MIXED_PRECISION
+template <>
+struct DataTypeIndex<StorageReal>
+{
+    static constexpr int value = 8;
+};
+#endif
 /** Verbal boolean for positive and negative axis directions. */
 const int xAxis = 0;
 const int yAxis = 1;
@@ -166,6 +212,7 @@ constexpr Real TinyReal = Real(2.71051e-20);
 constexpr Real MinReal = std::numeric_limits<Real>::min();
 constexpr Real MaxReal = std::numeric_limits<Real>::max();
 constexpr size_t MaxSize_t = std::numeric_limits<size_t>::max();
+constexpr ParticleIndex MaxParticleIndex = std::numeric_limits<ParticleIndex>::max();
 
 /** Bounding box for system, body, body part and shape, first: lower bound, second: upper bound. */
 template <typename VecType>
@@ -0,0 +1,288 @@
+#include "binary_data_file.h"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#define SPHINXSYS_BINARY_DATA_MMAP 1
+#endif
+
+namespace fs = std::filesystem;
+//=================================================================================================//
+namespace SPH
+{
+//=================================================================================================//
+namespace
+{
+constexpr size_t checksum_block_size = 1024 * 1024;
+constexpr uint64_t fnv_offset_basis = 14695981039346656037ULL;
+constexpr uint64_t fnv_prime = 1099511628211ULL;
+//=================================================================================================//
+uint64_t hashBytes(const char *data, size_t bytes, uint64_t hash)
+{
+    for (size_t i = 0; i != bytes; ++i)
+    {
+        hash = (hash ^ uint64_t(static_cast<unsigned char>(data[i]))) * fnv_prime;
+    }
+    return hash;
+}
+//=================================================================================================//
+/** blocks are hashed in parallel and the block hashes are then hashed in order */
+uint64_t extendChecksum(const char *data, size_t bytes, uint64_t checksum)
+{
+    size_t number_of_blocks = (bytes + checksum_block_size - 1) / checksum_block_size;
+    StdVec<uint64_t> block_hashes(number_of_blocks);
+    parallel_for(
+        IndexRange(0, number_of_blocks),
+        [&](const IndexRange &r)
+        {
+            for (size_t n = r.begin(); n != r.end(); ++n)
+            {
+                size_t begin = n * checksum_block_size;
+                block_hashes[n] = hashBytes(data + begin, std::min(checksum_block_size, bytes - begin), fnv_offset_basis);
+            }
+        });
+    return hashBytes(reinterpret_cast<const char *>(block_hashes.data()), number_of_blocks * sizeof(uint64_t), checksum);
+}
+//=================================================================================================//
+template <typename T>
+void appendValue(std::string &buffer, const T &value)
+{
+    buffer.append(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+//=================================================================================================//
+void appendString(std::string &buffer, const std::string &value)
+{
+    appendValue<uint64_t>(buffer, value.size());
+    buffer.append(value);
+}
+//=================================================================================================//
+void exitWithError(const std::string &message, const std::string &filefullpath, int line)
+{
+    std::cout << "\n Error: " << message << " " << filefullpath << std::endl;
+    std::cout << __FILE__ << ':' << line << std::endl;
+    exit(1);
+}
+//=================================================================================================//
+class HeaderReader
+{
+    const char *data_;
+    size_t size_;
+    const std::string &filefullpath_;
+    size_t position_;
+
+  public:
+    HeaderReader(const char *data, size_t size, const std::string &filefullpath)
+        : data_(data), size_(size), filefullpath_(filefullpath), position_(0){};
+    size_t Position() { return position_; };
+
+    std::string readString(size_t length)
+    {
+        if (position_ + length > size_)
+            exitWithError("truncated binary data file", filefullpath_, __LINE__);
+        std::string value(data_ + position_, length);
+        position_ += length;
+        return value;
+    }
+
+    template <typename T>
+    T readValue()
+    {
+        T value;
+        std::memcpy(&value, readString(sizeof(T)).data(), sizeof(T));
+        return value;
+    }
+
+    std::string readString() { return readString(readValue<uint64_t>()); }
+};
+} // namespace
+//=================================================================================================//
+void BinaryDataWriter::addBlock(const std::string &name, size_t number_of_elements)
+{
+    blocks_.push_back({name, number_of_elements, {}});
+}
+//=================================================================================================//
+void BinaryDataWriter::addArray(const std::string &name, int type_index, size_t element_size, const char *data)
+{
+    BinaryBlockRecord &block = blocks_.back();
+    block.arrays_.push_back({name, uint32_t(type_index), uint32_t(element_size), 0, element_size * block.number_of_elements_});
+    array_data_.push_back(data);
+}
+//=================================================================================================//
+void BinaryDataWriter::writeToFile(const std::string &filefullpath)
+{
+    StdVec<size_t> offset_positions;
+    std::string header = signature_;
+    appendValue<double>(header, time_);
+    appendValue<uint64_t>(header, source_checksum_);
+    appendValue<uint64_t>(header, blocks_.size());
+    for (const BinaryBlockRecord &block : blocks_)
+    {
+        appendString(header, block.name_);
+        appendValue<uint64_t>(header, block.number_of_elements_);
+        appendValue<uint64_t>(header, block.arrays_.size());
+        for (const BinaryArrayRecord &array_record : block.arrays_)
+        {
+            appendString(header, array_record.name_);
+            appendValue<uint32_t>(header, array_record.type_index_);
+            appendValue<uint32_t>(header, array_record.element_size_);
+            offset_positions.push_back(header.size());
+            appendValue<uint64_t>(header, 0);
+            appendValue<uint64_t>(header, array_record.bytes_);
+        }
+    }
+
+    // the arrays follow the header contiguously
+    uint64_t offset = header.size();
+    size_t array_index = 0;
+    for (BinaryBlockRecord &block : blocks_)
+    {
+        for (BinaryArrayRecord &array_record : block.arrays_)
+        {
+            array_record.offset_ = offset;
+            std::memcpy(&header[offset_positions[array_index++]], &offset, sizeof(uint64_t));
+            offset += array_record.bytes_;
+        }
+    }
+
+    std::ofstream out_file(filefullpath.c_str(), std::ios::trunc | std::ios::binary);
+    uint64_t checksum = extendChecksum(header.data(), header.size(), fnv_offset_basis);
+    out_file.write(header.data(), header.size());
+    array_index = 0;
+    for (const BinaryBlockRecord &block : blocks_)
+    {
+        for (const BinaryArrayRecord &array_record : block.arrays_)
+        {
+            const char *data = array_data_[array_index++];
+            checksum = extendChecksum(data, array_record.bytes_, checksum);
+            out_file.write(data, array_record.bytes_);
+        }
+    }
+    out_file.write(reinterpret_cast<const char *>(&checksum), sizeof(uint64_t));
+    out_file.close();
+}
+//=================================================================================================//
+BinaryDataReader::BinaryDataReader(const std::string &filefullpath, const std::string &signature)
+    : filefullpath_(filefullpath), data_(nullptr), size_(0), is_mapped_(false), time_(0), source_checksum_(0)
+{
+    if (!fs::exists(filefullpath_))
+    {
+        exitWithError("the input file is not exists:", filefullpath_, __LINE__);
+    }
+    loadFile();
+    readHeaderAndVerify(signature);
+}
+//=================================================================================================//
+BinaryDataReader::~BinaryDataReader()
+{
+#ifdef SPHINXSYS_BINARY_DATA_MMAP
+    if (is_mapped_)
+    {
+        munmap(const_cast<char *>(data_), size_);
+    }
+#endif
+}
+//=================================================================================================//
+void BinaryDataReader::loadFile()
+{
+    size_ = fs::file_size(filefullpath_);
+#ifdef SPHINXSYS_BINARY_DATA_MMAP
+    int file_descriptor = open(filefullpath_.c_str(), O_RDONLY);
+    if (file_descriptor != -1 && size_ != 0)
+    {
+        void *address = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+        close(file_descriptor);
+        if (address != MAP_FAILED)
+        {
+            data_ = static_cast<const char *>(address);
+            is_mapped_ = true;
+            return;
+        }
+    }
+    else if (file_descriptor != -1)
+    {
+        close(file_descriptor);
+    }
+#endif
+    loaded_data_.resize(size_);
+    std::ifstream in_file(filefullpath_.c_str(), std::ios::binary);
+    in_file.read(loaded_data_.data(), size_);
+    data_ = loaded_data_.data();
+}
+//=================================================================================================//
+void BinaryDataReader::readHeaderAndVerify(const std::string &signature)
+{
+    HeaderReader header_reader(data_, size_, filefullpath_);
+    if (header_reader.readString(signature.size()) != signature)
+    {
+        exitWithError("unexpected kind of binary data file", filefullpath_, __LINE__);
+    }
+    time_ = header_reader.readValue<double>();
+    source_checksum_ = header_reader.readValue<uint64_t>();
+    size_t number_of_blocks = header_reader.readValue<uint64_t>();
+    for (size_t i = 0; i != number_of_blocks; ++i)
+    {
+        BinaryBlockRecord block;
+        block.name_ = header_reader.readString();
+        block.number_of_elements_ = header_reader.readValue<uint64_t>();
+        size_t number_of_arrays = header_reader.readValue<uint64_t>();
+        for (size_t k = 0; k != number_of_arrays; ++k)
+        {
+            BinaryArrayRecord array_record;
+            array_record.name_ = header_reader.readString();
+            array_record.type_index_ = header_reader.readValue<uint32_t>();
+            array_record.element_size_ = header_reader.readValue<uint32_t>();
+            array_record.offset_ = header_reader.readValue<uint64_t>();
+            array_record.bytes_ = header_reader.readValue<uint64_t>();
+            block.arrays_.push_back(array_record);
+        }
+        blocks_.push_back(block);
+    }
+
+    uint64_t checksum = extendChecksum(data_, header_reader.Position(), fnv_offset_basis);
+    for (const BinaryBlockRecord &block : blocks_)
+    {
+        for (const BinaryArrayRecord &array_record : block.arrays_)
+        {
+            if (array_record.offset_ + array_record.bytes_ + sizeof(uint64_t) > size_)
+            {
+                exitWithError("truncated binary data file", filefullpath_, __LINE__);
+            }
+            checksum = extendChecksum(ArrayData(array_record), array_record.bytes_, checksum);
+        }
+    }
+    uint64_t saved_checksum;
+    std::memcpy(&saved_checksum, data_ + size_ - sizeof(uint64_t), sizeof(uint64_t));
+    if (checksum != saved_checksum)
+    {
+        exitWithError("checksum does not match for binary data file", filefullpath_, __LINE__);
+    }
+}
+//=================================================================================================//
+bool BinaryDataReader::isUpToDateWith(const std::string &source_filefullpath) const
+{
+    if (!fs::exists(source_filefullpath))
+    {
+        return true;
+    }
+    return source_checksum_ != 0
+               ? source_checksum_ == fileChecksum(source_filefullpath)
+               : fs::last_write_time(filefullpath_) >= fs::last_write_time(source_filefullpath);
+}
+//=================================================================================================//
+uint64_t fileChecksum(const std::string &filefullpath)
+{
+    StdVec<char> file_data(fs::file_size(filefullpath));
+    std::ifstream in_file(filefullpath.c_str(), std::ios::binary);
+    in_file.read(file_data.data(), file_data.size());
+    return extendChecksum(file_data.data(), file_data.size(), fnv_offset_basis);
+}
+//=================================================================================================//
+} // namespace SPH
+//=================================================================================================//
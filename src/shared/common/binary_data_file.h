@@ -0,0 +1,123 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	binary_data_file.h
+ * @brief 	Binary files of raw particle data arrays with header and checksum.
+ * @author	Chi Zhang and Xiangyu Hu
+ */
+#ifndef BINARY_DATA_FILE_H
+#define BINARY_DATA_FILE_H
+
+#include "large_data_containers.h"
+
+#include <cstdint>
+#include <string>
+
+namespace SPH
+{
+/** description of a raw array in a binary data file */
+struct BinaryArrayRecord
+{
+    std::string name_;
+    uint32_t type_index_;
+    uint32_t element_size_;
+    uint64_t offset_;
+    uint64_t bytes_;
+};
+
+/** a block of arrays with the same number of elements, e.g. the variables of a body */
+struct BinaryBlockRecord
+{
+    std::string name_;
+    uint64_t number_of_elements_;
+    StdVec<BinaryArrayRecord> arrays_;
+};
+
+/**
+ * @class BinaryDataWriter
+ * @brief Write raw arrays into a binary data file.
+ * The file begins with a signature identifying its kind, a time value, the checksum of the source file
+ * the data are converted from, if any, and a header listing the blocks and the names, types, sizes and offsets of their arrays.
+ * The arrays follow contiguously in native byte order and a checksum closes the file.
+ * The arrays are only referred to by address until the file is written.
+ */
+class BinaryDataWriter
+{
+  public:
+    BinaryDataWriter(const std::string &signature, double time, uint64_t source_checksum = 0)
+        : signature_(signature), time_(time), source_checksum_(source_checksum){};
+    void addBlock(const std::string &name, size_t number_of_elements);
+    /** add an array to the last block */
+    void addArray(const std::string &name, int type_index, size_t element_size, const char *data);
+    void writeToFile(const std::string &filefullpath);
+
+  protected:
+    std::string signature_;
+    double time_;
+    uint64_t source_checksum_;
+    StdVec<BinaryBlockRecord> blocks_;
+    StdVec<const char *> array_data_;
+};
+
+/**
+ * @class BinaryDataReader
+ * @brief Map a binary data file into memory and verify its checksum.
+ * On POSIX systems the file is memory mapped, otherwise it is loaded by a single read.
+ * The arrays are then accessed directly, e.g. for bulk copies into particle data.
+ * As the reader owns the mapped memory, it is not copyable.
+ */
+class BinaryDataReader
+{
+  public:
+    BinaryDataReader(const std::string &filefullpath, const std::string &signature);
+    BinaryDataReader(const BinaryDataReader &) = delete;
+    BinaryDataReader &operator=(const BinaryDataReader &) = delete;
+    ~BinaryDataReader();
+    double Time() const { return time_; };
+    /** checksum of the source file the data are converted from, zero if not converted */
+    uint64_t SourceChecksum() const { return source_checksum_; };
+    /** Check the data against the source file they may be converted from.
+     * Data converted from the source are up to date if the source is not changed since,
+     * while data written directly are up to date if the source is not newer than the file. */
+    bool isUpToDateWith(const std::string &source_filefullpath) const;
+    const StdVec<BinaryBlockRecord> &Blocks() const { return blocks_; };
+    const char *ArrayData(const BinaryArrayRecord &array_record) const { return data_ + array_record.offset_; };
+
+  protected:
+    std::string filefullpath_;
+    const char *data_;
+    size_t size_;
+    bool is_mapped_;
+    StdVec<char> loaded_data_;
+    double time_;
+    uint64_t source_checksum_;
+    StdVec<BinaryBlockRecord> blocks_;
+
+    void loadFile();
+    void readHeaderAndVerify(const std::string &signature);
+};
+
+/** checksum of the content of a file, e.g. the source file of converted binary data */
+uint64_t fileChecksum(const std::string &filefullpath);
+} // namespace SPH
+#endif // BINARY_DATA_FILE_H
@@ -28,6 +28,10 @@
 #ifndef LARGE_DATA_CONTAINERS_H
 #define LARGE_DATA_CONTAINERS_H
 
+#include "base_data_type.h"
+#include "particle_data_arena.h"
+#include "symmetric_matrix.h"
+
 #include "tbb/blocked_range.h"
 #include "tbb/blocked_range2d.h"
 #include "tbb/blocked_range3d.h"
@@ -42,7 +46,9 @@
 namespace SPH
 {
 
-static tbb::affinity_partitioner ap;
+/** A single partitioner shared by all translation units,
+ *  so that the particle loops and the first touch of particle data replay the same affinity. */
+inline tbb::affinity_partitioner ap;
 typedef tbb::blocked_range<size_t> IndexRange;
 typedef tbb::blocked_range2d<size_t> IndexRange2d;
 typedef tbb::blocked_range3d<size_t> IndexRange3d;
@@ -53,12 +59,267 @@ typedef tbb::tick_count::interval_t TimeInterval;
 template <typename T>
 using ConcurrentVec = tbb::concurrent_vector<T>;
 
+/**
+ * @class ParticleDataAllocator
+ * @brief Allocator taking large blocks from the particle data arena.
+ * Blocks smaller than a huge page are allocated cache aligned as usual.
+ * A large block is first touched with the partitioner ap over the particle range given by
+ * ParticleDataArena::FirstTouchScope, as particle_for loops the real particles,
+ * so that each page is located close to the thread which will later work on the particles starting in it.
+ * The rest of the block, e.g. buffer particles, or the whole block without a scope,
+ * is touched with a local partitioner.
+ */
+template <typename T>
+class ParticleDataAllocator
+{
+    static bool isLargeBlock(size_t n) { return n * sizeof(T) >= ParticleDataArena::huge_page_size_; };
+
+    template <typename PartitionerType>
+    static void firstTouch(T *ptr, const IndexRange &range, PartitionerType &partitioner)
+    {
+        const size_t page_size = ParticleDataArena::pageSize();
+        char *block = reinterpret_cast<char *>(ptr);
+        tbb::parallel_for(
+            range,
+            [&](const IndexRange &r)
+            {
+                size_t first_page = (r.begin() * sizeof(T) + page_size - 1) / page_size;
+                for (size_t page_start = first_page * page_size;
+                     page_start < r.end() * sizeof(T); page_start += page_size)
+                {
+                    block[page_start] = 0;
+                }
+            },
+            partitioner);
+    };
+
+  public:
+    using value_type = T;
+
+    ParticleDataAllocator() = default;
+    template <typename U>
+    ParticleDataAllocator(const ParticleDataAllocator<U> &){};
+
+    T *allocate(size_t n)
+    {
+        if (!isLargeBlock(n))
+        {
+            return tbb::cache_aligned_allocator<T>().allocate(n);
+        }
+
+        T *ptr = static_cast<T *>(ParticleDataArena::allocate(n * sizeof(T)));
+        size_t particle_size = ParticleDataArena::FirstTouchSize();
+        if (particle_size != 0 && particle_size <= n)
+        {
+            std::unique_lock<std::mutex> first_touch_lock = ParticleDataArena::tryLockFirstTouch();
+            if (first_touch_lock.owns_lock())
+            {
+                firstTouch(ptr, IndexRange(0, particle_size), ap);
+            }
+            else
+            {
+                tbb::affinity_partitioner local_ap;
+                firstTouch(ptr, IndexRange(0, particle_size), local_ap);
+            }
+        }
+        else
+        {
+            particle_size = 0;
+        }
+
+        if (particle_size != n)
+        {
+            tbb::auto_partitioner local_partitioner;
+            firstTouch(ptr, IndexRange(particle_size, n), local_partitioner);
+        }
+        return ptr;
+    };
+
+    void deallocate(T *ptr, size_t n)
+    {
+        isLargeBlock(n) ? ParticleDataArena::deallocate(ptr)
+                        : tbb::cache_aligned_allocator<T>().deallocate(ptr, n);
+    };
+};
+
+template <typename T, typename U>
+bool operator==(const ParticleDataAllocator<T> &, const ParticleDataAllocator<U> &) { return true; }
+template <typename T, typename U>
+bool operator!=(const ParticleDataAllocator<T> &, const ParticleDataAllocator<U> &) { return false; }
+
+#if SPHINXSYS_USE_PARTICLE_DATA_ARENA
+template <typename T>
+using StdLargeVec = std::vector<T, ParticleDataAllocator<T>>;
+#else
 template <typename T>
 using StdLargeVec = std::vector<T, tbb::cache_aligned_allocator<T>>;
+#endif
 
 template <typename T>
 using StdVec = std::vector<T>;
 
+/**
+ * @class StorageLargeVec
+ * @brief Large vector whose data is saved with the storage type of DataType.
+ * When the storage type differs from DataType, e.g. in mixed precision mode,
+ * the data is converted to DataType when accessed, so that the computations
+ * with the accessed data are still carried out with DataType.
+ * Note that the data can only be modified by setValue or push_back.
+ */
+template <typename DataType>
+class StorageLargeVec
+{
+    using StorageType = typename StorageDataType<DataType>::type;
+    static constexpr bool is_same_type_ = std::is_same_v<StorageType, DataType>;
+    using AccessType = std::conditional_t<is_same_type_, const DataType &, DataType>;
+    StdLargeVec<StorageType> data_;
+
+    static StorageType toStorage(const DataType &value)
+    {
+        if constexpr (is_same_type_ || std::is_arithmetic_v<DataType>)
+            return StorageType(value);
+        else
+            return value.template cast<StorageReal>();
+    };
+
+  public:
+    AccessType operator[](size_t index) const
+    {
+        if constexpr (is_same_type_ || std::is_arithmetic_v<DataType>)
+            return data_[index];
+        else
+            return data_[index].template cast<Real>();
+    };
+    void setValue(size_t index, const DataType &value) { data_[index] = toStorage(value); };
+    void push_back(const DataType &value) { data_.push_back(toStorage(value)); };
+    size_t size() const { return data_.size(); };
+    void resize(size_t new_size) { data_.resize(new_size); };
+    void clear() { data_.clear(); };
+};
+
+/**
+ * @struct SoAComponentTraits
+ * @brief Component-wise information of a data type saved in structure-of-arrays layout.
+ * Arithmetic data types have only one component and are accessed directly by reference.
+ */
+template <typename DataType, typename Enable = void>
+struct SoAComponentTraits
+{
+    using Scalar = DataType;
+    static constexpr int number_of_components = 1;
+    using Reference = DataType &;
+    using ConstReference = const DataType &;
+
+    static Reference reference(Scalar *address, size_t) { return *address; };
+    static ConstReference reference(const Scalar *address, size_t) { return *address; };
+    static Scalar componentValue(const DataType &value, int) { return value; };
+};
+
+/**
+ * Eigen vectors and matrices are accessed by maps striding over the component arrays.
+ * The components are ordered by the column-major linear index of the matrix.
+ */
+template <typename DataType>
+struct SoAComponentTraits<DataType, std::enable_if_t<std::is_base_of_v<Eigen::MatrixBase<DataType>, DataType>>>
+{
+    using Scalar = typename DataType::Scalar;
+    static constexpr int number_of_components = DataType::SizeAtCompileTime;
+    using ComponentStride = Eigen::Stride<Eigen::Dynamic, Eigen::Dynamic>;
+    using Reference = Eigen::Map<DataType, Eigen::Unaligned, ComponentStride>;
+    using ConstReference = Eigen::Map<const DataType, Eigen::Unaligned, ComponentStride>;
+
+    static Reference reference(Scalar *address, size_t size)
+    {
+        return Reference(address, ComponentStride(DataType::RowsAtCompileTime * size, size));
+    };
+    static ConstReference reference(const Scalar *address, size_t size)
+    {
+        return ConstReference(address, ComponentStride(DataType::RowsAtCompileTime * size, size));
+    };
+    static Scalar componentValue(const DataType &value, int k) { return value(k); };
+};
+
+/**
+ * Symmetric matrices are accessed by maps of their independent components.
+ */
+template <int DIMENSION>
+struct SoAComponentTraits<SymmetricMatrix<DIMENSION>>
+{
+    using DataType = SymmetricMatrix<DIMENSION>;
+    using Scalar = Real;
+    static constexpr int number_of_components = DataType::number_of_components;
+    using ComponentVector = typename DataType::ComponentVector;
+    using ComponentStride = Eigen::InnerStride<Eigen::Dynamic>;
+    using Reference = Eigen::Map<ComponentVector, Eigen::Unaligned, ComponentStride>;
+    using ConstReference = Eigen::Map<const ComponentVector, Eigen::Unaligned, ComponentStride>;
+
+    static Reference reference(Scalar *address, size_t size) { return Reference(address, ComponentStride(size)); };
+    static ConstReference reference(const Scalar *address, size_t size) { return ConstReference(address, ComponentStride(size)); };
+    static Scalar componentValue(const DataType &value, int k) { return value.components()[k]; };
+};
+
+/**
+ * @class SoALargeVec
+ * @brief Large vector saving the data in structure-of-arrays (SoA) layout.
+ * Each component of the data type is saved in a contiguous array,
+ * so that loops over particles can be vectorized component by component.
+ * The element access operator returns a proxy which behaves like a reference to DataType,
+ * i.e. an Eigen map for vectors and matrices or a plain reference for scalars.
+ * For symmetric matrices, the map is of the independent components.
+ * Note that resizing relocates all the components, so it should be done rarely, e.g. for buffer allocation.
+ */
+template <typename DataType>
+class SoALargeVec
+{
+    using Traits = SoAComponentTraits<DataType>;
+
+  public:
+    using Scalar = typename Traits::Scalar;
+    using Reference = typename Traits::Reference;
+    using ConstReference = typename Traits::ConstReference;
+    static constexpr int number_of_components_ = Traits::number_of_components;
+
+    size_t size() const { return size_; };
+    Scalar *component(int k) { return data_.data() + k * size_; };
+    const Scalar *component(int k) const { return data_.data() + k * size_; };
+    Reference operator[](size_t index) { return Traits::reference(data_.data() + index, size_); };
+    ConstReference operator[](size_t index) const { return Traits::reference(data_.data() + index, size_); };
+
+    void resize(size_t new_size, const DataType &value = ZeroData<DataType>::value)
+    {
+        StdLargeVec<Scalar> new_data(new_size * number_of_components_);
+        size_t copy_size = std::min(size_, new_size);
+        for (int k = 0; k != number_of_components_; ++k)
+        {
+            Scalar *new_component = new_data.data() + k * new_size;
+            std::copy(component(k), component(k) + copy_size, new_component);
+            std::fill(new_component + copy_size, new_component + new_size, Traits::componentValue(value, k));
+        }
+        data_.swap(new_data);
+        size_ = new_size;
+    };
+
+    void copyValue(size_t index, size_t another_index)
+    {
+        for (int k = 0; k != number_of_components_; ++k)
+        {
+            component(k)[index] = component(k)[another_index];
+        }
+    };
+
+    void swapValues(size_t index_a, size_t index_b)
+    {
+        for (int k = 0; k != number_of_components_; ++k)
+        {
+            std::swap(component(k)[index_a], component(k)[index_b]);
+        }
+    };
+
+  private:
+    size_t size_ = 0;
+    StdLargeVec<Scalar> data_;
+};
+
 template <typename T>
 using BiVector = std::vector<std::vector<T>>;
 
@@ -0,0 +1,147 @@
+#include "particle_data_arena.h"
+
+#include "tbb/scalable_allocator.h"
+
+#include <algorithm>
+#include <fstream>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+//=================================================================================================//
+namespace SPH
+{
+//=================================================================================================//
+ParticleDataArena::NumaPolicy ParticleDataArena::numa_policy_ = ParticleDataArena::NumaPolicy::FirstTouch;
+bool ParticleDataArena::use_huge_pages_ = true;
+std::mutex ParticleDataArena::first_touch_mutex_;
+thread_local size_t ParticleDataArena::first_touch_size_ = 0;
+//=================================================================================================//
+#ifdef __linux__
+namespace
+{
+/** memory policy modes and flags as defined in linux/mempolicy.h */
+constexpr int mpol_bind = 2;
+constexpr int mpol_interleave = 3;
+constexpr unsigned mpol_mf_move = 1 << 1;
+constexpr size_t bits_per_mask = 8 * sizeof(unsigned long);
+//=================================================================================================//
+std::vector<int> onlineNumaNodes()
+{
+    std::vector<int> nodes;
+    std::ifstream node_file("/sys/devices/system/node/online");
+    std::string range;
+    while (std::getline(node_file, range, ','))
+    {
+        std::stringstream range_stream(range);
+        int first = 0, last = 0;
+        char separator = '-';
+        range_stream >> first;
+        if (!(range_stream >> separator >> last))
+            last = first;
+        for (int node = first; node <= last; ++node)
+            nodes.push_back(node);
+    }
+    return nodes;
+}
+//=================================================================================================//
+long bindMemory(void *ptr, size_t bytes, int mode, const std::vector<int> &nodes)
+{
+    int max_node = 0;
+    for (int node : nodes)
+        max_node = std::max(max_node, node);
+    std::vector<unsigned long> node_mask(max_node / bits_per_mask + 1, 0);
+    for (int node : nodes)
+        node_mask[node / bits_per_mask] |= 1UL << (node % bits_per_mask);
+    return syscall(SYS_mbind, ptr, bytes, mode, node_mask.data(), max_node + 2, mpol_mf_move);
+}
+} // namespace
+#endif
+//=================================================================================================//
+void *ParticleDataArena::allocate(size_t bytes)
+{
+    size_t block_size = (bytes + huge_page_size_ - 1) / huge_page_size_ * huge_page_size_;
+    void *ptr = scalable_aligned_malloc(block_size, huge_page_size_);
+    if (ptr == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    placePages(ptr, block_size);
+    return ptr;
+}
+//=================================================================================================//
+void ParticleDataArena::deallocate(void *ptr)
+{
+    scalable_aligned_free(ptr);
+}
+//=================================================================================================//
+void ParticleDataArena::placePages(void *ptr, size_t bytes)
+{
+#ifdef __linux__
+    if (use_huge_pages_)
+    {
+        madvise(ptr, bytes, MADV_HUGEPAGE);
+    }
+
+    std::vector<int> nodes = onlineNumaNodes();
+    if (nodes.size() < 2)
+    {
+        return;
+    }
+
+    if (numa_policy_ == NumaPolicy::Interleave)
+    {
+        bindMemory(ptr, bytes, mpol_interleave, nodes);
+    }
+    else if (numa_policy_ == NumaPolicy::Partition)
+    {
+        size_t number_of_pages = bytes / huge_page_size_;
+        char *block = static_cast<char *>(ptr);
+        for (size_t k = 0; k != nodes.size(); ++k)
+        {
+            size_t first_page = number_of_pages * k / nodes.size();
+            size_t last_page = number_of_pages * (k + 1) / nodes.size();
+            if (last_page > first_page)
+            {
+                bindMemory(block + first_page * huge_page_size_,
+                           (last_page - first_page) * huge_page_size_, mpol_bind, {nodes[k]});
+            }
+        }
+    }
+#endif
+}
+//=================================================================================================//
+size_t ParticleDataArena::pageSize()
+{
+    static const size_t system_page_size = []()
+    {
+#ifdef __linux__
+        return size_t(sysconf(_SC_PAGESIZE));
+#else
+        return size_t(4096);
+#endif
+    }();
+    static const bool transparent_huge_pages = []()
+    {
+        std::ifstream thp_file("/sys/kernel/mm/transparent_hugepage/enabled");
+        std::string thp_modes;
+        std::getline(thp_file, thp_modes);
+        return thp_modes.find("[always]") != std::string::npos ||
+               thp_modes.find("[madvise]") != std::string::npos;
+    }();
+    return use_huge_pages_ && transparent_huge_pages ? huge_page_size_ : system_page_size;
+}
+//=================================================================================================//
+std::unique_lock<std::mutex> ParticleDataArena::tryLockFirstTouch()
+{
+    return std::unique_lock<std::mutex>(first_touch_mutex_, std::try_to_lock);
+}
+//=================================================================================================//
+} // namespace SPH
+//=================================================================================================//
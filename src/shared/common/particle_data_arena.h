@@ -0,0 +1,96 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	particle_data_arena.h
+ * @brief 	Huge-page and NUMA-aware allocation for large particle data.
+ * @author	Chi Zhang and Xiangyu Hu
+ */
+#ifndef PARTICLE_DATA_ARENA_H
+#define PARTICLE_DATA_ARENA_H
+
+#include <cstddef>
+#include <mutex>
+
+namespace SPH
+{
+/**
+ * @class ParticleDataArena
+ * @brief Memory source for large particle data.
+ * A block is aligned to and advised for transparent huge pages,
+ * and placed on the NUMA nodes according to the chosen policy.
+ * With the first-touch policy, the pages are located by ParticleDataAllocator,
+ * which touches them with the same partitioner and particle range as particle_for.
+ * The particle range is given by a FirstTouchScope around the allocation.
+ * The policy should be set before the particles are generated.
+ */
+class ParticleDataArena
+{
+  public:
+    enum class NumaPolicy
+    {
+        FirstTouch, /**< pages are located on the node of the thread first touching them */
+        Interleave, /**< pages are interleaved over all online nodes */
+        Partition   /**< contiguous parts of a block are bound to the online nodes one by one */
+    };
+    static constexpr size_t huge_page_size_ = 2 * 1024 * 1024;
+
+    /**
+     * @class FirstTouchScope
+     * @brief Gives the number of real particles, i.e. the range looped by particle_for,
+     * for first touching the particle data allocated by this thread within the scope.
+     */
+    class FirstTouchScope
+    {
+      public:
+        explicit FirstTouchScope(size_t number_of_particles) : previous_size_(first_touch_size_)
+        {
+            first_touch_size_ = number_of_particles;
+        };
+        ~FirstTouchScope() { first_touch_size_ = previous_size_; };
+
+      private:
+        size_t previous_size_;
+    };
+
+    static void setNumaPolicy(NumaPolicy numa_policy) { numa_policy_ = numa_policy; };
+    static NumaPolicy getNumaPolicy() { return numa_policy_; };
+    static void setHugePages(bool use_huge_pages) { use_huge_pages_ = use_huge_pages; };
+    /** huge page size when transparent huge pages are active, otherwise the system page size */
+    static size_t pageSize();
+    /** Return an unlocked lock if another first touch is in progress. */
+    static std::unique_lock<std::mutex> tryLockFirstTouch();
+    /** number of particles given by the enclosing first touch scope, zero without a scope */
+    static size_t FirstTouchSize() { return first_touch_size_; };
+    static void *allocate(size_t bytes);
+    static void deallocate(void *ptr);
+
+  private:
+    static NumaPolicy numa_policy_;
+    static bool use_huge_pages_;
+    static std::mutex first_touch_mutex_;
+    static thread_local size_t first_touch_size_;
+    static void placePages(void *ptr, size_t bytes);
+};
+
+} // namespace SPH
+#endif // PARTICLE_DATA_ARENA_H
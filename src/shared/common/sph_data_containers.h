@@ -54,11 +54,11 @@ using RealBodyVector = StdVec<RealBody *>;
 using BodyPartVector = StdVec<BodyPart *>;
 
 using IndexVector = StdVec<size_t>;
-using ConcurrentIndexVector = ConcurrentVec<size_t>;
+using ConcurrentIndexVector = ConcurrentVec<ParticleIndex>;
 using ParticlesBound = std::pair<size_t, size_t>;
 
 /** List data pair: first for indexes, second for particle position. */
-using ListData = std::pair<size_t, Vecd>;
+using ListData = std::pair<ParticleIndex, Vecd>;
 using ListDataVector = StdLargeVec<ListData>;
 using DataListsInCells = StdLargeVec<ListDataVector *>;
 using ConcurrentCellLists = ConcurrentVec<ConcurrentIndexVector *>;
@@ -69,6 +69,8 @@ using CellLists = std::pair<ConcurrentCellLists, DataListsInCells>;
 
 /** Generalized particle data type */
 typedef DataContainerAddressAssemble<StdLargeVec> ParticleData;
+/** Generalized particle data type in structure-of-arrays layout */
+typedef DataContainerAddressAssemble<SoALargeVec> SoAParticleData;
 /** Generalized particle variable type*/
 typedef DataContainerAddressAssemble<DiscreteVariable> ParticleVariables;
 /** Generalized particle variable type*/
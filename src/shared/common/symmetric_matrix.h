@@ -0,0 +1,181 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	symmetric_matrix.h
+ * @brief 	Compact symmetric matrix for symmetric tensors, e.g. stress and strain.
+ * @author	Chi Zhang and Xiangyu Hu
+ */
+#ifndef SYMMETRIC_MATRIX_H
+#define SYMMETRIC_MATRIX_H
+
+#include "base_data_type.h"
+
+namespace SPH
+{
+/**
+ * @class SymmetricMatrix
+ * @brief Symmetric matrix saving only its DIMENSION * (DIMENSION + 1) / 2 independent components.
+ * The components are saved in Voigt order, i.e. xx, yy, xy in 2D
+ * and xx, yy, zz, yz, xz, xy in 3D.
+ * The products involving the matrix are carried out by the components directly,
+ * while toMatrix() provides the full matrix for other operations.
+ */
+template <int DIMENSION>
+class SymmetricMatrix
+{
+  public:
+    static constexpr int number_of_components = DIMENSION * (DIMENSION + 1) / 2;
+    using Scalar = Real;
+    using VectorType = Eigen::Matrix<Real, DIMENSION, 1>;
+    using MatrixType = Eigen::Matrix<Real, DIMENSION, DIMENSION>;
+    using ComponentVector = Eigen::Matrix<Real, number_of_components, 1>;
+
+    SymmetricMatrix(){};
+    explicit SymmetricMatrix(const ComponentVector &components) : components_(components){};
+    /** constructed from the symmetric part of a full matrix */
+    explicit SymmetricMatrix(const MatrixType &matrix)
+    {
+        for (int i = 0; i != DIMENSION; ++i)
+            for (int j = i; j != DIMENSION; ++j)
+                (*this)(i, j) = 0.5 * (matrix(i, j) + matrix(j, i));
+    };
+
+    static SymmetricMatrix Zero() { return SymmetricMatrix(ComponentVector(ComponentVector::Zero())); };
+    static SymmetricMatrix Identity()
+    {
+        ComponentVector components = ComponentVector::Zero();
+        components.template head<DIMENSION>().setOnes();
+        return SymmetricMatrix(components);
+    };
+    static constexpr int ComponentIndex(int i, int j)
+    {
+        return i == j ? i : number_of_components - i - j;
+    };
+
+    Real operator()(int i, int j) const { return components_[ComponentIndex(i, j)]; };
+    Real &operator()(int i, int j) { return components_[ComponentIndex(i, j)]; };
+    const ComponentVector &components() const { return components_; };
+    ComponentVector &components() { return components_; };
+
+    MatrixType toMatrix() const
+    {
+        MatrixType matrix;
+        for (int i = 0; i != DIMENSION; ++i)
+            for (int j = 0; j != DIMENSION; ++j)
+                matrix(i, j) = (*this)(i, j);
+        return matrix;
+    };
+
+    Real trace() const { return components_.template head<DIMENSION>().sum(); };
+    SymmetricMatrix deviatoric() const
+    {
+        SymmetricMatrix deviatoric_part(*this);
+        deviatoric_part.components_.template head<DIMENSION>().array() -= trace() / Real(DIMENSION);
+        return deviatoric_part;
+    };
+    /** double contraction, i.e. sum of the products of all corresponding matrix entries */
+    Real doubleContraction(const SymmetricMatrix &other) const
+    {
+        return components_.template head<DIMENSION>().dot(other.components_.template head<DIMENSION>()) +
+               2.0 * components_.template tail<number_of_components - DIMENSION>().dot(
+                         other.components_.template tail<number_of_components - DIMENSION>());
+    };
+    Real squaredNorm() const { return doubleContraction(*this); };
+    Real norm() const { return sqrt(squaredNorm()); };
+
+    VectorType operator*(const VectorType &vector) const
+    {
+        VectorType product = VectorType::Zero();
+        for (int i = 0; i != DIMENSION; ++i)
+            for (int j = 0; j != DIMENSION; ++j)
+                product[i] += (*this)(i, j) * vector[j];
+        return product;
+    };
+    MatrixType operator*(const MatrixType &matrix) const
+    {
+        MatrixType product;
+        for (int j = 0; j != DIMENSION; ++j)
+            product.col(j) = (*this) * VectorType(matrix.col(j));
+        return product;
+    };
+    /** congruence transformation Q * this * Q^T, e.g. for rotating the tensor */
+    SymmetricMatrix congruence(const MatrixType &q) const
+    {
+        MatrixType q_this = ((*this) * MatrixType(q.transpose())).transpose();
+        SymmetricMatrix transformed;
+        for (int i = 0; i != DIMENSION; ++i)
+            for (int j = i; j != DIMENSION; ++j)
+                transformed(i, j) = q_this.row(i).dot(q.row(j));
+        return transformed;
+    };
+
+    SymmetricMatrix &operator+=(const SymmetricMatrix &other)
+    {
+        components_ += other.components_;
+        return *this;
+    };
+    SymmetricMatrix &operator-=(const SymmetricMatrix &other)
+    {
+        components_ -= other.components_;
+        return *this;
+    };
+    SymmetricMatrix &operator*=(Real scalar)
+    {
+        components_ *= scalar;
+        return *this;
+    };
+    SymmetricMatrix &operator/=(Real scalar)
+    {
+        components_ /= scalar;
+        return *this;
+    };
+    SymmetricMatrix operator+(const SymmetricMatrix &other) const { return SymmetricMatrix(ComponentVector(components_ + other.components_)); };
+    SymmetricMatrix operator-(const SymmetricMatrix &other) const { return SymmetricMatrix(ComponentVector(components_ - other.components_)); };
+    SymmetricMatrix operator-() const { return SymmetricMatrix(ComponentVector(-components_)); };
+    SymmetricMatrix operator*(Real scalar) const { return SymmetricMatrix(ComponentVector(components_ * scalar)); };
+    SymmetricMatrix operator/(Real scalar) const { return SymmetricMatrix(ComponentVector(components_ / scalar)); };
+    friend SymmetricMatrix operator*(Real scalar, const SymmetricMatrix &matrix) { return matrix * scalar; };
+    bool operator==(const SymmetricMatrix &other) const { return components_ == other.components_; };
+    bool operator!=(const SymmetricMatrix &other) const { return components_ != other.components_; };
+    friend std::ostream &operator<<(std::ostream &out, const SymmetricMatrix &matrix) { return out << matrix.toMatrix(); };
+
+  private:
+    ComponentVector components_;
+};
+
+/** Symmetric 2*2 and 3*3 matrix with float point number. */
+using SymMat2d = SymmetricMatrix<2>;
+using SymMat3d = SymmetricMatrix<3>;
+
+template <>
+struct DataTypeIndex<SymMat2d>
+{
+    static constexpr int value = 6;
+};
+template <>
+struct DataTypeIndex<SymMat3d>
+{
+    static constexpr int value = 7;
+};
+} // namespace SPH
+#endif // SYMMETRIC_MATRIX_H
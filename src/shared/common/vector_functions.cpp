@@ -322,6 +322,20 @@ Real getVonMisesStressFromMatrix(const Mat3d &sigma)
                 3.0 * (sigmaxy * sigmaxy + sigmaxz * sigmaxz + sigmayz * sigmayz));
 }
 //=================================================================================================//
+Real getVonMisesStressFromMatrix(const SymMat2d &sigma)
+{
+    Real sigmaxx = sigma(0, 0);
+    Real sigmayy = sigma(1, 1);
+    Real sigmaxy = sigma(0, 1);
+
+    return sqrt(sigmaxx * sigmaxx + sigmayy * sigmayy - sigmaxx * sigmayy + 3.0 * sigmaxy * sigmaxy);
+}
+//=================================================================================================//
+Real getVonMisesStressFromMatrix(const SymMat3d &sigma)
+{
+    return sqrt(1.5 * sigma.deviatoric().squaredNorm());
+}
+//=================================================================================================//
 Vec2d getPrincipalValuesFromMatrix(const Mat2d &A)
 {
     Eigen::EigenSolver<EigMat> ces(A, /* computeEigenvectors = */ false);
@@ -72,6 +72,8 @@ Vec3d getVectorProjectionOfVector(const Vec3d &vector_1, const Vec3d &vector_2);
 /** von Mises stress from stress matrix */
 Real getVonMisesStressFromMatrix(const Mat2d &sigma);
 Real getVonMisesStressFromMatrix(const Mat3d &sigma);
+Real getVonMisesStressFromMatrix(const SymMat2d &sigma);
+Real getVonMisesStressFromMatrix(const SymMat3d &sigma);
 
 /** principal strain or stress from strain or stress matrix */
 Vec2d getPrincipalValuesFromMatrix(const Mat2d &A);
@@ -0,0 +1,219 @@
+#include "vtk_appended_data.h"
+
+#include "tbb/blocked_range.h"
+#include "tbb/parallel_for.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <utility>
+
+#if SPHINXSYS_USE_ZLIB
+#include <zlib.h>
+#endif
+
+namespace SPH
+{
+//=================================================================================================//
+namespace
+{
+std::string encodeBase64(const char *data, size_t bytes)
+{
+    static const char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    std::string encoded;
+    encoded.reserve(4 * ((bytes + 2) / 3));
+    const unsigned char *input = reinterpret_cast<const unsigned char *>(data);
+    size_t i = 0;
+    for (; i + 2 < bytes; i += 3)
+    {
+        uint32_t triple = (uint32_t(input[i]) << 16) | (uint32_t(input[i + 1]) << 8) | uint32_t(input[i + 2]);
+        encoded.push_back(alphabet[(triple >> 18) & 0x3F]);
+        encoded.push_back(alphabet[(triple >> 12) & 0x3F]);
+        encoded.push_back(alphabet[(triple >> 6) & 0x3F]);
+        encoded.push_back(alphabet[triple & 0x3F]);
+    }
+    if (i < bytes)
+    {
+        uint32_t triple = uint32_t(input[i]) << 16;
+        if (i + 1 < bytes)
+            triple |= uint32_t(input[i + 1]) << 8;
+        encoded.push_back(alphabet[(triple >> 18) & 0x3F]);
+        encoded.push_back(alphabet[(triple >> 12) & 0x3F]);
+        encoded.push_back(i + 1 < bytes ? alphabet[(triple >> 6) & 0x3F] : '=');
+        encoded.push_back('=');
+    }
+    return encoded;
+}
+} // namespace
+//=================================================================================================//
+VtkAppendedData::VtkAppendedData(Encoding encoding, bool zlib_compression)
+    : encoding_(encoding), zlib_compression_(zlib_compression)
+{
+#if !SPHINXSYS_USE_ZLIB
+    if (zlib_compression_)
+    {
+        std::cout << "\n ERROR: zlib compression requires building with SPHINXSYS_USE_ZLIB!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+#endif
+}
+//=================================================================================================//
+void VtkAppendedData::encodeDataArrays()
+{
+    if (zlib_compression_)
+    {
+        compressDataArrays();
+    }
+
+    size_t offset = 0;
+    for (size_t k = 0; k != number_of_arrays_; ++k)
+    {
+        DataArray &data_array = data_arrays_[k];
+        data_array.offset_ = offset;
+        if (!zlib_compression_)
+        {
+            data_array.header_.assign(1, data_array.block_.size());
+            offset += encodedSize(sizeof(HeaderType) + data_array.block_.size());
+        }
+        else
+        {
+            size_t compressed_size = 0;
+            for (const std::vector<char> &compressed_block : data_array.compressed_blocks_)
+            {
+                compressed_size += compressed_block.size();
+            }
+            offset += encodedSize(data_array.header_.size() * sizeof(HeaderType)) + encodedSize(compressed_size);
+        }
+    }
+}
+//=================================================================================================//
+void VtkAppendedData::compressDataArrays()
+{
+#if SPHINXSYS_USE_ZLIB
+    std::vector<std::pair<size_t, size_t>> sub_blocks;
+    for (size_t k = 0; k != number_of_arrays_; ++k)
+    {
+        DataArray &data_array = data_arrays_[k];
+        size_t bytes = data_array.block_.size();
+        size_t number_of_sub_blocks = (bytes + compression_block_size_ - 1) / compression_block_size_;
+        data_array.header_.assign(3 + number_of_sub_blocks, 0);
+        data_array.header_[0] = number_of_sub_blocks;
+        data_array.header_[1] = compression_block_size_;
+        data_array.header_[2] = bytes % compression_block_size_;
+        data_array.compressed_blocks_.resize(number_of_sub_blocks);
+        for (size_t l = 0; l != number_of_sub_blocks; ++l)
+        {
+            sub_blocks.emplace_back(k, l);
+        }
+    }
+
+    std::atomic<bool> is_compressed(true);
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0, sub_blocks.size(), 1),
+        [&](const tbb::blocked_range<size_t> &r)
+        {
+            for (size_t n = r.begin(); n != r.end(); ++n)
+            {
+                DataArray &data_array = data_arrays_[sub_blocks[n].first];
+                size_t l = sub_blocks[n].second;
+                size_t begin = l * compression_block_size_;
+                size_t bytes = std::min(compression_block_size_, data_array.block_.size() - begin);
+                std::vector<char> &compressed_block = data_array.compressed_blocks_[l];
+                uLongf compressed_size = compressBound(bytes);
+                compressed_block.resize(compressed_size);
+                if (compress2(reinterpret_cast<Bytef *>(compressed_block.data()), &compressed_size,
+                              reinterpret_cast<const Bytef *>(data_array.block_.data() + begin), bytes,
+                              Z_DEFAULT_COMPRESSION) != Z_OK)
+                {
+                    is_compressed = false;
+                }
+                compressed_block.resize(compressed_size);
+                data_array.header_[3 + l] = compressed_size;
+            }
+        });
+
+    if (!is_compressed)
+    {
+        std::cout << "\n ERROR: zlib failed to compress the VTK data arrays!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+#endif
+}
+//=================================================================================================//
+void VtkAppendedData::writeFileAttributes(std::ostream &output_stream) const
+{
+    output_stream << " header_type=\"UInt64\"";
+    if (zlib_compression_)
+    {
+        output_stream << " compressor=\"vtkZLibDataCompressor\"";
+    }
+}
+//=================================================================================================//
+void VtkAppendedData::writeDataArray(std::ostream &output_stream, size_t index) const
+{
+    const DataArray &data_array = data_arrays_[index];
+    output_stream << "    <DataArray Name=\"" << data_array.name_ << "\" type=\"" << data_array.type_
+                  << "\" NumberOfComponents=\"" << data_array.number_of_components_
+                  << "\" format=\"appended\" offset=\"" << data_array.offset_ << "\"/>\n";
+}
+//=================================================================================================//
+void VtkAppendedData::writePDataArray(std::ostream &output_stream, size_t index) const
+{
+    const DataArray &data_array = data_arrays_[index];
+    output_stream << "    <PDataArray Name=\"" << data_array.name_ << "\" type=\"" << data_array.type_
+                  << "\" NumberOfComponents=\"" << data_array.number_of_components_ << "\"/>\n";
+}
+//=================================================================================================//
+void VtkAppendedData::writeAppendedData(std::ostream &output_stream) const
+{
+    output_stream << " <AppendedData encoding=\"" << (encoding_ == Encoding::Raw ? "raw" : "base64") << "\">\n";
+    output_stream << "  _";
+    for (size_t k = 0; k != number_of_arrays_; ++k)
+    {
+        const DataArray &data_array = data_arrays_[k];
+        const char *header = reinterpret_cast<const char *>(data_array.header_.data());
+        size_t header_bytes = data_array.header_.size() * sizeof(HeaderType);
+        if (encoding_ == Encoding::Raw)
+        {
+            output_stream.write(header, header_bytes);
+            if (!zlib_compression_)
+            {
+                output_stream.write(data_array.block_.data(), data_array.block_.size());
+            }
+            else
+            {
+                for (const std::vector<char> &compressed_block : data_array.compressed_blocks_)
+                {
+                    output_stream.write(compressed_block.data(), compressed_block.size());
+                }
+            }
+        }
+        else if (!zlib_compression_)
+        {
+            // uncompressed data is decoded as a single stream of the header followed by the data
+            std::vector<char> header_and_data(header, header + header_bytes);
+            header_and_data.insert(header_and_data.end(), data_array.block_.begin(), data_array.block_.end());
+            std::string encoded = encodeBase64(header_and_data.data(), header_and_data.size());
+            output_stream.write(encoded.data(), encoded.size());
+        }
+        else
+        {
+            // compressed data is decoded with the header and the compressed blocks encoded separately
+            std::string encoded = encodeBase64(header, header_bytes);
+            output_stream.write(encoded.data(), encoded.size());
+            std::vector<char> compressed_data;
+            for (const std::vector<char> &compressed_block : data_array.compressed_blocks_)
+            {
+                compressed_data.insert(compressed_data.end(), compressed_block.begin(), compressed_block.end());
+            }
+            encoded = encodeBase64(compressed_data.data(), compressed_data.size());
+            output_stream.write(encoded.data(), encoded.size());
+        }
+    }
+    output_stream << "\n </AppendedData>\n";
+}
+//=================================================================================================//
+} // namespace SPH
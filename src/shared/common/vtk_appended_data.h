@@ -0,0 +1,125 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	vtk_appended_data.h
+ * @brief 	Binary data arrays for VTK XML files in appended format.
+ * @author	Chi Zhang and Xiangyu Hu
+ */
+#ifndef VTK_APPENDED_DATA_H
+#define VTK_APPENDED_DATA_H
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace SPH
+{
+/**
+ * @class VtkAppendedData
+ * @brief Data arrays of a VTK XML file saved in the appended data section.
+ * Each array is first filled into a contiguous block and described by a DataArray element
+ * referring to its offset in the appended section. The block is written in raw binary
+ * or encoded in base64, each with a leading UInt64 header of the block size.
+ * With zlib compression, the block is split into sub-blocks compressed in parallel
+ * and the header lists the number and sizes of the sub-blocks as vtkZLibDataCompressor does.
+ * The attributes declaring the header type and compressor are written by writeFileAttributes.
+ * After clear(), the blocks are reused by the arrays added later,
+ * so that a staging buffer does not reallocate memory for each output.
+ */
+class VtkAppendedData
+{
+  public:
+    enum class Encoding
+    {
+        Raw,
+        Base64
+    };
+    using HeaderType = uint64_t;
+    static constexpr size_t compression_block_size_ = 256 * 1024;
+
+    explicit VtkAppendedData(Encoding encoding = Encoding::Raw, bool zlib_compression = false);
+    size_t size() const { return number_of_arrays_; };
+    size_t NumberOfTuples(size_t index) const { return data_arrays_[index].number_of_tuples_; };
+    void clear() { number_of_arrays_ = 0; };
+    /** add an array of given number of tuples and components, and return the address to be filled */
+    template <typename DataType>
+    DataType *addDataArray(const std::string &name, size_t number_of_tuples, int number_of_components = 1)
+    {
+        static_assert(std::is_arithmetic_v<DataType>, "Only arithmetic data can be written to VTK data arrays.");
+        if (number_of_arrays_ == data_arrays_.size())
+            data_arrays_.emplace_back();
+        DataArray &data_array = data_arrays_[number_of_arrays_++];
+        data_array.name_ = name;
+        data_array.type_ = VtkTypeName<DataType>();
+        data_array.number_of_tuples_ = number_of_tuples;
+        data_array.number_of_components_ = number_of_components;
+        data_array.block_.resize(number_of_tuples * number_of_components * sizeof(DataType));
+        return reinterpret_cast<DataType *>(data_array.block_.data());
+    };
+    /** compress the arrays if required and compute their offsets, to be called after all arrays are filled */
+    void encodeDataArrays();
+    /** write the attributes of the VTKFile element */
+    void writeFileAttributes(std::ostream &output_stream) const;
+    /** write the DataArray element of the array with given index */
+    void writeDataArray(std::ostream &output_stream, size_t index) const;
+    /** write the PDataArray element of the array with given index for a parallel file index */
+    void writePDataArray(std::ostream &output_stream, size_t index) const;
+    /** write the appended data section with all arrays */
+    void writeAppendedData(std::ostream &output_stream) const;
+
+  protected:
+    struct DataArray
+    {
+        std::string name_;
+        std::string type_;
+        size_t number_of_tuples_;
+        int number_of_components_;
+        size_t offset_;
+        std::vector<char> block_;
+        std::vector<HeaderType> header_;
+        std::vector<std::vector<char>> compressed_blocks_;
+    };
+    Encoding encoding_;
+    bool zlib_compression_;
+    size_t number_of_arrays_ = 0;
+    std::vector<DataArray> data_arrays_;
+
+    size_t encodedSize(size_t bytes) const { return encoding_ == Encoding::Raw ? bytes : 4 * ((bytes + 2) / 3); };
+    void compressDataArrays();
+
+    template <typename DataType>
+    static std::string VtkTypeName()
+    {
+        constexpr size_t bits = 8 * sizeof(DataType);
+        if constexpr (std::is_floating_point_v<DataType>)
+            return "Float" + std::to_string(bits);
+        else if constexpr (std::is_signed_v<DataType>)
+            return "Int" + std::to_string(bits);
+        else
+            return "UInt" + std::to_string(bits);
+    };
+};
+} // namespace SPH
+#endif // VTK_APPENDED_DATA_H
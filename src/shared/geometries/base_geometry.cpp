@@ -3,6 +3,17 @@
 namespace SPH
 {
 //=================================================================================================//
+uint64_t hashBytes(const void *data, size_t size, uint64_t hash)
+{
+    const unsigned char *bytes = static_cast<const unsigned char *>(data);
+    for (size_t i = 0; i != size; ++i)
+    {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+//=================================================================================================//
 BoundingBox Shape::getBounds()
 {
     if (!is_bounds_found_)
@@ -127,6 +138,20 @@ Vecd BinaryShapes::findClosestPoint(const Vecd &probe_point)
     return pnt_closest;
 }
 //=================================================================================================//
+uint64_t BinaryShapes::getSourceHash()
+{
+    uint64_t hash = hashBytes(nullptr, 0);
+    for (auto &sub_shape_and_op : sub_shapes_and_ops_)
+    {
+        uint64_t sub_shape_hash = sub_shape_and_op.first->getSourceHash();
+        if (sub_shape_hash == 0)
+            return 0;
+        hash = hashData(sub_shape_hash, hash);
+        hash = hashData(sub_shape_and_op.second, hash);
+    }
+    return hash;
+}
+//=================================================================================================//
 SubShapeAndOp *BinaryShapes::getSubShapeAndOpByName(const std::string &name)
 {
     for (auto &sub_shape_and_op : sub_shapes_and_ops_)
@@ -52,6 +52,14 @@ enum class ShapeBooleanOps
     intersect
 };
 
+/** FNV-1a hash of the data bytes, which does not change between runs or platforms. */
+uint64_t hashBytes(const void *data, size_t size, uint64_t hash = 14695981039346656037ULL);
+template <typename DataType>
+uint64_t hashData(const DataType &data, uint64_t hash)
+{
+    return hashBytes(&data, sizeof(DataType), hash);
+};
+
 /**
  * @class Shape
  * @brief Base class for all volumetric geometries
@@ -74,6 +82,9 @@ class Shape
     virtual bool isValid() { return true; };
     virtual bool checkContain(const Vecd &pnt, bool BOUNDARY_INCLUDED = true) = 0;
     virtual Vecd findClosestPoint(const Vecd &probe_point) = 0;
+    /** Hash of the data defining the geometry, e.g. to identify a cached level set.
+     * Zero is returned when the geometry can not be identified. */
+    virtual uint64_t getSourceHash() { return 0; };
 
     bool checkNotFar(const Vecd &probe_point, Real threshold);
     bool checkNearSurface(const Vecd &probe_point, Real threshold);
@@ -124,6 +135,7 @@ class BinaryShapes : public Shape
     virtual bool isValid() override;
     virtual bool checkContain(const Vecd &pnt, bool BOUNDARY_INCLUDED = true) override;
     virtual Vecd findClosestPoint(const Vecd &probe_point) override;
+    virtual uint64_t getSourceHash() override;
     Shape *getSubShapeByName(const std::string &name);
     SubShapeAndOp *getSubShapeAndOpByName(const std::string &name);
     size_t getSubShapeIndexByName(const std::string &name);
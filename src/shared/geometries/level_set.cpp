@@ -2,10 +2,26 @@
 
 #include "adaptation.h"
 #include "base_kernel.h"
+#include "mesh_iterators.hpp"
+
+#include <cstring>
+#include <thread>
 
 namespace SPH
 {
 //=================================================================================================//
+namespace
+{
+bool readBinaryValue(const char *&data, const char *data_end, void *value, size_t size)
+{
+    if (size_t(data_end - data) < size)
+        return false;
+    std::memcpy(value, data, size);
+    data += size;
+    return true;
+}
+} // namespace
+//=================================================================================================//
 BaseLevelSet ::BaseLevelSet(Shape &shape, SPHAdaptation &sph_adaptation)
     : BaseMeshField("LevelSet_" + shape.getName()), shape_(shape), sph_adaptation_(sph_adaptation)
 {
@@ -39,7 +55,8 @@ LevelSet::LevelSet(BoundingBox tentative_bounds, Real data_spacing, size_t buffe
       phi_gradient_(*registerMeshVariable<Vecd>("LevelsetGradient")),
       kernel_weight_(*registerMeshVariable<Real>("KernelWeight")),
       kernel_gradient_(*registerMeshVariable<Vecd>("KernelGradient")),
-      kernel_(*sph_adaptation.getKernel())
+      kernel_(*sph_adaptation.getKernel()),
+      is_narrow_band_(sph_adaptation.isNarrowBandLevelSet())
 {
     Real far_field_distance = grid_spacing_ * (Real)buffer_width_;
     initializeASingularDataPackage(
@@ -65,14 +82,96 @@ void LevelSet::updateKernelIntegrals()
 {
     package_parallel_for(inner_data_pkgs_,
                          [&](LevelSetDataPackage *data_pkg)
-                         {
-                             data_pkg->assignByPosition(
-                                 kernel_weight_, [&](const Vecd &position) -> Real
-                                 { return computeKernelIntegral(position); });
-                             data_pkg->assignByPosition(
-                                 kernel_gradient_, [&](const Vecd &position) -> Vecd
-                                 { return computeKernelGradientIntegral(position); });
-                         });
+                         { updateKernelIntegralsForAPackage(data_pkg); });
+}
+//=================================================================================================//
+void LevelSet::resetKernelIntegrals()
+{
+    kernel_integral_states_ = StdVec<std::atomic<int>>(NumberOfDataPackages());
+}
+//=================================================================================================//
+void LevelSet::updateKernelIntegralsForAPackage(LevelSetDataPackage *data_pkg)
+{
+    std::atomic<int> &state = kernel_integral_states_[data_pkg->PackageId()];
+    if (state.load(std::memory_order_acquire) == 2)
+        return;
+
+    int not_computed = 0;
+    if (state.compare_exchange_strong(not_computed, 1, std::memory_order_acq_rel))
+    {
+        data_pkg->assignByPosition(
+            kernel_weight_, [&](const Vecd &position) -> Real
+            { return computeKernelIntegral(position); });
+        data_pkg->assignByPosition(
+            kernel_gradient_, [&](const Vecd &position) -> Vecd
+            { return computeKernelGradientIntegral(position); });
+        state.store(2, std::memory_order_release);
+        return;
+    }
+
+    // being computed by another thread
+    while (state.load(std::memory_order_acquire) != 2)
+        std::this_thread::yield();
+}
+//=================================================================================================//
+template <typename FunctionOnPackage>
+void LevelSet::for_each_probed_package(const Vecd &position, const FunctionOnPackage &function)
+{
+    Arrayi cell_index = CellIndexFromPosition(position);
+    LevelSetDataPackage *data_pkg = DataPackageFromCellIndex(cell_index);
+    if (!data_pkg->isInnerPackage())
+        return;
+
+    // the interpolation uses the data at the grid index and the next, which may be in the neighbor packages
+    Arrayi grid_index = data_pkg->CellIndexFromPosition(position);
+    Arrayi lower_shift = Arrayi::Zero();
+    Arrayi upper_shift = Arrayi::Zero();
+    for (int n = 0; n != Dimensions; ++n)
+    {
+        lower_shift[n] = CellShiftAndDataIndex(grid_index[n]).first;
+        upper_shift[n] = CellShiftAndDataIndex(grid_index[n] + 1).first + 1;
+    }
+    mesh_for_each(lower_shift, upper_shift,
+                  [&](auto... shift)
+                  {
+                      LevelSetDataPackage *neighbor_data_pkg = DataPackageFromCellIndex(cell_index + Arrayi(shift...));
+                      if (neighbor_data_pkg->isInnerPackage())
+                          function(neighbor_data_pkg);
+                  });
+}
+//=================================================================================================//
+void LevelSet::prefetchKernelIntegrals(const StdLargeVec<Vecd> &positions, size_t total_positions)
+{
+    // the packages are claimed first, so that each is computed by one thread without waiting
+    ConcurrentVec<LevelSetDataPackage *> claimed_data_pkgs;
+    parallel_for(
+        IndexRange(0, total_positions),
+        [&](const IndexRange &r)
+        {
+            for (size_t i = r.begin(); i != r.end(); ++i)
+            {
+                for_each_probed_package(
+                    positions[i], [&](LevelSetDataPackage *data_pkg)
+                    {
+                        int not_computed = 0;
+                        if (kernel_integral_states_[data_pkg->PackageId()].compare_exchange_strong(not_computed, 1))
+                            claimed_data_pkgs.push_back(data_pkg); });
+            }
+        },
+        ap);
+
+    package_parallel_for(
+        claimed_data_pkgs,
+        [&](LevelSetDataPackage *data_pkg)
+        {
+            data_pkg->assignByPosition(
+                kernel_weight_, [&](const Vecd &position) -> Real
+                { return computeKernelIntegral(position); });
+            data_pkg->assignByPosition(
+                kernel_gradient_, [&](const Vecd &position) -> Vecd
+                { return computeKernelGradientIntegral(position); });
+            kernel_integral_states_[data_pkg->PackageId()].store(2, std::memory_order_release);
+        });
 }
 //=================================================================================================//
 Vecd LevelSet::probeNormalDirection(const Vecd &position)
@@ -102,11 +201,15 @@ Real LevelSet::probeSignedDistance(const Vecd &position)
 //=================================================================================================//
 Real LevelSet::probeKernelIntegral(const Vecd &position, Real h_ratio)
 {
+    for_each_probed_package(position, [&](LevelSetDataPackage *data_pkg)
+                            { updateKernelIntegralsForAPackage(data_pkg); });
     return probeMesh(kernel_weight_, position);
 }
 //=================================================================================================//
 Vecd LevelSet::probeKernelGradientIntegral(const Vecd &position, Real h_ratio)
 {
+    for_each_probed_package(position, [&](LevelSetDataPackage *data_pkg)
+                            { updateKernelIntegralsForAPackage(data_pkg); });
     return probeMesh(kernel_gradient_, position);
 }
 //=================================================================================================//
@@ -127,9 +230,12 @@ void LevelSet::cleanInterface(Real small_shift_factor)
 {
     markNearInterface(small_shift_factor);
     redistanceInterface();
-    reinitializeLevelSet();
+    if (is_narrow_band_)
+        redistanceByFastSweeping(false);
+    else
+        reinitializeLevelSet();
     updateLevelSetGradient();
-    updateKernelIntegrals();
+    resetKernelIntegrals();
 }
 //=============================================================================================//
 void LevelSet::correctTopology(Real small_shift_factor)
@@ -138,7 +244,7 @@ void LevelSet::correctTopology(Real small_shift_factor)
     for (size_t i = 0; i != 10; ++i)
         diffuseLevelSetSign();
     updateLevelSetGradient();
-    updateKernelIntegrals();
+    resetKernelIntegrals();
 }
 //=================================================================================================//
 bool LevelSet::probeIsWithinMeshBound(const Vecd &position)
@@ -155,23 +261,35 @@ bool LevelSet::probeIsWithinMeshBound(const Vecd &position)
     return is_bounded;
 }
 //=================================================================================================//
-void LevelSet::initializeDataInACell(const Arrayi &cell_index)
+Real LevelSet::findSurfaceMeasure(const Vecd &cell_position)
 {
-    Vecd cell_position = CellPositionFromIndex(cell_index);
+    if (is_narrow_band_) // the same measure but with a single closest-point query
+        return (shape_.findClosestPoint(cell_position) - cell_position).cwiseAbs().maxCoeff();
+
     Real signed_distance = shape_.findSignedDistance(cell_position);
     Vecd normal_direction = shape_.findNormalDirection(cell_position);
-    Real measure = (signed_distance * normal_direction).cwiseAbs().maxCoeff();
-    if (measure < grid_spacing_)
+    return (signed_distance * normal_direction).cwiseAbs().maxCoeff();
+}
+//=================================================================================================//
+void LevelSet::createCorePackage(const Arrayi &cell_index)
+{
+    LevelSetDataPackage *new_data_pkg =
+        createDataPackage(
+            all_mesh_variables_, cell_index,
+            [&](LevelSetDataPackage *new_data_pkg)
+            {
+                initializeBasicDataForAPackage(new_data_pkg, shape_);
+            });
+    new_data_pkg->setCorePackage();
+    core_data_pkgs_.push_back(new_data_pkg);
+}
+//=================================================================================================//
+void LevelSet::initializeDataInACell(const Arrayi &cell_index)
+{
+    Vecd cell_position = CellPositionFromIndex(cell_index);
+    if (findSurfaceMeasure(cell_position) < grid_spacing_)
     {
-        LevelSetDataPackage *new_data_pkg =
-            createDataPackage(
-                all_mesh_variables_, cell_index,
-                [&](LevelSetDataPackage *new_data_pkg)
-                {
-                    initializeBasicDataForAPackage(new_data_pkg, shape_);
-                });
-        new_data_pkg->setCorePackage();
-        core_data_pkgs_.push_back(new_data_pkg);
+        createCorePackage(cell_index);
     }
     else
     {
@@ -194,11 +312,18 @@ void LevelSet::tagACellIsInnerPackage(const Arrayi &cell_index)
         }
         else
         {
+            // with narrow band, the level set is only signed here and found by fast sweeping later
+            Real far_field_distance = current_data_pkg == singular_data_pkgs_addrs_[0]
+                                          ? -grid_spacing_ * (Real)buffer_width_
+                                          : grid_spacing_ * (Real)buffer_width_;
             LevelSetDataPackage *new_data_pkg = createDataPackage(
                 all_mesh_variables_, cell_index,
                 [&](LevelSetDataPackage *new_data_pkg)
                 {
-                    initializeBasicDataForAPackage(new_data_pkg, shape_);
+                    if (is_narrow_band_)
+                        initializeDataForSingularPackage(new_data_pkg, far_field_distance);
+                    else
+                        initializeBasicDataForAPackage(new_data_pkg, shape_);
                 });
             new_data_pkg->setInnerPackage();
             inner_data_pkgs_.push_back(new_data_pkg);
@@ -206,6 +331,217 @@ void LevelSet::tagACellIsInnerPackage(const Arrayi &cell_index)
     }
 }
 //=============================================================================================//
+void LevelSet::initializeNarrowBandData()
+{
+    /** 2 for core cells, -1 or 1 for the sign of the other cells, and 0 if not found yet. */
+    size_t number_of_cells = all_cells_.prod();
+    StdVec<std::atomic<int>> cell_labels(number_of_cells);
+    parallel_for(
+        IndexRange(0, number_of_cells),
+        [&](const IndexRange &r)
+        {
+            for (size_t l = r.begin(); l != r.end(); ++l)
+            {
+                Arrayi cell_index = transfer1DtoMeshIndex(all_cells_, l);
+                bool is_core = findSurfaceMeasure(CellPositionFromIndex(cell_index)) < grid_spacing_;
+                if (is_core)
+                    createCorePackage(cell_index);
+                cell_labels[l] = is_core ? 2 : 0;
+            }
+        });
+
+    /** Adjacent non-core cells are on the same side of the surface,
+     * because the surface is farther than a grid spacing from their centers.
+     * Therefore, the sign is only checked with the shape for the cells next to the core cells,
+     * and then propagated front by front. */
+    auto forEachFaceNeighbor = [&](size_t l, const auto &function)
+    {
+        Arrayi cell_index = transfer1DtoMeshIndex(all_cells_, l);
+        for (int n = 0; n != Dimensions; ++n)
+            for (int side = -1; side <= 1; side += 2)
+            {
+                Arrayi neighbor_index = cell_index;
+                neighbor_index[n] += side;
+                if (neighbor_index[n] >= 0 && neighbor_index[n] < all_cells_[n])
+                    function(transferMeshIndexTo1D(all_cells_, neighbor_index));
+            }
+    };
+
+    ConcurrentVec<size_t> front;
+    parallel_for(
+        IndexRange(0, number_of_cells),
+        [&](const IndexRange &r)
+        {
+            for (size_t l = r.begin(); l != r.end(); ++l)
+            {
+                if (cell_labels[l] != 0)
+                    continue;
+                bool is_next_to_core = false;
+                forEachFaceNeighbor(l, [&](size_t m)
+                                    { is_next_to_core = is_next_to_core || cell_labels[m] == 2; });
+                if (is_next_to_core)
+                {
+                    Vecd cell_position = CellPositionFromIndex(transfer1DtoMeshIndex(all_cells_, l));
+                    cell_labels[l] = shape_.checkContain(cell_position) ? -1 : 1;
+                    front.push_back(l);
+                }
+            }
+        });
+
+    while (!front.empty())
+    {
+        ConcurrentVec<size_t> next_front;
+        parallel_for(
+            IndexRange(0, front.size()),
+            [&](const IndexRange &r)
+            {
+                for (size_t s = r.begin(); s != r.end(); ++s)
+                {
+                    int sign = cell_labels[front[s]];
+                    forEachFaceNeighbor(front[s], [&](size_t m)
+                                        {
+                                            int not_found = 0;
+                                            if (cell_labels[m].compare_exchange_strong(not_found, sign))
+                                                next_front.push_back(m); });
+                }
+            });
+        front.swap(next_front);
+    }
+
+    parallel_for(
+        IndexRange(0, number_of_cells),
+        [&](const IndexRange &r)
+        {
+            for (size_t l = r.begin(); l != r.end(); ++l)
+            {
+                int label = cell_labels[l];
+                if (label == 2)
+                    continue;
+                Arrayi cell_index = transfer1DtoMeshIndex(all_cells_, l);
+                // cells not connected to the surface, e.g. without any core cell, are checked directly
+                bool is_contained = label == 0 ? shape_.checkContain(CellPositionFromIndex(cell_index)) : label == -1;
+                assignDataPackageAddress(cell_index, is_contained ? singular_data_pkgs_addrs_[0] : singular_data_pkgs_addrs_[1]);
+            }
+        });
+}
+//=============================================================================================//
+Arrayi LevelSet::SweepAddressIndex(int data_index, int sweep)
+{
+    Arrayi addrs_index = Arrayi::Zero();
+    for (int n = Dimensions - 1; n >= 0; --n)
+    {
+        int index = data_index % pkg_size;
+        data_index /= pkg_size;
+        addrs_index[n] = pkg_addrs_buffer + (((sweep >> n) & 1) ? pkg_size - 1 - index : index);
+    }
+    return addrs_index;
+}
+//=============================================================================================//
+Real LevelSet::solveEikonal(Vecd neighbor_distance)
+{
+    std::sort(neighbor_distance.data(), neighbor_distance.data() + Dimensions);
+    Real distance = neighbor_distance[0] + data_spacing_;
+    Real sum = neighbor_distance[0];
+    Real squared_sum = neighbor_distance[0] * neighbor_distance[0];
+    for (int n = 1; n != Dimensions; ++n)
+    {
+        if (distance <= neighbor_distance[n])
+            break;
+        sum += neighbor_distance[n];
+        squared_sum += neighbor_distance[n] * neighbor_distance[n];
+        Real discriminant = sum * sum - Real(n + 1) * (squared_sum - data_spacing_ * data_spacing_);
+        distance = (sum + sqrt(SMAX(discriminant, Real(0)))) / Real(n + 1);
+    }
+    return distance;
+}
+//=============================================================================================//
+bool LevelSet::sweepAPackage(LevelSetDataPackage *data_pkg, bool is_core_package_fixed, Real tolerance)
+{
+    if (is_core_package_fixed && data_pkg->isCorePackage())
+        return false;
+
+    auto phi_addrs = data_pkg->getPackageDataAddress(phi_);
+    auto near_interface_id_addrs = data_pkg->getPackageDataAddress(near_interface_id_);
+    int number_of_data = pow(pkg_size, Dimensions);
+    bool is_changed = false;
+    for (int sweep = 0; sweep != (1 << Dimensions); ++sweep)
+        for (int l = 0; l != number_of_data; ++l)
+        {
+            Arrayi addrs_index = SweepAddressIndex(l, sweep);
+            if (!is_core_package_fixed && *near_interface_id_addrs.DataAddress(addrs_index) == 0)
+                continue;
+
+            Vecd neighbor_distance = Vecd::Zero();
+            for (int n = 0; n != Dimensions; ++n)
+            {
+                Arrayi lower_index = addrs_index, upper_index = addrs_index;
+                lower_index[n] -= 1;
+                upper_index[n] += 1;
+                neighbor_distance[n] = SMIN(fabs(*phi_addrs.DataAddress(lower_index)),
+                                            fabs(*phi_addrs.DataAddress(upper_index)));
+            }
+            Real distance = solveEikonal(neighbor_distance);
+            Real &phi = *phi_addrs.DataAddress(addrs_index);
+            if (distance < fabs(phi))
+            {
+                is_changed = is_changed || fabs(phi) - distance > tolerance;
+                phi = phi < 0.0 ? -distance : distance;
+            }
+        }
+    return is_changed;
+}
+//=============================================================================================//
+void LevelSet::redistanceByFastSweeping(bool is_core_package_fixed)
+{
+    if (!is_core_package_fixed)
+    {
+        Real far_field_distance = grid_spacing_ * (Real)buffer_width_;
+        package_parallel_for(
+            inner_data_pkgs_,
+            [&](LevelSetDataPackage *data_pkg)
+            {
+                auto phi_addrs = data_pkg->getPackageDataAddress(phi_);
+                auto near_interface_id_addrs = data_pkg->getPackageDataAddress(near_interface_id_);
+                for (int l = 0; l != pow(pkg_size, Dimensions); ++l)
+                {
+                    Arrayi addrs_index = SweepAddressIndex(l, 0);
+                    if (*near_interface_id_addrs.DataAddress(addrs_index) != 0)
+                    {
+                        Real &phi = *phi_addrs.DataAddress(addrs_index);
+                        phi = phi < 0.0 ? -far_field_distance : far_field_distance;
+                    }
+                }
+            });
+    }
+
+    /** A package reads the data of its face neighbors while being swept.
+     * Therefore, the packages are swept in two colors as a checkerboard,
+     * so that no package is read while being written and the result is independent of thread scheduling. */
+    StdVec<ConcurrentVec<LevelSetDataPackage *>> colored_data_pkgs(2);
+    for (size_t i = 0; i != inner_data_pkgs_.size(); ++i)
+    {
+        LevelSetDataPackage *data_pkg = inner_data_pkgs_[i];
+        colored_data_pkgs[data_pkg->CellIndexOnMesh().sum() % 2].push_back(data_pkg);
+    }
+
+    /** Gauss-Seidel sweeps within a package and among the colors of the packages. */
+    Real tolerance = 1.0e-3 * data_spacing_;
+    for (size_t iteration = 0; iteration != 100; ++iteration)
+    {
+        std::atomic<bool> is_changed(false);
+        for (auto &data_pkgs : colored_data_pkgs)
+            package_parallel_for(
+                data_pkgs,
+                [&](LevelSetDataPackage *data_pkg)
+                {
+                    if (sweepAPackage(data_pkg, is_core_package_fixed, tolerance))
+                        is_changed = true;
+                });
+        if (!is_changed)
+            break;
+    }
+}
+//=============================================================================================//
 Real LevelSet::upwindDifference(Real sign, Real df_p, Real df_n)
 {
     if (sign * df_p >= 0.0 && sign * df_n >= 0.0)
@@ -235,23 +571,122 @@ void RefinedLevelSet::initializeDataInACellFromCoarse(const Arrayi &cell_index)
     assignDataPackageAddress(cell_index, singular_data_pkg);
     if (coarse_mesh_.isWithinCorePackage(cell_position))
     {
-        Real signed_distance = shape_.findSignedDistance(cell_position);
-        Vecd normal_direction = shape_.findNormalDirection(cell_position);
-        Real measure = (signed_distance * normal_direction).cwiseAbs().maxCoeff();
-        if (measure < grid_spacing_)
+        if (findSurfaceMeasure(cell_position) < grid_spacing_)
         {
-            LevelSetDataPackage *new_data_pkg = createDataPackage(
-                all_mesh_variables_, cell_index,
-                [&](LevelSetDataPackage *new_data_pkg)
-                {
-                    initializeBasicDataForAPackage(new_data_pkg, shape_);
-                });
-            new_data_pkg->setCorePackage(); // core package
+            createCorePackage(cell_index);
+        }
+    }
+}
+//=============================================================================================//
+void LevelSet::writeBinaryData(std::ofstream &output_file)
+{
+    /** 0 and 1 for the singular packages, 2 for inner and 3 for core packages */
+    size_t number_of_cells = all_cells_.prod();
+    StdVec<int8_t> cell_package_types(number_of_cells);
+    StdVec<LevelSetDataPackage *> data_pkgs;
+    for (size_t l = 0; l != number_of_cells; ++l)
+    {
+        LevelSetDataPackage *data_pkg = DataPackageFromCellIndex(transfer1DtoMeshIndex(all_cells_, l));
+        if (data_pkg->isInnerPackage())
+        {
+            cell_package_types[l] = data_pkg->isCorePackage() ? 3 : 2;
+            data_pkgs.push_back(data_pkg);
+        }
+        else
+        {
+            cell_package_types[l] = data_pkg == singular_data_pkgs_addrs_[0] ? 0 : 1;
+        }
+    }
+
+    output_file.write(reinterpret_cast<const char *>(all_cells_.data()), sizeof(int) * Dimensions);
+    output_file.write(reinterpret_cast<const char *>(cell_package_types.data()), number_of_cells);
+    auto write_variable = [&](auto &mesh_variable)
+    {
+        for (LevelSetDataPackage *data_pkg : data_pkgs)
+        {
+            auto &pkg_data = data_pkg->getPackageData(mesh_variable);
+            output_file.write(reinterpret_cast<const char *>(&pkg_data), sizeof(pkg_data));
+        }
+    };
+    write_variable(phi_);
+    write_variable(near_interface_id_);
+    write_variable(phi_gradient_);
+}
+//=============================================================================================//
+bool LevelSet::readBinaryData(const char *&data, const char *data_end)
+{
+    Arrayi all_cells = Arrayi::Zero();
+    if (!readBinaryValue(data, data_end, all_cells.data(), sizeof(int) * Dimensions) ||
+        (all_cells != all_cells_).any())
+        return false;
+
+    size_t number_of_cells = all_cells_.prod();
+    StdVec<int8_t> cell_package_types(number_of_cells);
+    if (!readBinaryValue(data, data_end, cell_package_types.data(), number_of_cells))
+        return false;
+
+    StdVec<LevelSetDataPackage *> data_pkgs;
+    for (size_t l = 0; l != number_of_cells; ++l)
+    {
+        Arrayi cell_index = transfer1DtoMeshIndex(all_cells_, l);
+        int8_t package_type = cell_package_types[l];
+        if (package_type < 2)
+        {
+            assignDataPackageAddress(cell_index, singular_data_pkgs_addrs_[package_type == 0 ? 0 : 1]);
+            continue;
+        }
+
+        LevelSetDataPackage *new_data_pkg =
+            createDataPackage(all_mesh_variables_, cell_index, [&](LevelSetDataPackage *) {});
+        if (package_type == 3)
+        {
+            new_data_pkg->setCorePackage();
             core_data_pkgs_.push_back(new_data_pkg);
         }
+        else
+        {
+            new_data_pkg->setInnerPackage();
+        }
+        inner_data_pkgs_.push_back(new_data_pkg);
+        data_pkgs.push_back(new_data_pkg);
     }
+
+    bool is_complete = true;
+    auto read_variable = [&](auto &mesh_variable)
+    {
+        for (LevelSetDataPackage *data_pkg : data_pkgs)
+        {
+            auto &pkg_data = data_pkg->getPackageData(mesh_variable);
+            is_complete = is_complete && readBinaryValue(data, data_end, &pkg_data, sizeof(pkg_data));
+        }
+    };
+    read_variable(phi_);
+    read_variable(near_interface_id_);
+    read_variable(phi_gradient_);
+
+    parallel_for(
+        IndexRange(0, number_of_cells),
+        [&](const IndexRange &r)
+        {
+            for (size_t l = r.begin(); l != r.end(); ++l)
+            {
+                initializePackageAddressesInACell(transfer1DtoMeshIndex(all_cells_, l));
+            }
+        });
+    resetKernelIntegrals();
+    return is_complete;
 }
 //=============================================================================================//
+RefinedLevelSet::RefinedLevelSet(BoundingBox tentative_bounds, LevelSet &coarse_level_set, size_t buffer_size,
+                                 Shape &shape, SPHAdaptation &sph_adaptation)
+    : RefinedMesh(tentative_bounds, coarse_level_set, buffer_size, shape, sph_adaptation) {}
+//=============================================================================================//
+MultilevelLevelSet::MultilevelLevelSet(
+    BoundingBox tentative_bounds, Real reference_data_spacing, size_t total_levels,
+    size_t buffer_size, Shape &shape, SPHAdaptation &sph_adaptation)
+    : MultilevelMesh<BaseLevelSet, LevelSet, RefinedLevelSet>(
+          tentative_bounds, reference_data_spacing, total_levels, buffer_size, shape, sph_adaptation) {}
+//=============================================================================================//
 MultilevelLevelSet::MultilevelLevelSet(
     BoundingBox tentative_bounds, Real reference_data_spacing, size_t total_levels,
     Shape &shape, SPHAdaptation &sph_adaptation)
@@ -339,4 +774,30 @@ bool MultilevelLevelSet::probeIsWithinMeshBound(const Vecd &position)
     return is_bounded;
 }
 //=============================================================================================//
+void MultilevelLevelSet::writeBinaryData(std::ofstream &output_file)
+{
+    for (size_t l = 0; l != total_levels_; ++l)
+    {
+        mesh_levels_[l]->writeBinaryData(output_file);
+    }
+}
+//=============================================================================================//
+bool MultilevelLevelSet::readBinaryData(const char *&data, const char *data_end)
+{
+    for (size_t l = 0; l != total_levels_; ++l)
+    {
+        if (!mesh_levels_[l]->readBinaryData(data, data_end))
+            return false;
+    }
+    return true;
+}
+//=============================================================================================//
+void MultilevelLevelSet::prefetchKernelIntegrals(const StdLargeVec<Vecd> &positions, size_t total_positions)
+{
+    for (size_t l = 0; l != total_levels_; ++l)
+    {
+        mesh_levels_[l]->prefetchKernelIntegrals(positions, total_positions);
+    }
+}
+//=============================================================================================//
 } // namespace SPH
@@ -33,6 +33,8 @@
 #include "base_geometry.h"
 #include "mesh_with_data_packages.hpp"
 
+#include <atomic>
+
 namespace SPH
 {
 /**
@@ -45,6 +47,9 @@ class BaseLevelSet : public BaseMeshField
 {
   public:
     BaseLevelSet(Shape &shape, SPHAdaptation &sph_adaptation);
+    /** the buffer size is only for the meshes, e.g. the levels of a multilevel level set. */
+    BaseLevelSet(size_t buffer_size, Shape &shape, SPHAdaptation &sph_adaptation)
+        : BaseLevelSet(shape, sph_adaptation){};
     virtual ~BaseLevelSet(){};
 
     virtual void cleanInterface(Real small_shift_factor) = 0;
@@ -55,6 +60,13 @@ class BaseLevelSet : public BaseMeshField
     virtual Vecd probeLevelSetGradient(const Vecd &position) = 0;
     virtual Real probeKernelIntegral(const Vecd &position, Real h_ratio = 1.0) = 0;
     virtual Vecd probeKernelGradientIntegral(const Vecd &position, Real h_ratio = 1.0) = 0;
+    /** write all level set data in binary, e.g. for a level set cache. */
+    virtual void writeBinaryData(std::ofstream &output_file) = 0;
+    /** read the binary level set data to a level set with only far field initialized.
+     * Returns false if the data do not match the mesh or are incomplete. */
+    virtual bool readBinaryData(const char *&data, const char *data_end) = 0;
+    /** compute the kernel integrals to be probed at the positions in advance. */
+    virtual void prefetchKernelIntegrals(const StdLargeVec<Vecd> &positions, size_t total_positions) = 0;
 
   protected:
     Shape &shape_; /**< the geometry is described by the level set. */
@@ -73,6 +85,12 @@ class BaseLevelSet : public BaseMeshField
  * Note that the mesh containing the data packages are cell-based
  * but within the data package, the data is grid-based.
  * Note that the level set data is initialized after the constructor.
+ * With the narrow-band approach, the shape is queried for exact signed distance only in core packages.
+ * The sign of the other cells is found by a parallel flood fill from the core cells,
+ * and the level set in the other inner packages is computed by parallel fast sweeping,
+ * which is also used for redistancing when the interface is cleaned.
+ * Note that the kernel integrals of a package are only computed when they are probed for the first time,
+ * as only the packages near the particles at the surface are probed usually.
  */
 class LevelSet : public MeshWithGridDataPackages<GridDataPackage<4, 1>>,
                  public BaseLevelSet
@@ -97,6 +115,9 @@ class LevelSet : public MeshWithGridDataPackages<GridDataPackage<4, 1>>,
     virtual Real probeKernelIntegral(const Vecd &position, Real h_ratio = 1.0) override;
     virtual Vecd probeKernelGradientIntegral(const Vecd &position, Real h_ratio = 1.0) override;
     virtual void writeMeshFieldToPlt(std::ofstream &output_file) override;
+    virtual void writeBinaryData(std::ofstream &output_file) override;
+    virtual bool readBinaryData(const char *&data, const char *data_end) override;
+    virtual void prefetchKernelIntegrals(const StdLargeVec<Vecd> &positions, size_t total_positions) override;
     bool isWithinCorePackage(Vecd position);
     Real computeKernelIntegral(const Vecd &position);
     Vecd computeKernelGradientIntegral(const Vecd &position);
@@ -108,6 +129,9 @@ class LevelSet : public MeshWithGridDataPackages<GridDataPackage<4, 1>>,
     MeshVariable<Real> &kernel_weight_;
     MeshVariable<Vecd> &kernel_gradient_;
     Kernel &kernel_;
+    bool is_narrow_band_; /**< built with the narrow-band approach. */
+    /** 0 for not computed, 1 for being computed and 2 for computed kernel integrals, indexed by package id. */
+    StdVec<std::atomic<int>> kernel_integral_states_;
 
     void initializeDataForSingularPackage(LevelSetDataPackage *data_pkg, Real far_field_level_set);
     void initializeBasicDataForAPackage(LevelSetDataPackage *data_pkg, Shape &shape);
@@ -119,11 +143,31 @@ class LevelSet : public MeshWithGridDataPackages<GridDataPackage<4, 1>>,
     void redistanceInterface();
     void diffuseLevelSetSign();
     void updateLevelSetGradient();
+    /** compute the kernel integrals of all packages not computed yet. */
     void updateKernelIntegrals();
+    /** set the kernel integrals of all packages to be computed when probed. */
+    void resetKernelIntegrals();
+    /** compute the kernel integrals of a package once, also when called concurrently. */
+    void updateKernelIntegralsForAPackage(LevelSetDataPackage *data_pkg);
+    /** the inner packages whose data are interpolated for probing at the position */
+    template <typename FunctionOnPackage>
+    void for_each_probed_package(const Vecd &position, const FunctionOnPackage &function);
     bool isInnerPackage(const Arrayi &cell_index);
     void initializeDataInACell(const Arrayi &cell_index);
     void initializeAddressesInACell(const Arrayi &cell_index);
     void tagACellIsInnerPackage(const Arrayi &cell_index);
+    /** the measure used to identify the core packages, i.e. the maximum component of the distance to surface. */
+    Real findSurfaceMeasure(const Vecd &cell_position);
+    void createCorePackage(const Arrayi &cell_index);
+    void initializeNarrowBandData();
+    /** Fast sweeping for the level set in the inner packages. Either the core packages are fixed
+     * or, for redistancing, the cut cells are fixed and the other data are reset before sweeping. */
+    void redistanceByFastSweeping(bool is_core_package_fixed);
+    /** returns whether the level set in the package is changed more than the tolerance. */
+    bool sweepAPackage(LevelSetDataPackage *data_pkg, bool is_core_package_fixed, Real tolerance);
+    /** the address index of a package data in the order of a sweep, whose bits give the reversed directions. */
+    Arrayi SweepAddressIndex(int data_index, int sweep);
+    Real solveEikonal(Vecd neighbor_distance);
 
     // upwind algorithm choosing candidate difference by the sign
     Real upwindDifference(Real sign, Real df_p, Real df_n);
@@ -136,6 +180,8 @@ class LevelSet : public MeshWithGridDataPackages<GridDataPackage<4, 1>>,
 class RefinedLevelSet : public RefinedMesh<LevelSet>
 {
   public:
+    /** This constructor only initialize far field. */
+    RefinedLevelSet(BoundingBox tentative_bounds, LevelSet &coarse_level_set, size_t buffer_size, Shape &shape, SPHAdaptation &sph_adaptation);
     RefinedLevelSet(BoundingBox tentative_bounds, LevelSet &coarse_level_set, Shape &shape, SPHAdaptation &sph_adaptation);
     virtual ~RefinedLevelSet(){};
 
@@ -150,6 +196,9 @@ class RefinedLevelSet : public RefinedMesh<LevelSet>
 class MultilevelLevelSet : public MultilevelMesh<BaseLevelSet, LevelSet, RefinedLevelSet>
 {
   public:
+    /** This constructor only initialize far field for all levels. */
+    MultilevelLevelSet(BoundingBox tentative_bounds, Real reference_data_spacing, size_t total_levels,
+                       size_t buffer_size, Shape &shape, SPHAdaptation &sph_adaptation);
     MultilevelLevelSet(BoundingBox tentative_bounds, Real reference_data_spacing, size_t total_levels, Shape &shape, SPHAdaptation &sph_adaptation);
     virtual ~MultilevelLevelSet(){};
 
@@ -161,6 +210,9 @@ class MultilevelLevelSet : public MultilevelMesh<BaseLevelSet, LevelSet, Refined
     virtual Vecd probeLevelSetGradient(const Vecd &position) override;
     virtual Real probeKernelIntegral(const Vecd &position, Real h_ratio = 1.0) override;
     virtual Vecd probeKernelGradientIntegral(const Vecd &position, Real h_ratio = 1.0) override;
+    virtual void writeBinaryData(std::ofstream &output_file) override;
+    virtual bool readBinaryData(const char *&data, const char *data_end) override;
+    virtual void prefetchKernelIntegrals(const StdLargeVec<Vecd> &positions, size_t total_positions) override;
 
   protected:
     inline size_t getProbeLevel(const Vecd &position);
@@ -4,13 +4,64 @@
 #include "io_all.h"
 #include "sph_system.h"
 
+#include <chrono>
+#include <cstring>
+#include <typeinfo>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 namespace SPH
 {
 //=================================================================================================//
+namespace
+{
+constexpr char level_set_cache_signature[] = "SPHLSC02";
+constexpr size_t level_set_cache_header_size = 8 + 3 * sizeof(uint64_t);
+//=================================================================================================//
+/** map the file to memory for reading, or read the file to the buffer without mmap */
+template <typename FunctionOnData>
+bool readMappedFile(const std::string &file_path, const FunctionOnData &function_on_data)
+{
+#ifdef __linux__
+    int file_descriptor = ::open(file_path.c_str(), O_RDONLY);
+    if (file_descriptor < 0)
+        return false;
+    struct stat file_status;
+    if (fstat(file_descriptor, &file_status) != 0 || file_status.st_size == 0)
+    {
+        ::close(file_descriptor);
+        return false;
+    }
+    size_t file_size = file_status.st_size;
+    void *mapped_data = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+    ::close(file_descriptor);
+    if (mapped_data == MAP_FAILED)
+        return false;
+    madvise(mapped_data, file_size, MADV_SEQUENTIAL);
+    const char *data = static_cast<const char *>(mapped_data);
+    bool is_read = function_on_data(data, data + file_size);
+    munmap(mapped_data, file_size);
+    return is_read;
+#else
+    std::ifstream in_file(file_path.c_str(), std::ios::binary);
+    if (!in_file.is_open())
+        return false;
+    std::string buffer((std::istreambuf_iterator<char>(in_file)), std::istreambuf_iterator<char>());
+    return function_on_data(buffer.data(), buffer.data() + buffer.size());
+#endif
+}
+} // namespace
+//=================================================================================================//
 LevelSetShape::
-    LevelSetShape(Shape &shape, SharedPtr<SPHAdaptation> sph_adaptation, Real refinement_ratio)
+    LevelSetShape(Shape &shape, SharedPtr<SPHAdaptation> sph_adaptation, Real refinement_ratio,
+                  const std::string &cache_folder)
     : Shape(shape.getName()), sph_adaptation_(sph_adaptation),
-      level_set_(*level_set_keeper_.movePtr(sph_adaptation->createLevelSet(shape, refinement_ratio)))
+      level_set_(*createLevelSet(shape, *sph_adaptation, refinement_ratio, cache_folder))
 {
     bounding_box_ = shape.getBounds();
     is_bounds_found_ = true;
@@ -18,13 +69,107 @@ LevelSetShape::
 //=================================================================================================//
 LevelSetShape::LevelSetShape(SPHBody &sph_body, Shape &shape, Real refinement_ratio)
     : Shape(shape.getName()),
-      level_set_(*level_set_keeper_.movePtr(
-          sph_body.sph_adaptation_->createLevelSet(shape, refinement_ratio)))
+      level_set_(*createLevelSet(
+          shape, *sph_body.sph_adaptation_, refinement_ratio,
+          sph_body.getSPHSystem().CacheLevelSet() ? sph_body.getSPHSystem().getIOEnvironment().reload_folder_ : ""))
 {
     bounding_box_ = shape.getBounds();
     is_bounds_found_ = true;
 }
 //=================================================================================================//
+BaseLevelSet *LevelSetShape::createLevelSet(Shape &shape, SPHAdaptation &sph_adaptation,
+                                            Real refinement_ratio, const std::string &cache_folder)
+{
+    uint64_t cache_key = cache_folder.empty() ? 0 : getLevelSetCacheKey(shape, sph_adaptation, refinement_ratio);
+    if (cache_key == 0)
+    {
+        return level_set_keeper_.movePtr(sph_adaptation.createLevelSet(shape, refinement_ratio));
+    }
+
+    std::stringstream cache_file;
+    cache_file << cache_folder << "/LevelSet_" << shape.getName() << "_"
+               << std::hex << std::setw(16) << std::setfill('0') << cache_key << ".bin";
+
+    BaseLevelSet *level_set = readLevelSetCache(cache_file.str(), cache_key, shape, sph_adaptation, refinement_ratio);
+    if (level_set != nullptr)
+    {
+        return level_set;
+    }
+
+    level_set = level_set_keeper_.movePtr(sph_adaptation.createLevelSet(shape, refinement_ratio));
+    writeLevelSetCache(cache_file.str(), cache_key, *level_set);
+    return level_set;
+}
+//=================================================================================================//
+uint64_t LevelSetShape::getLevelSetCacheKey(Shape &shape, SPHAdaptation &sph_adaptation, Real refinement_ratio)
+{
+    uint64_t hash = shape.getSourceHash();
+    if (hash == 0)
+        return 0;
+
+    BoundingBox bounds = shape.getBounds();
+    hash = hashData(bounds.first_, hash);
+    hash = hashData(bounds.second_, hash);
+    hash = hashData(refinement_ratio, hash);
+    hash = hashData(sph_adaptation.ReferenceSpacing(), hash);
+    hash = hashData(sph_adaptation.ReferenceSmoothingLength(), hash);
+    hash = hashData(sph_adaptation.LocalRefinementLevel(), hash);
+    hash = hashData(sph_adaptation.isNarrowBandLevelSet(), hash);
+    std::string adaptation_type = typeid(sph_adaptation).name();
+    hash = hashBytes(adaptation_type.data(), adaptation_type.size(), hash);
+    std::string kernel_name = sph_adaptation.getKernel()->Name();
+    hash = hashBytes(kernel_name.data(), kernel_name.size(), hash);
+    return hash == 0 ? 1 : hash;
+}
+//=================================================================================================//
+BaseLevelSet *LevelSetShape::readLevelSetCache(const std::string &cache_file, uint64_t cache_key, Shape &shape,
+                                               SPHAdaptation &sph_adaptation, Real refinement_ratio)
+{
+    BaseLevelSet *level_set = nullptr;
+    bool is_read = readMappedFile(
+        cache_file,
+        [&](const char *data, const char *data_end)
+        {
+            // signature, cache key, size of Real and size of the level set data
+            uint64_t header[3];
+            if (size_t(data_end - data) < level_set_cache_header_size ||
+                std::memcmp(data, level_set_cache_signature, 8) != 0)
+                return false;
+            std::memcpy(header, data + 8, sizeof(header));
+            data += level_set_cache_header_size;
+            if (header[0] != cache_key || header[1] != sizeof(Real) || header[2] != size_t(data_end - data))
+                return false;
+            // the far-field level set is only constructed for a valid cache
+            level_set = level_set_keeper_.movePtr(sph_adaptation.createFarFieldLevelSet(shape, refinement_ratio));
+            return level_set->readBinaryData(data, data_end) && data == data_end;
+        });
+    return is_read ? level_set : nullptr;
+}
+//=================================================================================================//
+void LevelSetShape::writeLevelSetCache(const std::string &cache_file, uint64_t cache_key, BaseLevelSet &level_set)
+{
+    // written to a temporary file first, so that simultaneous runs never read an incomplete cache
+    std::string temporary_file =
+        cache_file + "." + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count());
+    std::ofstream out_file(temporary_file.c_str(), std::ios::binary | std::ios::trunc);
+    uint64_t header[3] = {cache_key, sizeof(Real), 0};
+    out_file.write(level_set_cache_signature, 8);
+    out_file.write(reinterpret_cast<const char *>(header), sizeof(header));
+    level_set.writeBinaryData(out_file);
+    header[2] = uint64_t(out_file.tellp()) - level_set_cache_header_size;
+    out_file.seekp(8);
+    out_file.write(reinterpret_cast<const char *>(header), sizeof(header));
+    out_file.close();
+
+    std::error_code error_code;
+    if (out_file.fail())
+    {
+        fs::remove(temporary_file, error_code);
+        return;
+    }
+    fs::rename(temporary_file, cache_file, error_code);
+}
+//=================================================================================================//
 void LevelSetShape::writeLevelSet(SPHSystem &sph_system)
 {
     MeshRecordingToPlt write_level_set_to_plt(sph_system, level_set_);
@@ -81,4 +226,9 @@ Vecd LevelSetShape::computeKernelGradientIntegral(const Vecd &probe_point, Real
     return level_set_.probeKernelGradientIntegral(probe_point, h_ratio);
 }
 //=================================================================================================//
+void LevelSetShape::prefetchKernelIntegrals(const StdLargeVec<Vecd> &positions, size_t total_positions)
+{
+    level_set_.prefetchKernelIntegrals(positions, total_positions);
+}
+//=================================================================================================//
 } // namespace SPH
@@ -41,6 +41,10 @@ class SPHSystem;
 /**
  * @class LevelSetShape
  * @brief A shape using level set to define geometry
+ * When the level set cache of the SPH system is switched on, the level set is read from
+ * a binary file in the reload folder if the file is written from the same shape,
+ * bounds, resolution and adaptation. Otherwise, the level set is built and written to the file.
+ * Only shapes with a source hash, e.g. triangle meshes and multi-polygons, are cached.
  */
 class LevelSetShape : public Shape
 {
@@ -48,9 +52,19 @@ class LevelSetShape : public Shape
     UniquePtrKeeper<BaseLevelSet> level_set_keeper_;
     SharedPtr<SPHAdaptation> sph_adaptation_;
 
+    BaseLevelSet *createLevelSet(Shape &shape, SPHAdaptation &sph_adaptation,
+                                 Real refinement_ratio, const std::string &cache_folder);
+    /** hash of the shape source and all the parameters for building the level set, zero if not available */
+    uint64_t getLevelSetCacheKey(Shape &shape, SPHAdaptation &sph_adaptation, Real refinement_ratio);
+    BaseLevelSet *readLevelSetCache(const std::string &cache_file, uint64_t cache_key, Shape &shape,
+                                    SPHAdaptation &sph_adaptation, Real refinement_ratio);
+    void writeLevelSetCache(const std::string &cache_file, uint64_t cache_key, BaseLevelSet &level_set);
+
   public:
-    /** refinement_ratio is between body reference resolution and level set resolution */
-    LevelSetShape(Shape &shape, SharedPtr<SPHAdaptation> sph_adaptation, Real refinement_ratio = 1.0);
+    /** refinement_ratio is between body reference resolution and level set resolution,
+     *  the level set is cached in cache_folder if it is not empty */
+    LevelSetShape(Shape &shape, SharedPtr<SPHAdaptation> sph_adaptation, Real refinement_ratio = 1.0,
+                  const std::string &cache_folder = "");
     LevelSetShape(SPHBody &sph_body, Shape &shape, Real refinement_ratio = 1.0);
 
     virtual ~LevelSetShape(){};
@@ -61,6 +75,8 @@ class LevelSetShape : public Shape
     Vecd findLevelSetGradient(const Vecd &probe_point);
     Real computeKernelIntegral(const Vecd &probe_point, Real h_ratio = 1.0);
     Vecd computeKernelGradientIntegral(const Vecd &probe_point, Real h_ratio = 1.0);
+    /** kernel integrals are computed when first probed, but can be computed in advance for the positions. */
+    void prefetchKernelIntegrals(const StdLargeVec<Vecd> &positions, size_t total_positions);
     /** small_shift_factor = 1.0 by default, can be increased for difficult geometries for smoothing */
     LevelSetShape *cleanLevelSet(Real small_shift_factor = 1.0);
     /** required to build level set from triangular mesh in stl file format. */
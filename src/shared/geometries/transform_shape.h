@@ -69,6 +69,17 @@ class TransformShape : public BaseShapeType
         return transform_.shiftFrameStationToBase(closest_point_origin);
     };
 
+    virtual uint64_t getSourceHash() override
+    {
+        uint64_t hash = BaseShapeType::getSourceHash();
+        if (hash == 0)
+            return 0;
+        hash = hashData(transform_.shiftFrameStationToBase(Vecd::Zero()), hash);
+        for (int n = 0; n != Dimensions; ++n)
+            hash = hashData(transform_.xformFrameVecToBase(Vecd::Unit(n)), hash);
+        return hash;
+    };
+
   protected:
     Transform transform_;
 
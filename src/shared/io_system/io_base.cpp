@@ -20,88 +20,175 @@ std::string BaseIO::convertPhysicalTimeToString(Real convertPhysicalTimeToStream
     return padValueWithZeros(i_time);
 }
 //=============================================================================================//
+BackgroundWriter::BackgroundWriter(size_t number_of_buffers)
+    : buffer_in_use_(number_of_buffers, false), stop_(false),
+      thread_(&BackgroundWriter::run, this) {}
+//=============================================================================================//
+BackgroundWriter::~BackgroundWriter()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    condition_.notify_all();
+    thread_.join();
+}
+//=============================================================================================//
+size_t BackgroundWriter::acquireBuffer()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    auto free_buffer = buffer_in_use_.end();
+    condition_.wait(lock, [&]
+                    { free_buffer = std::find(buffer_in_use_.begin(), buffer_in_use_.end(), false);
+                      return free_buffer != buffer_in_use_.end(); });
+    *free_buffer = true;
+    return free_buffer - buffer_in_use_.begin();
+}
+//=============================================================================================//
+void BackgroundWriter::submit(size_t buffer_index, std::function<void()> write_task)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        write_tasks_.emplace_back(buffer_index, std::move(write_task));
+    }
+    condition_.notify_all();
+}
+//=============================================================================================//
+void BackgroundWriter::flush()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    condition_.wait(lock, [&]
+                    { return std::find(buffer_in_use_.begin(), buffer_in_use_.end(), true) == buffer_in_use_.end(); });
+}
+//=============================================================================================//
+void BackgroundWriter::run()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true)
+    {
+        condition_.wait(lock, [&]
+                        { return stop_ || !write_tasks_.empty(); });
+        if (write_tasks_.empty())
+        {
+            return;
+        }
+        std::pair<size_t, std::function<void()>> write_task = std::move(write_tasks_.front());
+        write_tasks_.pop_front();
+
+        lock.unlock();
+        write_task.second();
+        lock.lock();
+
+        buffer_in_use_[write_task.first] = false;
+        condition_.notify_all();
+    }
+}
+//=============================================================================================//
 BodyStatesRecording::BodyStatesRecording(SPHBodyVector bodies)
     : BaseIO(bodies[0]->getSPHSystem()), bodies_(bodies),
-      state_recording_(sph_system_.StateRecording()) {}
+      state_recording_(sph_system_.StateRecording()), output_time_(0), number_of_outputs_(0) {}
 //=============================================================================================//
 BodyStatesRecording::BodyStatesRecording(SPHBody &body)
     : BodyStatesRecording({&body}) {}
 //=============================================================================================//
 void BodyStatesRecording::writeToFile()
 {
+    output_time_ = GlobalStaticVariables::physical_time_;
     writeWithFileName(convertPhysicalTimeToString(GlobalStaticVariables::physical_time_));
+    number_of_outputs_++;
 }
 //=============================================================================================//
 void BodyStatesRecording::writeToFile(size_t iteration_step)
 {
+    // the physical time does not advance during particle relaxation
+    output_time_ = sph_system_.RunParticleRelaxation() ? Real(iteration_step) : GlobalStaticVariables::physical_time_;
     writeWithFileName(padValueWithZeros(iteration_step));
+    number_of_outputs_++;
 };
 //=============================================================================================//
-RestartIO::RestartIO(SPHBodyVector bodies)
-    : BaseIO(bodies[0]->getSPHSystem()), bodies_(bodies),
-      overall_file_path_(io_environment_.restart_folder_ + "/Restart_time_")
+void BodyStatesRecording::setAsyncWriting(size_t number_of_buffers)
 {
-    std::transform(bodies.begin(), bodies.end(), std::back_inserter(file_names_),
-                   [&](SPHBody *body) -> std::string
-                   { return io_environment_.restart_folder_ + "/" + body->getName() + "_rst_"; });
+    if (!isAsyncWritingSupported())
+    {
+        std::cout << "\n Error: asynchronous writing is not supported by this body states recording!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+    flushAsyncWriting();
+    background_writer_ = makeUnique<BackgroundWriter>(number_of_buffers);
 }
 //=============================================================================================//
-void RestartIO::writeToFile(size_t iteration_step)
+void BodyStatesRecording::flushAsyncWriting()
 {
-    std::string overall_filefullpath = overall_file_path_ + padValueWithZeros(iteration_step) + ".dat";
-    if (fs::exists(overall_filefullpath))
+    if (background_writer_ != nullptr)
     {
-        fs::remove(overall_filefullpath);
+        background_writer_->flush();
     }
-    std::ofstream out_file(overall_filefullpath.c_str(), std::ios::app);
-    out_file << std::fixed << std::setprecision(9) << GlobalStaticVariables::physical_time_ << "   \n";
-    out_file.close();
-
-    for (size_t i = 0; i < bodies_.size(); ++i)
+}
+//=============================================================================================//
+void BodyStatesRecording::setOutputInterval(const std::string &variable_name, size_t interval)
+{
+    output_intervals_[variable_name] = SMAX(interval, size_t(1));
+}
+//=============================================================================================//
+std::set<std::string> BodyStatesRecording::skippedVariables()
+{
+    std::set<std::string> skipped_variables;
+    for (const auto &output_interval : output_intervals_)
     {
-        std::string filefullpath = file_names_[i] + padValueWithZeros(iteration_step) + ".xml";
-
-        if (fs::exists(filefullpath))
+        if (number_of_outputs_ % output_interval.second != 0)
         {
-            fs::remove(filefullpath);
+            skipped_variables.insert(output_interval.first);
         }
-        bodies_[i]->writeParticlesToXmlForRestart(filefullpath);
     }
+    return skipped_variables;
 }
 //=============================================================================================//
-Real RestartIO::readRestartTime(size_t restart_step)
+/** signature of the binary restart files */
+static const std::string restart_file_signature = "SPHRST02";
+//=============================================================================================//
+RestartIO::RestartIO(SPHBodyVector bodies)
+    : BaseIO(bodies[0]->getSPHSystem()), bodies_(bodies),
+      file_path_(io_environment_.restart_folder_ + "/Restart_"), restart_time_(0) {}
+//=============================================================================================//
+void RestartIO::writeToFile(size_t iteration_step)
 {
-    std::cout << "\n Reading restart files from the restart step = " << restart_step << std::endl;
-    std::string overall_filefullpath = overall_file_path_ + padValueWithZeros(restart_step) + ".dat";
-    if (!fs::exists(overall_filefullpath))
+    BinaryDataWriter writer(restart_file_signature, GlobalStaticVariables::physical_time_);
+    for (SPHBody *body : bodies_)
     {
-        std::cout << "\n Error: the input file:" << overall_filefullpath << " is not exists" << std::endl;
-        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
-        exit(1);
+        BaseParticles &base_particles = body->getBaseParticles();
+        base_particles.writeRawVariableDataToBinary(writer, base_particles.getRestartVariableData());
     }
-    Real restart_time;
-    std::ifstream in_file(overall_filefullpath.c_str());
-    in_file >> restart_time;
-    in_file.close();
-
-    return restart_time;
+    writer.writeToFile(file_path_ + padValueWithZeros(iteration_step) + ".bin");
 }
 //=============================================================================================//
 void RestartIO::readFromFile(size_t restart_step)
 {
-    for (size_t i = 0; i < bodies_.size(); ++i)
+    std::cout << "\n Reading restart files from the restart step = " << restart_step << std::endl;
+    std::string filefullpath = file_path_ + padValueWithZeros(restart_step) + ".bin";
+    BinaryDataReader reader(filefullpath, restart_file_signature);
+    if (reader.Blocks().size() != bodies_.size())
     {
-        std::string filefullpath = file_names_[i] + padValueWithZeros(restart_step) + ".xml";
+        std::cout << "\n Error: the number of bodies in the restart file " << filefullpath << " does not match!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
 
-        if (!fs::exists(filefullpath))
+    for (size_t i = 0; i != bodies_.size(); ++i)
+    {
+        const BinaryBlockRecord &block = reader.Blocks()[i];
+        BaseParticles &base_particles = bodies_[i]->getBaseParticles();
+        if (block.name_ != bodies_[i]->getName() || block.number_of_elements_ > base_particles.real_particles_bound_)
         {
-            std::cout << "\n Error: the input file:" << filefullpath << " is not exists" << std::endl;
+            std::cout << "\n Error: the body " << block.name_ << " in the restart file "
+                      << filefullpath << " does not match " << bodies_[i]->getName() << "!" << std::endl;
             std::cout << __FILE__ << ':' << __LINE__ << std::endl;
             exit(1);
         }
-
-        bodies_[i]->readParticlesFromXmlForRestart(filefullpath);
+        base_particles.total_real_particles_ = block.number_of_elements_;
+        base_particles.readRawVariableDataFromBinary(reader, block, base_particles.getRestartVariableData());
     }
+    restart_time_ = reader.Time();
 }
 //=============================================================================================//
 ReloadParticleIO::ReloadParticleIO(SPHBodyVector bodies)
@@ -109,13 +196,13 @@ ReloadParticleIO::ReloadParticleIO(SPHBodyVector bodies)
 {
     std::transform(bodies.begin(), bodies.end(), std::back_inserter(file_names_),
                    [&](SPHBody *body) -> std::string
-                   { return io_environment_.reload_folder_ + "/" + body->getName() + "_rld.xml"; });
+                   { return io_environment_.reload_folder_ + "/" + body->getName() + "_rld"; });
 }
 //=============================================================================================//
 ReloadParticleIO::ReloadParticleIO(SPHBody &sph_body, const std::string &given_body_name)
     : BaseIO(sph_body.getSPHSystem()), bodies_({&sph_body})
 {
-    file_names_.push_back(io_environment_.reload_folder_ + "/" + given_body_name + "_rld.xml");
+    file_names_.push_back(io_environment_.reload_folder_ + "/" + given_body_name + "_rld");
 }
 //=============================================================================================//
 ReloadParticleIO::ReloadParticleIO(SPHBody &sph_body)
@@ -125,13 +212,13 @@ void ReloadParticleIO::writeToFile(size_t iteration_step)
 {
     for (size_t i = 0; i < bodies_.size(); ++i)
     {
-        std::string filefullpath = file_names_[i];
+        std::string filefullpath = file_names_[i] + ".bin";
 
         if (fs::exists(filefullpath))
         {
             fs::remove(filefullpath);
         }
-        bodies_[i]->writeToXmlForReloadParticle(filefullpath);
+        bodies_[i]->writeToBinaryForReloadParticle(filefullpath);
     }
 }
 //=============================================================================================//
@@ -140,8 +227,14 @@ void ReloadParticleIO::readFromFile(size_t restart_step)
     std::cout << "\n Reloading particles from files." << std::endl;
     for (size_t i = 0; i < bodies_.size(); ++i)
     {
-        std::string filefullpath = file_names_[i];
+        std::string filefullpath = file_names_[i] + ".bin";
+        std::string xml_filefullpath = file_names_[i] + ".xml";
+        if (fs::exists(filefullpath) && bodies_[i]->readFromBinaryForReloadParticle(filefullpath, xml_filefullpath))
+        {
+            continue;
+        }
 
+        filefullpath = xml_filefullpath;
         if (!fs::exists(filefullpath))
         {
             std::cout << "\n Error: the input file:" << filefullpath << " is not exists" << std::endl;
@@ -35,10 +35,17 @@
 #include "sph_data_containers.h"
 #include "xml_engine.h"
 
+#include <condition_variable>
+#include <deque>
 #include <filesystem>
 #include <fstream>
+#include <functional>
 #include <iomanip>
+#include <map>
+#include <mutex>
+#include <set>
 #include <sstream>
+#include <thread>
 namespace fs = std::filesystem;
 
 namespace SPH
@@ -73,9 +80,47 @@ class BaseIO
     }
 };
 
+/**
+ * @class BackgroundWriter
+ * @brief Thread serializing and writing staged output data in the background.
+ * The data are staged in a fixed number of reusable buffers.
+ * A buffer is acquired before staging and released after its write task is finished,
+ * so that the task queue is bounded by the number of buffers
+ * and the main thread only waits when all buffers are still in use.
+ */
+class BackgroundWriter
+{
+  public:
+    explicit BackgroundWriter(size_t number_of_buffers = 2);
+    ~BackgroundWriter();
+    size_t NumberOfBuffers() const { return buffer_in_use_.size(); };
+    /** wait until a buffer is available and return its index */
+    size_t acquireBuffer();
+    /** queue the task writing the data staged in the acquired buffer */
+    void submit(size_t buffer_index, std::function<void()> write_task);
+    /** wait until all queued tasks are finished */
+    void flush();
+
+  protected:
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    std::deque<std::pair<size_t, std::function<void()>>> write_tasks_;
+    StdVec<bool> buffer_in_use_;
+    bool stop_;
+    std::thread thread_;
+
+    void run();
+};
+
 /**
  * @class BodyStatesRecording
  * @brief base class for write body states.
+ * In asynchronous mode, the derived classes which support it
+ * stage the body states and leave the writing to a background thread.
+ * Asynchronous writing is rejected for the derived classes without staging,
+ * as their states could be changed by the simulation while being written.
+ * The variables can be given output intervals counted in number of outputs,
+ * so that slowly varying variables are written less often by the derived classes supporting it.
  */
 class BodyStatesRecording : public BaseIO
 {
@@ -87,26 +132,46 @@ class BodyStatesRecording : public BaseIO
     /** write with filename indicated by physical time */
     void writeToFile();
     virtual void writeToFile(size_t iteration_step) override;
+    /** write in a background thread with given number of staging buffers,
+     *  only for the derived classes staging the states */
+    void setAsyncWriting(size_t number_of_buffers = 2);
+    virtual bool isAsyncWritingSupported() { return false; };
+    /** wait until all staged states are written */
+    void flushAsyncWriting();
+    /** write the variable only at every given number of outputs */
+    void setOutputInterval(const std::string &variable_name, size_t interval);
 
   protected:
     SPHBodyVector bodies_;
     bool state_recording_;
+    /** time of the current output, which is the iteration step for particle relaxation */
+    Real output_time_;
+    UniquePtr<BackgroundWriter> background_writer_;
+    std::map<std::string, size_t> output_intervals_;
+    size_t number_of_outputs_;
+
+    /** variables not to be written in the current output according to their intervals */
+    std::set<std::string> skippedVariables();
 
     virtual void writeWithFileName(const std::string &sequence) = 0;
 };
 
 /**
  * @class RestartIO
- * @brief Write and read the restart files in XML format.
+ * @brief Write and read the restart files in binary format.
+ * A restart file holds the physical time and, for each body, the number of real particles
+ * and the restart variables as raw contiguous arrays in native byte order.
+ * A small header describes the arrays by their names, types, sizes and offsets,
+ * and a checksum of the header and the arrays closes the file.
+ * The file is memory mapped and verified before the body states are restored.
+ * See BinaryDataWriter and BinaryDataReader for the file layout.
  */
 class RestartIO : public BaseIO
 {
   protected:
     SPHBodyVector bodies_;
-    std::string overall_file_path_;
-    StdVec<std::string> file_names_;
-
-    Real readRestartTime(size_t restart_step);
+    std::string file_path_;
+    Real restart_time_;
 
   public:
     RestartIO(SPHBodyVector bodies);
@@ -118,13 +183,15 @@ class RestartIO : public BaseIO
     virtual Real readRestartFiles(size_t restart_step)
     {
         readFromFile(restart_step);
-        return readRestartTime(restart_step);
+        return restart_time_;
     };
 };
 
 /**
  * @class ReloadParticleIO
- * @brief Write and read the particle-reloading files in XML format.
+ * @brief Write and read the particle-reloading files.
+ * The files are written in the binary format of BinaryDataWriter with the extension ".bin".
+ * When reading, the binary file is used if it exists, otherwise the file in XML format.
  */
 class ReloadParticleIO : public BaseIO
 {
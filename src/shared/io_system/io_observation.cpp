@@ -0,0 +1,139 @@
+/**
+ * @file 	io_observation.cpp
+ * @author	Chi Zhang, Shuoguo Zhang, Zhenxi Zhao and Xiangyu Hu
+ */
+
+#include "io_observation.h"
+
+namespace SPH
+{
+//=============================================================================================//
+QuantityRecordBuffer::QuantityRecordBuffer(const std::string &file_path, bool is_restarting,
+                                           Format format, size_t rows_per_flush)
+    : file_path_(file_path), format_(format), rows_per_flush_(rows_per_flush),
+      column_names_({"run_time"}), is_restarting_(is_restarting), is_file_started_(false) {}
+//=============================================================================================//
+void QuantityRecordBuffer::setFormat(Format format, size_t rows_per_flush)
+{
+    if (is_file_started_ && format != format_)
+    {
+        std::cout << "\n Error: the format of " << FileFullPath() << " is changed after writing!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+    format_ = format;
+    rows_per_flush_ = SMAX(rows_per_flush, size_t(1));
+}
+//=============================================================================================//
+void QuantityRecordBuffer::addColumn(const std::string &quantity_name, const Real &quantity)
+{
+    column_names_.push_back(quantity_name);
+}
+//=============================================================================================//
+void QuantityRecordBuffer::addColumn(const std::string &quantity_name, const Vecd &quantity)
+{
+    for (int i = 0; i != Dimensions; ++i)
+        column_names_.push_back(quantity_name + "[" + std::to_string(i) + "]");
+}
+//=============================================================================================//
+void QuantityRecordBuffer::beginRow(Real time)
+{
+    if (values_.size() >= rows_per_flush_ * column_names_.size())
+    {
+        flush();
+    }
+    values_.push_back(time);
+}
+//=============================================================================================//
+void QuantityRecordBuffer::addValue(const Vecd &quantity)
+{
+    for (int i = 0; i != Dimensions; ++i)
+        values_.push_back(quantity[i]);
+}
+//=============================================================================================//
+std::string QuantityRecordBuffer::FileFullPath()
+{
+    switch (format_)
+    {
+    case Format::Csv:
+        return file_path_ + ".csv";
+    case Format::Binary:
+        return file_path_ + ".bin";
+    default:
+        return file_path_ + ".dat";
+    }
+}
+//=============================================================================================//
+void QuantityRecordBuffer::writeHeader(std::ofstream &out_file)
+{
+    if (format_ == Format::Binary)
+    {
+        uint64_t number_of_columns = column_names_.size();
+        out_file.write("SPHREC01", 8);
+        out_file.write(reinterpret_cast<const char *>(&number_of_columns), sizeof(uint64_t));
+        for (const std::string &column_name : column_names_)
+        {
+            uint64_t length = column_name.size();
+            out_file.write(reinterpret_cast<const char *>(&length), sizeof(uint64_t));
+            out_file.write(column_name.data(), length);
+        }
+        return;
+    }
+
+    std::string separator = format_ == Format::Csv ? "," : "   ";
+    for (size_t i = 0; i != column_names_.size(); ++i)
+    {
+        if (format_ == Format::Csv)
+            out_file << (i == 0 ? "" : separator) << column_names_[i];
+        else
+            out_file << "\"" << column_names_[i] << "\"" << separator;
+    }
+    out_file << "\n";
+}
+//=============================================================================================//
+void QuantityRecordBuffer::flush()
+{
+    size_t number_of_columns = column_names_.size();
+    size_t number_of_rows = values_.size() / number_of_columns;
+    if (number_of_rows == 0 && is_file_started_)
+    {
+        return;
+    }
+
+    bool is_appending = is_file_started_ || (is_restarting_ && fs::exists(FileFullPath()));
+    std::ios::openmode mode = is_appending ? std::ios::app : std::ios::trunc;
+    std::ofstream out_file(FileFullPath().c_str(), mode | std::ios::binary);
+    if (!is_appending)
+    {
+        writeHeader(out_file);
+    }
+    is_file_started_ = true;
+
+    if (format_ == Format::Binary)
+    {
+        out_file.write(reinterpret_cast<const char *>(values_.data()),
+                       number_of_rows * number_of_columns * sizeof(double));
+    }
+    else
+    {
+        std::ostringstream rows;
+        std::string separator = format_ == Format::Csv ? "," : "   ";
+        for (size_t row = 0; row != number_of_rows; ++row)
+        {
+            const double *row_values = values_.data() + row * number_of_columns;
+            rows << std::defaultfloat << std::setprecision(6) << row_values[0];
+            rows << std::fixed << std::setprecision(9);
+            for (size_t i = 1; i != number_of_columns; ++i)
+            {
+                rows << separator << row_values[i];
+            }
+            rows << (format_ == Format::Csv ? "\n" : "   \n");
+        }
+        out_file << rows.str();
+    }
+    out_file.close();
+    // an incomplete row, if any, is kept for the next flush
+    values_.erase(values_.begin(), values_.begin() + number_of_rows * number_of_columns);
+}
+//=================================================================================================//
+} // namespace SPH
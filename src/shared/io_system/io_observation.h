@@ -32,9 +32,58 @@
 #include "io_base.h"
 
 #include "io_plt.h"
+#include "io_streaming.h"
 
 namespace SPH
 {
+/**
+ * @class QuantityRecordBuffer
+ * @brief Buffer the rows of recorded quantities in memory and write them to file in batches.
+ * Each row holds the physical time followed by the components of the quantities.
+ * The rows are written when the given number of rows is buffered and at destruction.
+ * The file is truncated at the first write, unless the run is restarting and the file exists,
+ * in which case the rows are appended to the previous history.
+ * The formats are the Tecplot-style ".dat", CSV with a header line (".csv")
+ * and a compact binary table (".bin") which begins with the signature "SPHREC01",
+ * the number of columns as uint64 and the column names as uint64 length and characters,
+ * followed by the rows as float64 values in native byte order.
+ */
+class QuantityRecordBuffer
+{
+  public:
+    enum class Format
+    {
+        Dat,
+        Csv,
+        Binary
+    };
+
+    /** the file extension is given by the format */
+    QuantityRecordBuffer(const std::string &file_path, bool is_restarting,
+                         Format format = Format::Dat, size_t rows_per_flush = 100);
+    ~QuantityRecordBuffer() { flush(); };
+
+    void setFormat(Format format, size_t rows_per_flush);
+    void addColumn(const std::string &quantity_name, const Real &quantity);
+    void addColumn(const std::string &quantity_name, const Vecd &quantity);
+    void beginRow(Real time);
+    void addValue(const Real &quantity) { values_.push_back(quantity); };
+    void addValue(const Vecd &quantity);
+    void flush();
+    std::string FileFullPath();
+
+  protected:
+    std::string file_path_;
+    Format format_;
+    size_t rows_per_flush_;
+    StdVec<std::string> column_names_;
+    StdVec<double> values_;
+    bool is_restarting_;
+    bool is_file_started_;
+
+    void writeHeader(std::ofstream &out_file);
+};
+
 /**
  * @class ObservedQuantityRecording
  * @brief write files for observed quantity
@@ -49,7 +98,7 @@ class ObservedQuantityRecording : public BodyStatesRecording,
     BaseParticles &base_particles_;
     std::string dynamics_identifier_name_;
     const std::string quantity_name_;
-    std::string filefullpath_output_;
+    QuantityRecordBuffer record_buffer_;
 
   public:
     VariableType type_indicator_; /*< this is an indicator to identify the variable type. */
@@ -61,36 +110,35 @@ class ObservedQuantityRecording : public BodyStatesRecording,
           observer_(contact_relation.getSPHBody()), plt_engine_(),
           base_particles_(observer_.getBaseParticles()),
           dynamics_identifier_name_(contact_relation.getSPHBody().getName()),
-          quantity_name_(quantity_name)
+          quantity_name_(quantity_name),
+          record_buffer_(io_environment_.output_folder_ + "/" + dynamics_identifier_name_ + "_" + quantity_name,
+                         sph_system_.RestartStep() != 0)
     {
-        /** Output for .dat file. */
-        filefullpath_output_ = io_environment_.output_folder_ + "/" + dynamics_identifier_name_ + "_" + quantity_name + ".dat";
-        std::ofstream out_file(filefullpath_output_.c_str(), std::ios::app);
-        out_file << "run_time"
-                 << "   ";
         for (size_t i = 0; i != base_particles_.total_real_particles_; ++i)
         {
             std::string quantity_name_i = quantity_name + "[" + std::to_string(i) + "]";
-            plt_engine_.writeAQuantityHeader(out_file, (*this->interpolated_quantities_)[i], quantity_name_i);
+            record_buffer_.addColumn(quantity_name_i, (*this->interpolated_quantities_)[i]);
         }
-        out_file << "\n";
-        out_file.close();
     };
     virtual ~ObservedQuantityRecording(){};
 
     virtual void writeWithFileName(const std::string &sequence) override
     {
         this->exec();
-        std::ofstream out_file(filefullpath_output_.c_str(), std::ios::app);
-        out_file << GlobalStaticVariables::physical_time_ << "   ";
+        record_buffer_.beginRow(GlobalStaticVariables::physical_time_);
         for (size_t i = 0; i != base_particles_.total_real_particles_; ++i)
         {
-            plt_engine_.writeAQuantity(out_file, (*this->interpolated_quantities_)[i]);
+            record_buffer_.addValue((*this->interpolated_quantities_)[i]);
         }
-        out_file << "\n";
-        out_file.close();
     };
 
+    /** choose the file format and how many rows are buffered before writing */
+    void setRecordFormat(QuantityRecordBuffer::Format format, size_t rows_per_flush = 100)
+    {
+        record_buffer_.setFormat(format, rows_per_flush);
+    };
+    void flushRecord() { record_buffer_.flush(); };
+
     StdLargeVec<VariableType> *getObservedQuantity()
     {
         return this->interpolated_quantities_;
@@ -109,7 +157,8 @@ class ReducedQuantityRecording : public BaseIO
     ReduceDynamics<LocalReduceMethodType> reduce_method_;
     std::string dynamics_identifier_name_;
     const std::string quantity_name_;
-    std::string filefullpath_output_;
+    QuantityRecordBuffer record_buffer_;
+    StreamingSink *streaming_sink_ = nullptr;
 
   public:
     /*< deduce variable type from reduce method. */
@@ -122,27 +171,34 @@ class ReducedQuantityRecording : public BaseIO
         : BaseIO(identifier.getSPHBody().getSPHSystem()), plt_engine_(),
           reduce_method_(identifier, std::forward<Args>(args)...),
           dynamics_identifier_name_(reduce_method_.DynamicsIdentifierName()),
-          quantity_name_(reduce_method_.QuantityName())
+          quantity_name_(reduce_method_.QuantityName()),
+          record_buffer_(io_environment_.output_folder_ + "/" + dynamics_identifier_name_ + "_" + quantity_name_,
+                         sph_system_.RestartStep() != 0)
     {
-        /** output for .dat file. */
-        filefullpath_output_ = io_environment_.output_folder_ + "/" + dynamics_identifier_name_ + "_" + quantity_name_ + ".dat";
-        std::ofstream out_file(filefullpath_output_.c_str(), std::ios::app);
-        out_file << "\"run_time\""
-                 << "   ";
-        plt_engine_.writeAQuantityHeader(out_file, reduce_method_.Reference(), quantity_name_);
-        out_file << "\n";
-        out_file.close();
+        record_buffer_.addColumn(quantity_name_, reduce_method_.Reference());
     };
     virtual ~ReducedQuantityRecording(){};
 
     virtual void writeToFile(size_t iteration_step = 0) override
     {
-        std::ofstream out_file(filefullpath_output_.c_str(), std::ios::app);
-        out_file << GlobalStaticVariables::physical_time_ << "   ";
-        plt_engine_.writeAQuantity(out_file, reduce_method_.exec());
-        out_file << "\n";
-        out_file.close();
+        VariableType quantity = reduce_method_.exec();
+        record_buffer_.beginRow(GlobalStaticVariables::physical_time_);
+        record_buffer_.addValue(quantity);
+        if (streaming_sink_ != nullptr)
+        {
+            streaming_sink_->publishQuantity(dynamics_identifier_name_ + "_" + quantity_name_, quantity);
+        }
+    };
+
+    /** also publish the quantity to a streaming sink when it is written */
+    void setStreamingSink(StreamingSink &streaming_sink) { streaming_sink_ = &streaming_sink; };
+
+    /** choose the file format and how many rows are buffered before writing */
+    void setRecordFormat(QuantityRecordBuffer::Format format, size_t rows_per_flush = 100)
+    {
+        record_buffer_.setFormat(format, rows_per_flush);
     };
+    void flushRecord() { record_buffer_.flush(); };
 };
 } // namespace SPH
 #endif // IO_OBSERVATION_H
@@ -0,0 +1,320 @@
+/**
+ * @file 	io_streaming.cpp
+ * @author	Chi Zhang and Xiangyu Hu
+ */
+
+#include "io_streaming.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#define SPHINXSYS_STREAMING_AVAILABLE 1
+#endif
+
+namespace SPH
+{
+//=============================================================================================//
+#ifdef SPHINXSYS_STREAMING_AVAILABLE
+namespace
+{
+/** write to a pipe with SIGPIPE blocked in this thread only, so that a closed reader gives EPIPE
+ *  instead of terminating the run, without changing the signal disposition of the process */
+ssize_t writeWithoutSigpipe(int fd, const char *data, size_t bytes)
+{
+    sigset_t sigpipe_set, previous_set, pending_set;
+    sigemptyset(&sigpipe_set);
+    sigaddset(&sigpipe_set, SIGPIPE);
+    pthread_sigmask(SIG_BLOCK, &sigpipe_set, &previous_set);
+    sigpending(&pending_set);
+    bool was_pending = sigismember(&pending_set, SIGPIPE);
+
+    ssize_t written = write(fd, data, bytes);
+    int write_errno = errno;
+    if (written == -1 && write_errno == EPIPE && !was_pending)
+    {
+        // consume the signal raised by this write before unblocking
+        sigpending(&pending_set);
+        if (sigismember(&pending_set, SIGPIPE))
+        {
+            int signal_number;
+            sigwait(&sigpipe_set, &signal_number);
+        }
+    }
+
+    pthread_sigmask(SIG_SETMASK, &previous_set, nullptr);
+    errno = write_errno;
+    return written;
+}
+} // namespace
+#endif
+//=============================================================================================//
+StreamingSink::StreamingSink(const std::string &path, Transport transport)
+    : path_(path), transport_(transport), listen_fd_(-1), fd_(-1),
+      pending_offset_(0), number_of_dropped_frames_(0)
+{
+#ifdef SPHINXSYS_STREAMING_AVAILABLE
+    if (transport_ == Transport::UnixSocket)
+    {
+        sockaddr_un address;
+        std::memset(&address, 0, sizeof(address));
+        address.sun_family = AF_UNIX;
+        if (path_.size() >= sizeof(address.sun_path))
+        {
+            std::cout << "\n Error: the socket path " << path_ << " is too long!" << std::endl;
+            std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+            exit(1);
+        }
+        std::strncpy(address.sun_path, path_.c_str(), sizeof(address.sun_path) - 1);
+        unlink(path_.c_str());
+        listen_fd_ = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (listen_fd_ == -1 || bind(listen_fd_, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0 ||
+            listen(listen_fd_, 1) != 0)
+        {
+            std::cout << "\n Error: the streaming socket " << path_ << " can not be opened!" << std::endl;
+            std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+            exit(1);
+        }
+        fcntl(listen_fd_, F_SETFL, fcntl(listen_fd_, F_GETFL) | O_NONBLOCK);
+    }
+    else
+    {
+        if (mkfifo(path_.c_str(), 0666) != 0 && errno != EEXIST)
+        {
+            std::cout << "\n Error: the streaming pipe " << path_ << " can not be created!" << std::endl;
+            std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+            exit(1);
+        }
+    }
+#else
+    std::cout << "\n Error: streaming is only available on POSIX systems!" << std::endl;
+    std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+    exit(1);
+#endif
+}
+//=============================================================================================//
+StreamingSink::~StreamingSink()
+{
+#ifdef SPHINXSYS_STREAMING_AVAILABLE
+    disconnectReader();
+    if (listen_fd_ != -1)
+    {
+        close(listen_fd_);
+        unlink(path_.c_str());
+    }
+#endif
+}
+//=============================================================================================//
+void StreamingSink::appendString(std::string &payload, const std::string &value)
+{
+    appendValue<uint32_t>(payload, uint32_t(value.size()));
+    payload.append(value);
+}
+//=============================================================================================//
+bool StreamingSink::connectReader()
+{
+#ifdef SPHINXSYS_STREAMING_AVAILABLE
+    if (fd_ != -1)
+    {
+        return true;
+    }
+
+    if (transport_ == Transport::UnixSocket)
+    {
+        fd_ = accept(listen_fd_, nullptr, nullptr);
+        if (fd_ != -1)
+        {
+            fcntl(fd_, F_SETFL, fcntl(fd_, F_GETFL) | O_NONBLOCK);
+#ifdef SO_NOSIGPIPE
+            int no_sigpipe = 1;
+            setsockopt(fd_, SOL_SOCKET, SO_NOSIGPIPE, &no_sigpipe, sizeof(no_sigpipe));
+#endif
+        }
+    }
+    else
+    {
+        // fails without a reader, which is simply tried again for the next frame
+        fd_ = ::open(path_.c_str(), O_WRONLY | O_NONBLOCK);
+    }
+    pending_bytes_.clear();
+    pending_offset_ = 0;
+    return fd_ != -1;
+#else
+    return false;
+#endif
+}
+//=============================================================================================//
+void StreamingSink::disconnectReader()
+{
+#ifdef SPHINXSYS_STREAMING_AVAILABLE
+    if (fd_ != -1)
+    {
+        close(fd_);
+        fd_ = -1;
+    }
+    pending_bytes_.clear();
+    pending_offset_ = 0;
+#endif
+}
+//=============================================================================================//
+void StreamingSink::writePendingBytes()
+{
+#ifdef SPHINXSYS_STREAMING_AVAILABLE
+#ifdef MSG_NOSIGNAL
+    constexpr int send_flags = MSG_NOSIGNAL;
+#else
+    constexpr int send_flags = 0;
+#endif
+    while (fd_ != -1 && pending_offset_ != pending_bytes_.size())
+    {
+        const char *data = pending_bytes_.data() + pending_offset_;
+        size_t bytes = pending_bytes_.size() - pending_offset_;
+        ssize_t written = transport_ == Transport::UnixSocket ? send(fd_, data, bytes, send_flags)
+                                                              : writeWithoutSigpipe(fd_, data, bytes);
+        if (written > 0)
+        {
+            pending_offset_ += size_t(written);
+        }
+        else if (written == -1 && errno == EINTR)
+        {
+            continue;
+        }
+        else if (written == -1 && (errno == EAGAIN || errno == EWOULDBLOCK))
+        {
+            break;
+        }
+        else
+        {
+            // the reader is gone, wait for the next one
+            disconnectReader();
+        }
+    }
+#endif
+}
+//=============================================================================================//
+bool StreamingSink::isReadyForFrame()
+{
+    if (!connectReader())
+    {
+        return false;
+    }
+    writePendingBytes();
+    return fd_ != -1 && pending_offset_ == pending_bytes_.size();
+}
+//=============================================================================================//
+bool StreamingSink::publishFrame(FrameType frame_type, const std::string &payload)
+{
+    if (!isReadyForFrame())
+    {
+        number_of_dropped_frames_++;
+        return false;
+    }
+
+    pending_bytes_.clear();
+    pending_offset_ = 0;
+    appendValue<uint32_t>(pending_bytes_, 0x53485053); // "SPHS" in little endian
+    appendValue<uint32_t>(pending_bytes_, uint32_t(frame_type));
+    appendValue<uint64_t>(pending_bytes_, payload.size());
+    appendValue<double>(pending_bytes_, GlobalStaticVariables::physical_time_);
+    pending_bytes_.append(payload);
+    writePendingBytes();
+    return true;
+}
+//=============================================================================================//
+void StreamingSink::publishQuantity(const std::string &quantity_name, const Real &quantity)
+{
+    std::string payload;
+    appendString(payload, quantity_name);
+    appendValue<uint32_t>(payload, 1);
+    appendValue<double>(payload, quantity);
+    publishFrame(FrameType::Quantity, payload);
+}
+//=============================================================================================//
+void StreamingSink::publishQuantity(const std::string &quantity_name, const Vecd &quantity)
+{
+    std::string payload;
+    appendString(payload, quantity_name);
+    appendValue<uint32_t>(payload, uint32_t(Dimensions));
+    for (int i = 0; i != Dimensions; ++i)
+    {
+        appendValue<double>(payload, quantity[i]);
+    }
+    publishFrame(FrameType::Quantity, payload);
+}
+//=============================================================================================//
+BodyStatesStreaming::BodyStatesStreaming(SPHBodyVector bodies, StreamingSink &streaming_sink, size_t stride)
+    : BodyStatesRecording(bodies), streaming_sink_(streaming_sink), stride_(SMAX(stride, size_t(1))),
+      real_variables_(bodies.size()), vector_variables_(bodies.size()), storage_real_variables_(bodies.size()) {}
+//=============================================================================================//
+void BodyStatesStreaming::writeWithFileName(const std::string &sequence)
+{
+    for (size_t k = 0; k != bodies_.size(); ++k)
+    {
+        SPHBody *body = bodies_[k];
+        if (!streaming_sink_.isReadyForFrame())
+        {
+            continue;
+        }
+
+        BaseParticles &base_particles = body->getBaseParticles();
+        IndexVector selected_particles;
+        for (size_t i = 0; i != base_particles.total_real_particles_; ++i)
+        {
+            if (base_particles.unsorted_id_[i] % stride_ == 0)
+            {
+                selected_particles.push_back(i);
+            }
+        }
+
+        std::string payload;
+        StreamingSink::appendString(payload, body->getName());
+        StreamingSink::appendValue<uint64_t>(payload, selected_particles.size());
+        StreamingSink::appendValue<uint32_t>(
+            payload, uint32_t(1 + real_variables_[k].size() + storage_real_variables_[k].size() + vector_variables_[k].size()));
+
+        auto appendScalarArray = [&](const std::string &name, const auto &variable)
+        {
+            StreamingSink::appendString(payload, name);
+            StreamingSink::appendValue<uint32_t>(payload, 1);
+            for (size_t index_i : selected_particles)
+            {
+                StreamingSink::appendValue<double>(payload, variable[index_i]);
+            }
+        };
+
+        auto appendVectorArray = [&](const std::string &name, StdLargeVec<Vecd> &variable)
+        {
+            StreamingSink::appendString(payload, name);
+            StreamingSink::appendValue<uint32_t>(payload, 3);
+            for (size_t index_i : selected_particles)
+            {
+                Vec3d value = upgradeToVec3d(variable[index_i]).cast<double>();
+                payload.append(reinterpret_cast<const char *>(value.data()), 3 * sizeof(double));
+            }
+        };
+
+        appendVectorArray("Position", base_particles.pos_);
+        for (auto &variable : real_variables_[k])
+        {
+            appendScalarArray(variable.first, *variable.second);
+        }
+        for (auto &variable : storage_real_variables_[k])
+        {
+            appendScalarArray(variable.first, *variable.second);
+        }
+        for (auto &variable : vector_variables_[k])
+        {
+            appendVectorArray(variable.first, *variable.second);
+        }
+
+        streaming_sink_.publishFrame(StreamingSink::FrameType::ParticleSnapshot, payload);
+    }
+}
+//=================================================================================================//
+} // namespace SPH
@@ -0,0 +1,150 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	io_streaming.h
+ * @brief 	Classes for streaming states to a monitoring process during a run.
+ * @author	Chi Zhang and Xiangyu Hu
+ */
+
+#ifndef IO_STREAMING_H
+#define IO_STREAMING_H
+
+#include "io_base.h"
+
+namespace SPH
+{
+/**
+ * @class StreamingSink
+ * @brief Publish frames of binary data over a Unix domain socket or a named pipe.
+ * For a socket, the sink listens on the given path and a monitoring process connects to it.
+ * For a named pipe, the sink creates the pipe and writes once a monitoring process opens it for reading.
+ * All operations are non-blocking: a frame is dropped when no reader is present
+ * or when the previous frame has not been taken by the reader yet,
+ * so that a slow or absent monitor never stalls the simulation.
+ * A frame begins with the magic "SPHS" as uint32, the frame type as uint32,
+ * the payload size as uint64 and the physical time as float64, followed by the payload.
+ * All values are in native byte order. Streaming is only available on POSIX systems.
+ * See PythonScriptStore/StreamingMonitor/sphinxsys_stream_reader.py for a reader.
+ */
+class StreamingSink
+{
+  public:
+    enum class Transport
+    {
+        UnixSocket,
+        NamedPipe
+    };
+    enum class FrameType : uint32_t
+    {
+        /** the name as uint32 length and characters, the number of values as uint32 and the float64 values */
+        Quantity = 1,
+        /** the body name, the number of particles as uint64, the number of arrays as uint32,
+         *  and for each array its name, the number of components as uint32 and the float64 values */
+        ParticleSnapshot = 2
+    };
+
+    StreamingSink(const std::string &path, Transport transport = Transport::UnixSocket);
+    ~StreamingSink();
+
+    void publishQuantity(const std::string &quantity_name, const Real &quantity);
+    void publishQuantity(const std::string &quantity_name, const Vecd &quantity);
+    /** whether a frame would be taken now, so that preparing a frame to be dropped can be skipped */
+    bool isReadyForFrame();
+    /** publish a complete frame payload, return false if the frame is dropped */
+    bool publishFrame(FrameType frame_type, const std::string &payload);
+    size_t NumberOfDroppedFrames() { return number_of_dropped_frames_; };
+
+    static void appendString(std::string &payload, const std::string &value);
+    template <typename T>
+    static void appendValue(std::string &payload, const T &value)
+    {
+        payload.append(reinterpret_cast<const char *>(&value), sizeof(T));
+    };
+
+  protected:
+    std::string path_;
+    Transport transport_;
+    int listen_fd_;
+    int fd_;
+    std::string pending_bytes_; /**< the last frame, of which the reader has taken the bytes before the offset */
+    size_t pending_offset_;
+    size_t number_of_dropped_frames_;
+
+    bool connectReader();
+    void disconnectReader();
+    /** write as much of the pending bytes as the reader takes without blocking */
+    void writePendingBytes();
+};
+
+/**
+ * @class BodyStatesStreaming
+ * @brief Publish decimated particle snapshots of bodies to a streaming sink.
+ * Only the particles whose original (unsorted) index is a multiple of the stride are published,
+ * with their positions and the variables added for streaming.
+ */
+class BodyStatesStreaming : public BodyStatesRecording
+{
+  public:
+    BodyStatesStreaming(SPHBody &body, StreamingSink &streaming_sink, size_t stride = 1)
+        : BodyStatesStreaming(SPHBodyVector{&body}, streaming_sink, stride){};
+    BodyStatesStreaming(SPHBodyVector bodies, StreamingSink &streaming_sink, size_t stride = 1);
+    virtual ~BodyStatesStreaming(){};
+
+    template <typename DataType>
+    void addVariableToStream(const std::string &variable_name)
+    {
+        static_assert(std::is_same_v<DataType, Real> || std::is_same_v<DataType, StorageReal> ||
+                          std::is_same_v<DataType, Vecd>,
+                      "Only Real, StorageReal and Vecd variables can be streamed.");
+        for (size_t k = 0; k != bodies_.size(); ++k)
+        {
+            StdLargeVec<DataType> *variable = bodies_[k]->getBaseParticles().template getVariableByName<DataType>(variable_name);
+            if (variable == nullptr)
+            {
+                std::cout << "\n Error: the variable '" << variable_name << "' of body '" << bodies_[k]->getName()
+                          << "' can not be streamed!" << std::endl;
+                std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+                exit(1);
+            }
+            if constexpr (std::is_same_v<DataType, Real>)
+                real_variables_[k].push_back(std::make_pair(variable_name, variable));
+            else if constexpr (std::is_same_v<DataType, Vecd>)
+                vector_variables_[k].push_back(std::make_pair(variable_name, variable));
+            else
+                storage_real_variables_[k].push_back(std::make_pair(variable_name, variable));
+        }
+    };
+
+  protected:
+    StreamingSink &streaming_sink_;
+    size_t stride_;
+    /** the variables to stream, resolved for each body */
+    StdVec<StdVec<std::pair<std::string, StdLargeVec<Real> *>>> real_variables_;
+    StdVec<StdVec<std::pair<std::string, StdLargeVec<Vecd> *>>> vector_variables_;
+    /** only used in mixed precision mode, otherwise StorageReal variables are listed as Real ones */
+    StdVec<StdVec<std::pair<std::string, StdLargeVec<StorageReal> *>>> storage_real_variables_;
+
+    virtual void writeWithFileName(const std::string &sequence) override;
+};
+} // namespace SPH
+#endif // IO_STREAMING_H
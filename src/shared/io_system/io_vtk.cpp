@@ -5,13 +5,46 @@
 
 #include "io_vtk.h"
 
+#include "cell_linked_list.hpp"
+
+#include "tbb/parallel_scan.h"
+
 namespace SPH
 {
 //=============================================================================================//
+const std::string VtkPvdCollection::closing_tags_ = "  </Collection>\n</VTKFile>\n";
+//=============================================================================================//
+VtkPvdCollection::VtkPvdCollection(const std::string &output_folder, bool is_relaxation)
+    : output_folder_(output_folder), collection_postfix_(is_relaxation ? "_Relaxation" : "") {}
+//=============================================================================================//
+void VtkPvdCollection::addDataSet(const std::string &file_prefix, Real time, const std::string &file_name)
+{
+    std::string filefullpath = output_folder_ + "/" + file_prefix + collection_postfix_ + ".pvd";
+    if (created_collections_.insert(file_prefix).second)
+    {
+        std::ofstream out_file(filefullpath.c_str(), std::ios::trunc | std::ios::binary);
+        out_file << "<?xml version=\"1.0\"?>\n";
+        out_file << "<VTKFile type=\"Collection\" version=\"0.1\" byte_order=\"LittleEndian\">\n";
+        out_file << "  <Collection>\n";
+        out_file << closing_tags_;
+    }
+
+    std::fstream out_file(filefullpath.c_str(), std::ios::in | std::ios::out | std::ios::binary);
+    out_file.seekp(-std::streamoff(closing_tags_.size()), std::ios::end);
+    out_file << "    <DataSet timestep=\"" << std::setprecision(9) << time
+             << "\" group=\"\" part=\"0\" file=\"" << file_name << "\"/>\n";
+    out_file << closing_tags_;
+}
+//=============================================================================================//
+BodyStatesRecordingToVtp::BodyStatesRecordingToVtp(SPHBodyVector bodies)
+    : BodyStatesRecording(bodies), written_file_names_(bodies.size()),
+      pvd_collection_(io_environment_.output_folder_, sph_system_.RunParticleRelaxation()) {}
+//=============================================================================================//
 void BodyStatesRecordingToVtp::writeWithFileName(const std::string &sequence)
 {
-    for (SPHBody *body : bodies_)
+    for (size_t k = 0; k != bodies_.size(); ++k)
     {
+        SPHBody *body = bodies_[k];
         if (body->checkNewlyUpdated())
         {
             BaseParticles &base_particles = body->getBaseParticles();
@@ -19,7 +52,8 @@ void BodyStatesRecordingToVtp::writeWithFileName(const std::string &sequence)
 
             if (state_recording_)
             {
-                std::string filefullpath = io_environment_.output_folder_ + "/" + body->getName() + "_" + sequence + ".vtp";
+                written_file_names_[k] = body->getName() + "_" + sequence + ".vtp";
+                std::string filefullpath = io_environment_.output_folder_ + "/" + written_file_names_[k];
                 if (fs::exists(filefullpath))
                 {
                     fs::remove(filefullpath);
@@ -80,7 +114,504 @@ void BodyStatesRecordingToVtp::writeWithFileName(const std::string &sequence)
             }
         }
         body->setNotNewlyUpdated();
+
+        if (state_recording_ && !written_file_names_[k].empty())
+        {
+            pvd_collection_.addDataSet(body->getName(), output_time_, written_file_names_[k]);
+        }
+    }
+}
+//=============================================================================================//
+BodyStatesRecordingToVtpBinary::
+    BodyStatesRecordingToVtpBinary(SPHBodyVector bodies, const StdVec<std::string> &output_names,
+                                   VtkAppendedData::Encoding encoding, bool zlib_compression)
+    : BodyStatesRecording(bodies), output_names_(output_names), encoding_(encoding), zlib_compression_(zlib_compression),
+      written_versions_(bodies.size(), MaxSize_t), written_file_names_(bodies.size()),
+      pvd_collection_(io_environment_.output_folder_, sph_system_.RunParticleRelaxation()), number_of_pieces_(1) {}
+//=============================================================================================//
+StdVec<std::string> BodyStatesRecordingToVtpBinary::bodyNames(SPHBodyVector bodies)
+{
+    StdVec<std::string> body_names;
+    for (SPHBody *body : bodies)
+    {
+        body_names.push_back(body->getName());
+    }
+    return body_names;
+}
+//=============================================================================================//
+void BodyStatesRecordingToVtpBinary::setNumberOfPieces(size_t number_of_pieces)
+{
+    flushAsyncWriting();
+    staging_buffers_.clear();
+    number_of_pieces_ = SMAX(number_of_pieces, size_t(1));
+}
+//=============================================================================================//
+void BodyStatesRecordingToVtpBinary::writeWithFileName(const std::string &sequence)
+{
+    size_t buffer_index = background_writer_ != nullptr ? background_writer_->acquireBuffer() : 0;
+    while (staging_buffers_.size() <= buffer_index)
+    {
+        staging_buffers_.emplace_back(bodies_.size() * number_of_pieces_, VtkAppendedData(encoding_, zlib_compression_));
+    }
+    StdVec<VtkAppendedData> &staging_buffer = staging_buffers_[buffer_index];
+
+    std::set<std::string> skipped_variables = skippedVariables();
+    StdVec<size_t> staged_bodies;
+    StdVec<std::string> file_names;
+    for (size_t k = 0; k != bodies_.size(); ++k)
+    {
+        SPHBody *body = bodies_[k];
+        if (body->StateVersion() != written_versions_[k])
+        {
+            body->getBaseParticles().computeDerivedVariables();
+
+            if (state_recording_)
+            {
+                size_t number_of_particles = selectParticles(k);
+                for (size_t p = 0; p != number_of_pieces_; ++p)
+                {
+                    IndexRange piece_range(number_of_particles * p / number_of_pieces_,
+                                           number_of_particles * (p + 1) / number_of_pieces_);
+                    stageBodyStates(*body, piece_range, staging_buffer[k * number_of_pieces_ + p], skipped_variables);
+                }
+                staged_bodies.push_back(k);
+                std::string file_name = output_names_[k] + "_" + sequence;
+                written_file_names_[k] = file_name + (number_of_pieces_ == 1 ? ".vtp" : ".pvtp");
+                file_names.push_back(file_name);
+            }
+            written_versions_[k] = body->StateVersion();
+        }
+        body->setNotNewlyUpdated();
+
+        if (state_recording_ && !written_file_names_[k].empty())
+        {
+            pvd_collection_.addDataSet(output_names_[k], output_time_, written_file_names_[k]);
+        }
+    }
+
+    auto write_task = [this, &staging_buffer, staged_bodies, file_names]()
+    {
+        size_t number_of_pieces = number_of_pieces_;
+        auto pieceFileName = [&](size_t l, size_t p)
+        {
+            return number_of_pieces == 1 ? file_names[l] + ".vtp" : file_names[l] + "_" + std::to_string(p) + ".vtp";
+        };
+
+        parallel_for(
+            IndexRange(0, staged_bodies.size() * number_of_pieces, 1),
+            [&](const IndexRange &r)
+            {
+                for (size_t n = r.begin(); n != r.end(); ++n)
+                {
+                    size_t l = n / number_of_pieces;
+                    size_t p = n % number_of_pieces;
+                    size_t k = staged_bodies[l];
+                    writeVtpFile(io_environment_.output_folder_ + "/" + pieceFileName(l, p), bodies_[k]->getName(),
+                                 staging_buffer[k * number_of_pieces + p]);
+                }
+            });
+
+        if (number_of_pieces != 1)
+        {
+            for (size_t l = 0; l != staged_bodies.size(); ++l)
+            {
+                StdVec<std::string> piece_file_names;
+                for (size_t p = 0; p != number_of_pieces; ++p)
+                {
+                    piece_file_names.push_back(pieceFileName(l, p));
+                }
+                writePvtpFile(io_environment_.output_folder_ + "/" + file_names[l] + ".pvtp", piece_file_names,
+                              staging_buffer[staged_bodies[l] * number_of_pieces]);
+            }
+        }
+    };
+
+    if (background_writer_ != nullptr)
+    {
+        background_writer_->submit(buffer_index, write_task);
+    }
+    else
+    {
+        write_task();
+    }
+}
+//=============================================================================================//
+void BodyStatesRecordingToVtpBinary::
+    stageBodyStates(SPHBody &body, const IndexRange &particle_range,
+                    VtkAppendedData &appended_data, const std::set<std::string> &skipped_variables)
+{
+    BaseParticles &base_particles = body.getBaseParticles();
+    size_t first = particle_range.begin();
+    size_t number_of_particles = particle_range.size();
+    appended_data.clear();
+
+    Real *positions = appended_data.addDataArray<Real>("Position", number_of_particles, 3);
+    particle_for(par, particle_range, [&](size_t i)
+                 { Eigen::Map<Vec3d>(positions + 3 * (i - first)) = upgradeToVec3d(base_particles.pos_[i]); });
+
+    base_particles.writeParticlesToVtkAppendedData(appended_data, particle_range, skipped_variables);
+
+    int *connectivity = appended_data.addDataArray<int>("connectivity", number_of_particles);
+    int *offsets = appended_data.addDataArray<int>("offsets", number_of_particles);
+    particle_for(par, IndexRange(0, number_of_particles),
+                 [&](size_t i)
+                 {
+                     connectivity[i] = int(i);
+                     offsets[i] = int(i + 1);
+                 });
+}
+//=============================================================================================//
+void BodyStatesRecordingToVtpBinary::
+    writeVtpFile(const std::string &filefullpath, const std::string &body_name, VtkAppendedData &appended_data)
+{
+    // the positions are the first and the vertex cells the last two arrays
+    size_t end_point_data = appended_data.size() - 2;
+    size_t total_real_particles = appended_data.NumberOfTuples(0);
+    appended_data.encodeDataArrays();
+
+    std::ofstream out_file(filefullpath.c_str(), std::ios::trunc | std::ios::binary);
+    out_file << "<?xml version=\"1.0\"?>\n";
+    out_file << "<VTKFile type=\"PolyData\" version=\"1.0\" byte_order=\"LittleEndian\"";
+    appended_data.writeFileAttributes(out_file);
+    out_file << ">\n";
+    out_file << " <PolyData>\n";
+    out_file << "  <Piece Name =\"" << body_name << "\" NumberOfPoints=\"" << total_real_particles
+             << "\" NumberOfVerts=\"" << total_real_particles << "\">\n";
+
+    out_file << "   <Points>\n";
+    appended_data.writeDataArray(out_file, 0);
+    out_file << "   </Points>\n";
+
+    out_file << "   <PointData  Vectors=\"vector\">\n";
+    for (size_t k = 1; k != end_point_data; ++k)
+    {
+        appended_data.writeDataArray(out_file, k);
+    }
+    out_file << "   </PointData>\n";
+
+    out_file << "   <Verts>\n";
+    appended_data.writeDataArray(out_file, end_point_data);
+    appended_data.writeDataArray(out_file, end_point_data + 1);
+    out_file << "   </Verts>\n";
+
+    out_file << "  </Piece>\n";
+    out_file << " </PolyData>\n";
+    appended_data.writeAppendedData(out_file);
+    out_file << "</VTKFile>\n";
+
+    out_file.close();
+}
+//=============================================================================================//
+void BodyStatesRecordingToVtpBinary::writePvtpFile(const std::string &filefullpath, const StdVec<std::string> &piece_file_names,
+                                                   const VtkAppendedData &appended_data)
+{
+    size_t end_point_data = appended_data.size() - 2;
+
+    std::ofstream out_file(filefullpath.c_str(), std::ios::trunc);
+    out_file << "<?xml version=\"1.0\"?>\n";
+    out_file << "<VTKFile type=\"PPolyData\" version=\"1.0\" byte_order=\"LittleEndian\"";
+    appended_data.writeFileAttributes(out_file);
+    out_file << ">\n";
+    out_file << " <PPolyData GhostLevel=\"0\">\n";
+
+    out_file << "  <PPoints>\n";
+    appended_data.writePDataArray(out_file, 0);
+    out_file << "  </PPoints>\n";
+
+    out_file << "  <PPointData  Vectors=\"vector\">\n";
+    for (size_t k = 1; k != end_point_data; ++k)
+    {
+        appended_data.writePDataArray(out_file, k);
     }
+    out_file << "  </PPointData>\n";
+
+    for (const std::string &piece_file_name : piece_file_names)
+    {
+        out_file << "  <Piece Source=\"" << piece_file_name << "\"/>\n";
+    }
+
+    out_file << " </PPolyData>\n";
+    out_file << "</VTKFile>\n";
+
+    out_file.close();
+}
+//=============================================================================================//
+BodyPartStatesRecordingToVtp::
+    BodyPartStatesRecordingToVtp(BodyPartByParticle &body_part, VtkAppendedData::Encoding encoding, bool zlib_compression)
+    : BodyStatesRecordingToVtpBinary({&body_part.getSPHBody()},
+                                     {body_part.getSPHBody().getName() + "_" + body_part.getName()},
+                                     encoding, zlib_compression),
+      base_particles_(body_part.getSPHBody().getBaseParticles()), stride_(1), subsampling_fraction_(1.0)
+{
+    tag_particles_ = [&](StdLargeVec<size_t> &is_selected)
+    {
+        // the body part holds original particle ids, and buffer particles are not written
+        IndexVector &body_part_particles = body_part.LoopRange();
+        StdLargeVec<ParticleIndex> &sorted_id = base_particles_.sorted_id_;
+        size_t total_real_particles = base_particles_.total_real_particles_;
+        particle_for(par, IndexRange(0, body_part_particles.size()),
+                     [&](size_t n)
+                     {
+                         size_t index_i = sorted_id[body_part_particles[n]];
+                         if (index_i < total_real_particles)
+                             is_selected[index_i] = 1;
+                     });
+    };
+}
+//=============================================================================================//
+BodyPartStatesRecordingToVtp::
+    BodyPartStatesRecordingToVtp(BodyPartByCell &body_part, VtkAppendedData::Encoding encoding, bool zlib_compression)
+    : BodyStatesRecordingToVtpBinary({&body_part.getSPHBody()},
+                                     {body_part.getSPHBody().getName() + "_" + body_part.getName()},
+                                     encoding, zlib_compression),
+      base_particles_(body_part.getSPHBody().getBaseParticles()), stride_(1), subsampling_fraction_(1.0)
+{
+    tag_particles_ = [&](StdLargeVec<size_t> &is_selected)
+    {
+        ConcurrentCellLists &body_part_cells = body_part.LoopRange();
+        parallel_for(
+            IndexRange(0, body_part_cells.size()),
+            [&](const IndexRange &r)
+            {
+                for (size_t n = r.begin(); n != r.end(); ++n)
+                {
+                    for (size_t index_i : *body_part_cells[n])
+                    {
+                        is_selected[index_i] = 1;
+                    }
+                }
+            });
+    };
+}
+//=============================================================================================//
+BodyPartStatesRecordingToVtp::
+    BodyPartStatesRecordingToVtp(SPHBody &sph_body, Shape &shape, VtkAppendedData::Encoding encoding, bool zlib_compression)
+    : BodyStatesRecordingToVtpBinary({&sph_body}, {sph_body.getName() + "_" + shape.getName()},
+                                     encoding, zlib_compression),
+      base_particles_(sph_body.getBaseParticles()), stride_(1), subsampling_fraction_(1.0)
+{
+    tag_particles_ = [&](StdLargeVec<size_t> &is_selected)
+    {
+        StdLargeVec<Vecd> &pos = base_particles_.pos_;
+        particle_for(par, IndexRange(0, base_particles_.total_real_particles_),
+                     [&](size_t i)
+                     { is_selected[i] = shape.checkContain(pos[i]) ? 1 : 0; });
+    };
+}
+//=============================================================================================//
+bool BodyPartStatesRecordingToVtp::isSampled(size_t original_index)
+{
+    if (original_index % stride_ != 0)
+    {
+        return false;
+    }
+    if (subsampling_fraction_ >= 1.0)
+    {
+        return true;
+    }
+    // splitmix64 hashing mapped to a uniform value in [0, 1)
+    uint64_t hash = uint64_t(original_index) + 0x9E3779B97F4A7C15ULL;
+    hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBULL;
+    hash = hash ^ (hash >> 31);
+    return Real(hash >> 11) * Real(1.0 / 9007199254740992.0) < subsampling_fraction_;
+}
+//=============================================================================================//
+size_t BodyPartStatesRecordingToVtp::selectParticles(size_t body_index)
+{
+    size_t total_real_particles = base_particles_.total_real_particles_;
+    is_selected_.resize(total_real_particles);
+    selected_offsets_.resize(total_real_particles);
+    particle_for(par, IndexRange(0, total_real_particles), [&](size_t i)
+                 { is_selected_[i] = 0; });
+    tag_particles_(is_selected_);
+
+    StdLargeVec<ParticleIndex> &unsorted_id = base_particles_.unsorted_id_;
+    particle_for(par, IndexRange(0, total_real_particles),
+                 [&](size_t i)
+                 {
+                     if (is_selected_[i] == 1 && !isSampled(unsorted_id[i]))
+                         is_selected_[i] = 0;
+                 });
+
+    // exclusive prefix sum giving the position of each selected particle in the compacted list
+    size_t number_of_selected = tbb::parallel_scan(
+        IndexRange(0, total_real_particles), size_t(0),
+        [&](const IndexRange &r, size_t sum, bool is_final_scan)
+        {
+            for (size_t i = r.begin(); i != r.end(); ++i)
+            {
+                if (is_final_scan)
+                    selected_offsets_[i] = sum;
+                sum += is_selected_[i];
+            }
+            return sum;
+        },
+        [](size_t left, size_t right)
+        { return left + right; });
+
+    selected_particles_.resize(number_of_selected);
+    particle_for(par, IndexRange(0, total_real_particles),
+                 [&](size_t i)
+                 {
+                     if (is_selected_[i] == 1)
+                         selected_particles_[selected_offsets_[i]] = i;
+                 });
+    return number_of_selected;
+}
+//=============================================================================================//
+void BodyPartStatesRecordingToVtp::
+    stageBodyStates(SPHBody &body, const IndexRange &particle_range,
+                    VtkAppendedData &appended_data, const std::set<std::string> &skipped_variables)
+{
+    size_t first = particle_range.begin();
+    size_t number_of_particles = particle_range.size();
+    appended_data.clear();
+
+    Real *positions = appended_data.addDataArray<Real>("Position", number_of_particles, 3);
+    particle_for(par, particle_range,
+                 [&](size_t n)
+                 { Eigen::Map<Vec3d>(positions + 3 * (n - first)) = upgradeToVec3d(base_particles_.pos_[selected_particles_[n]]); });
+
+    base_particles_.writeParticlesToVtkAppendedData(appended_data, selected_particles_, particle_range, skipped_variables);
+
+    int *connectivity = appended_data.addDataArray<int>("connectivity", number_of_particles);
+    int *offsets = appended_data.addDataArray<int>("offsets", number_of_particles);
+    particle_for(par, IndexRange(0, number_of_particles),
+                 [&](size_t i)
+                 {
+                     connectivity[i] = int(i);
+                     offsets[i] = int(i + 1);
+                 });
+}
+//=============================================================================================//
+ParticleToGridRecording::
+    ParticleToGridRecording(RealBody &real_body, const std::string &grid_name, const Vecd &grid_origin,
+                            const Vecd &grid_spacing, const Arrayi &number_of_grid_points,
+                            VtkAppendedData::Encoding encoding, bool zlib_compression)
+    : BodyStatesRecording(real_body), real_body_(real_body), base_particles_(real_body.getBaseParticles()),
+      kernel_(*real_body.sph_adaptation_->getKernel()), grid_name_(grid_name),
+      grid_origin_(grid_origin), grid_spacing_(grid_spacing), number_of_grid_points_(number_of_grid_points),
+      appended_data_(encoding, zlib_compression),
+      pvd_collection_(io_environment_.output_folder_, sph_system_.RunParticleRelaxation()) {}
+//=============================================================================================//
+Vecd ParticleToGridRecording::GridPointPosition(size_t grid_point_index)
+{
+    Vecd position = grid_origin_;
+    for (int d = 0; d != Dimensions; ++d)
+    {
+        position[d] += Real(grid_point_index % number_of_grid_points_[d]) * grid_spacing_[d];
+        grid_point_index /= number_of_grid_points_[d];
+    }
+    return position;
+}
+//=============================================================================================//
+void ParticleToGridRecording::sampleOnGridPoints()
+{
+    size_t total_grid_points = number_of_grid_points_.prod();
+    appended_data_.clear();
+    Real *weight_sum = appended_data_.addDataArray<Real>("KernelWeightSum", total_grid_points);
+    StdVec<Real *> real_data;
+    for (auto &variable : real_variables_)
+    {
+        real_data.push_back(appended_data_.addDataArray<Real>(variable.first, total_grid_points));
+    }
+    /** the variables in storage precision are also sampled in Real */
+    for (auto &variable : storage_real_variables_)
+    {
+        real_data.push_back(appended_data_.addDataArray<Real>(variable.first, total_grid_points));
+    }
+    StdVec<Real *> vector_data;
+    for (auto &variable : vector_variables_)
+    {
+        vector_data.push_back(appended_data_.addDataArray<Real>(variable.first, total_grid_points, 3));
+    }
+
+    StdLargeVec<StorageReal> &Vol = base_particles_.Vol_;
+    StdVec<CellLinkedList *> cell_linked_lists = real_body_.getCellLinkedList().CellLinkedListLevels();
+    Real cutoff_radius = kernel_.CutOffRadius();
+    parallel_for(
+        IndexRange(0, total_grid_points),
+        [&](const IndexRange &r)
+        {
+            for (size_t i = r.begin(); i != r.end(); ++i)
+            {
+                Vecd position = GridPointPosition(i);
+                Real ttl_weight(0);
+                for (size_t k = 0; k != real_data.size(); ++k)
+                    real_data[k][i] = 0.0;
+                for (size_t k = 0; k != vector_data.size(); ++k)
+                    Eigen::Map<Vec3d>(vector_data[k] + 3 * i) = Vec3d::Zero();
+
+                for (CellLinkedList *cell_linked_list : cell_linked_lists)
+                {
+                    int search_depth = int(std::ceil(cutoff_radius / cell_linked_list->GridSpacing()));
+                    cell_linked_list->forEachListDataAroundPosition(
+                        position, search_depth,
+                        [&](const ListData &list_data)
+                        {
+                            Vecd displacement = position - list_data.second;
+                            Real distance = displacement.norm();
+                            if (distance < cutoff_radius)
+                            {
+                                size_t index_j = list_data.first;
+                                Real weight_j = kernel_.W(distance, displacement) * Vol[index_j];
+                                ttl_weight += weight_j;
+                                for (size_t k = 0; k != real_variables_.size(); ++k)
+                                    real_data[k][i] += weight_j * (*real_variables_[k].second)[index_j];
+                                for (size_t k = 0; k != storage_real_variables_.size(); ++k)
+                                    real_data[real_variables_.size() + k][i] += weight_j * (*storage_real_variables_[k].second)[index_j];
+                                for (size_t k = 0; k != vector_data.size(); ++k)
+                                    Eigen::Map<Vec3d>(vector_data[k] + 3 * i) +=
+                                        weight_j * upgradeToVec3d((*vector_variables_[k].second)[index_j]);
+                            }
+                        });
+                }
+
+                weight_sum[i] = ttl_weight;
+                for (size_t k = 0; k != real_data.size(); ++k)
+                    real_data[k][i] /= ttl_weight + TinyReal;
+                for (size_t k = 0; k != vector_data.size(); ++k)
+                    Eigen::Map<Vec3d>(vector_data[k] + 3 * i) /= ttl_weight + TinyReal;
+            }
+        });
+}
+//=============================================================================================//
+void ParticleToGridRecording::writeWithFileName(const std::string &sequence)
+{
+    sampleOnGridPoints();
+    appended_data_.encodeDataArrays();
+
+    std::string file_name = real_body_.getName() + "_" + grid_name_ + "_" + sequence + ".vti";
+    std::ofstream out_file((io_environment_.output_folder_ + "/" + file_name).c_str(), std::ios::trunc | std::ios::binary);
+    Vec3d origin = upgradeToVec3d(grid_origin_);
+    Vec3d spacing = upgradeToVec3d(grid_spacing_);
+    std::ostringstream extent;
+    for (int d = 0; d != 3; ++d)
+    {
+        extent << (d == 0 ? "0 " : " 0 ") << (d < Dimensions ? number_of_grid_points_[d] - 1 : 0);
+    }
+    out_file << "<?xml version=\"1.0\"?>\n";
+    out_file << "<VTKFile type=\"ImageData\" version=\"1.0\" byte_order=\"LittleEndian\"";
+    appended_data_.writeFileAttributes(out_file);
+    out_file << ">\n";
+    out_file << "<ImageData WholeExtent=\"" << extent.str() << "\" Origin=\""
+             << origin[0] << " " << origin[1] << " " << origin[2] << "\" Spacing=\""
+             << spacing[0] << " " << spacing[1] << " " << spacing[2] << "\">\n";
+    out_file << "<Piece Extent=\"" << extent.str() << "\">\n";
+    out_file << "<PointData>\n";
+    for (size_t k = 0; k != appended_data_.size(); ++k)
+    {
+        appended_data_.writeDataArray(out_file, k);
+    }
+    out_file << "</PointData>\n";
+    out_file << "</Piece>\n";
+    out_file << "</ImageData>\n";
+    appended_data_.writeAppendedData(out_file);
+    out_file << "</VTKFile>\n";
+    out_file.close();
+
+    pvd_collection_.addDataSet(real_body_.getName() + "_" + grid_name_, output_time_, file_name);
 }
 //=============================================================================================//
 void BodyStatesRecordingToVtpString::writeWithFileName(const std::string &sequence)
@@ -35,20 +35,194 @@ using VtuStringData = std::map<std::string, std::string>;
 
 namespace SPH
 {
+/**
+ * @class VtkPvdCollection
+ * @brief ParaView collection files listing the data files of a recorder by time,
+ * one for each prefix of the file names, e.g. a body name, saved as <prefix>.pvd,
+ * or <prefix>_Relaxation.pvd for the recorders of particle relaxation.
+ * A collection file is only created at its first data set,
+ * so that a recorder not writing does not overwrite the collection of another one.
+ * The file is kept valid after each addition by overwriting only its closing tags,
+ * so that the cost of maintaining it does not grow with the number of outputs.
+ */
+class VtkPvdCollection
+{
+  public:
+    VtkPvdCollection(const std::string &output_folder, bool is_relaxation);
+    void addDataSet(const std::string &file_prefix, Real time, const std::string &file_name);
+
+  protected:
+    std::string output_folder_;
+    std::string collection_postfix_;
+    std::set<std::string> created_collections_;
+    static const std::string closing_tags_;
+};
+
 /**
  * @class BodyStatesRecordingToVtp
  * @brief  Write files for bodies
  * the output file is VTK XML format can visualized by ParaView the data type vtkPolyData
+ * The files of each body are listed by physical time in the .pvd collection of the body.
  */
 class BodyStatesRecordingToVtp : public BodyStatesRecording
 {
   public:
-    BodyStatesRecordingToVtp(SPHBody &body) : BodyStatesRecording(body){};
-    BodyStatesRecordingToVtp(SPHBodyVector bodies) : BodyStatesRecording(bodies){};
+    BodyStatesRecordingToVtp(SPHBody &body) : BodyStatesRecordingToVtp(SPHBodyVector{&body}){};
+    BodyStatesRecordingToVtp(SPHBodyVector bodies);
     virtual ~BodyStatesRecordingToVtp(){};
 
   protected:
+    StdVec<std::string> written_file_names_;
+    VtkPvdCollection pvd_collection_;
+
+    virtual void writeWithFileName(const std::string &sequence) override;
+};
+
+/**
+ * @class BodyStatesRecordingToVtpBinary
+ * @brief  Write binary files for bodies.
+ * The output file is VTK XML format with vtkPolyData type.
+ * All data arrays, including positions and vertex cells,
+ * are saved in the appended section as raw binary or base64,
+ * with their native Float32/Float64/Int32 types, and optionally compressed by zlib.
+ * The arrays are staged before writing, so that asynchronous writing is supported.
+ * A body is written only if its state version has changed since its last output,
+ * otherwise its last file is referred again in the .pvd collection of the body.
+ * The variables with output intervals are skipped in the outputs between the intervals.
+ * Optionally, a body is split into pieces of contiguous particle ranges,
+ * which are written in parallel as separate files indexed by a .pvtp file.
+ */
+class BodyStatesRecordingToVtpBinary : public BodyStatesRecording
+{
+  public:
+    BodyStatesRecordingToVtpBinary(SPHBody &body, VtkAppendedData::Encoding encoding = VtkAppendedData::Encoding::Raw,
+                                   bool zlib_compression = false)
+        : BodyStatesRecordingToVtpBinary(SPHBodyVector{&body}, encoding, zlib_compression){};
+    BodyStatesRecordingToVtpBinary(SPHBodyVector bodies, VtkAppendedData::Encoding encoding = VtkAppendedData::Encoding::Raw,
+                                   bool zlib_compression = false)
+        : BodyStatesRecordingToVtpBinary(bodies, bodyNames(bodies), encoding, zlib_compression){};
+    virtual ~BodyStatesRecordingToVtpBinary() { flushAsyncWriting(); };
+    /** write each body as given number of pieces, e.g. the number of threads */
+    void setNumberOfPieces(size_t number_of_pieces);
+    virtual bool isAsyncWritingSupported() override { return true; };
+
+  protected:
+    /** the file names of each body begin with the given output name */
+    BodyStatesRecordingToVtpBinary(SPHBodyVector bodies, const StdVec<std::string> &output_names,
+                                   VtkAppendedData::Encoding encoding, bool zlib_compression);
+    StdVec<std::string> output_names_;
+    VtkAppendedData::Encoding encoding_;
+    bool zlib_compression_;
+    StdVec<size_t> written_versions_;
+    StdVec<std::string> written_file_names_;
+    VtkPvdCollection pvd_collection_;
+    size_t number_of_pieces_;
+    /** staging buffers of all pieces of all bodies,
+     *  deque is used so that growing does not move the buffers in use */
+    std::deque<StdVec<VtkAppendedData>> staging_buffers_;
+
+    static StdVec<std::string> bodyNames(SPHBodyVector bodies);
+    virtual void writeWithFileName(const std::string &sequence) override;
+    /** select the particles to be written and return their number */
+    virtual size_t selectParticles(size_t body_index) { return bodies_[body_index]->getBaseParticles().total_real_particles_; };
+    /** stage the states of the particles in the given range of the selected particles */
+    virtual void stageBodyStates(SPHBody &body, const IndexRange &particle_range,
+                                 VtkAppendedData &appended_data, const std::set<std::string> &skipped_variables);
+    void writeVtpFile(const std::string &filefullpath, const std::string &body_name, VtkAppendedData &appended_data);
+    void writePvtpFile(const std::string &filefullpath, const StdVec<std::string> &piece_file_names,
+                       const VtkAppendedData &appended_data);
+};
+
+/**
+ * @class BodyPartStatesRecordingToVtp
+ * @brief Write binary files for the particles of a body within a body part or a shape.
+ * It is intended for frequent output of a region of interest, while the full body is written rarely.
+ * The particles can be further decimated by a stride or a random subsampling fraction.
+ * Both are applied to the original (unsorted) particle index, so that the same particles are kept over time.
+ * The particles are tagged in parallel and the selected ones are compacted into a list by a prefix sum.
+ */
+class BodyPartStatesRecordingToVtp : public BodyStatesRecordingToVtpBinary
+{
+  public:
+    BodyPartStatesRecordingToVtp(BodyPartByParticle &body_part,
+                                 VtkAppendedData::Encoding encoding = VtkAppendedData::Encoding::Raw,
+                                 bool zlib_compression = false);
+    BodyPartStatesRecordingToVtp(BodyPartByCell &body_part,
+                                 VtkAppendedData::Encoding encoding = VtkAppendedData::Encoding::Raw,
+                                 bool zlib_compression = false);
+    BodyPartStatesRecordingToVtp(SPHBody &sph_body, Shape &shape,
+                                 VtkAppendedData::Encoding encoding = VtkAppendedData::Encoding::Raw,
+                                 bool zlib_compression = false);
+    virtual ~BodyPartStatesRecordingToVtp(){};
+    /** write only the particles whose original index is a multiple of the stride */
+    void setStride(size_t stride) { stride_ = SMAX(stride, size_t(1)); };
+    /** write only the given fraction of particles, chosen by hashing the original index */
+    void setRandomSubsampling(Real fraction) { subsampling_fraction_ = fraction; };
+
+  protected:
+    BaseParticles &base_particles_;
+    std::function<void(StdLargeVec<size_t> &)> tag_particles_;
+    size_t stride_;
+    Real subsampling_fraction_;
+    StdLargeVec<size_t> is_selected_;
+    StdLargeVec<size_t> selected_offsets_;
+    IndexVector selected_particles_;
+
+    bool isSampled(size_t original_index);
+    virtual size_t selectParticles(size_t body_index) override;
+    virtual void stageBodyStates(SPHBody &body, const IndexRange &particle_range,
+                                 VtkAppendedData &appended_data, const std::set<std::string> &skipped_variables) override;
+};
+
+/**
+ * @class ParticleToGridRecording
+ * @brief Write particle variables of a body resampled onto a Cartesian grid as VTK image data (.vti).
+ * The value at a grid point is gathered from the particles found by the cell linked list of the body,
+ * weighted by the kernel and particle volume, and normalized by the weight sum (Shepard normalization).
+ * The weight sum is also written so that the grid points without particles nearby can be masked.
+ * A slice plane is a grid with a single grid point along one axis.
+ * The files are listed by time in a .pvd collection.
+ */
+class ParticleToGridRecording : public BodyStatesRecording
+{
+  public:
+    ParticleToGridRecording(RealBody &real_body, const std::string &grid_name, const Vecd &grid_origin,
+                            const Vecd &grid_spacing, const Arrayi &number_of_grid_points,
+                            VtkAppendedData::Encoding encoding = VtkAppendedData::Encoding::Raw,
+                            bool zlib_compression = false);
+    virtual ~ParticleToGridRecording(){};
+
+    template <typename DataType>
+    void addVariableToSample(const std::string &variable_name)
+    {
+        StdLargeVec<DataType> *variable = base_particles_.getVariableByName<DataType>(variable_name);
+        if constexpr (std::is_same_v<DataType, Real>)
+            real_variables_.push_back(std::make_pair(variable_name, variable));
+        else if constexpr (std::is_same_v<DataType, StorageReal>)
+            storage_real_variables_.push_back(std::make_pair(variable_name, variable));
+        else
+            vector_variables_.push_back(std::make_pair(variable_name, variable));
+    };
+
+  protected:
+    RealBody &real_body_;
+    BaseParticles &base_particles_;
+    Kernel &kernel_;
+    std::string grid_name_;
+    Vecd grid_origin_;
+    Vecd grid_spacing_;
+    Arrayi number_of_grid_points_;
+    VtkAppendedData appended_data_;
+    VtkPvdCollection pvd_collection_;
+    StdVec<std::pair<std::string, StdLargeVec<Real> *>> real_variables_;
+    /** scalars stored in float, which is only the case in mixed precision mode */
+    StdVec<std::pair<std::string, StdLargeVec<StorageReal> *>> storage_real_variables_;
+    StdVec<std::pair<std::string, StdLargeVec<Vecd> *>> vector_variables_;
+
     virtual void writeWithFileName(const std::string &sequence) override;
+    /** grid points are numbered with the first axis running fastest, as in VTK image data */
+    Vecd GridPointPosition(size_t grid_point_index);
+    void sampleOnGridPoints();
 };
 
 /**
@@ -18,12 +18,13 @@ Real GeneralContinuum::getLambda(Real youngs_modulus, Real poisson_ratio)
     return nu_ * youngs_modulus / (1.0 + poisson_ratio) / (1.0 - 2.0 * poisson_ratio);
 }
 //=================================================================================================//
-Matd GeneralContinuum::ConstitutiveRelationShearStress(Matd &velocity_gradient, Matd &shear_stress)
+SymMatd GeneralContinuum::ConstitutiveRelationShearStress(Matd &velocity_gradient, SymMatd &shear_stress)
 {
-    Matd strain_rate = 0.5 * (velocity_gradient + velocity_gradient.transpose());
+    SymMatd strain_rate(velocity_gradient);
     Matd spin_rate = 0.5 * (velocity_gradient - velocity_gradient.transpose());
-    Matd deviatoric_strain_rate = strain_rate - (1.0 / (Real)Dimensions) * strain_rate.trace() * Matd::Identity();
-    Matd stress_rate = 2.0 * G_ * deviatoric_strain_rate + shear_stress * (spin_rate.transpose()) + spin_rate * shear_stress;
+    SymMatd deviatoric_strain_rate = strain_rate.deviatoric();
+    /** spin_rate * shear_stress is the transpose of shear_stress * spin_rate^T, so their sum is twice its symmetric part. */
+    SymMatd stress_rate = 2.0 * G_ * deviatoric_strain_rate + 2.0 * SymMatd(Matd(shear_stress * Matd(spin_rate.transpose())));
     return stress_rate;
 }
 //=================================================================================================//
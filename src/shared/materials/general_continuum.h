@@ -64,7 +64,7 @@ class GeneralContinuum : public WeaklyCompressibleFluid
 
     Real ContactStiffness() { return contact_stiffness_; };
 
-    virtual Matd ConstitutiveRelationShearStress(Matd &velocity_gradient, Matd &shear_stress);
+    virtual SymMatd ConstitutiveRelationShearStress(Matd &velocity_gradient, SymMatd &shear_stress);
 
     virtual GeneralContinuum *ThisObjectPtr() override { return this; };
 };
@@ -37,8 +37,9 @@ namespace SPH
 struct FluidStateIn
 {
     Vecd &vel_;
-    Real &rho_, &p_;
-    FluidStateIn(Real &rho, Vecd &vel, Real &p) : vel_(vel), rho_(rho), p_(p){};
+    Real &rho_;
+    Real p_; /**< a copy, as pressure may be stored in lower precision */
+    FluidStateIn(Real &rho, Vecd &vel, Real p) : vel_(vel), rho_(rho), p_(p){};
 };
 
 struct FluidStateOut
@@ -129,6 +129,9 @@ class CellLinkedList : public BaseCellLinkedList, public Mesh
     template <class DynamicsRange, typename GetSearchDepth, typename GetNeighborRelation>
     void searchNeighborsByParticles(DynamicsRange &dynamics_range, ParticleConfiguration &particle_configuration,
                                     GetSearchDepth &get_search_depth, GetNeighborRelation &get_neighbor_relation);
+    /** apply a function to the list data in the cells within the search depth around a position */
+    template <typename FunctionOnListData>
+    void forEachListDataAroundPosition(const Vecd &position, int search_depth, const FunctionOnListData &function);
 };
 
 /**
@@ -36,7 +36,6 @@
 #include <algorithm>
 #include <fstream>
 #include <functional>
-#include <mutex>
 using namespace std::placeholders;
 
 namespace SPH
@@ -76,7 +75,7 @@ void package_parallel_for(const ConcurrentVec<DataPackageType *> &data_pkgs,
 class BaseDataPackage
 {
   public:
-    BaseDataPackage() : cell_index_on_mesh_(Arrayi::Zero()), state_indicator_(0){};
+    BaseDataPackage() : package_id_(0), cell_index_on_mesh_(Arrayi::Zero()), state_indicator_(0){};
     virtual ~BaseDataPackage(){};
     void setInnerPackage() { state_indicator_ = 1; };
     bool isInnerPackage() { return state_indicator_ != 0; };
@@ -84,8 +83,11 @@ class BaseDataPackage
     bool isCorePackage() { return state_indicator_ == 2; };
     void setCellIndexOnMesh(const Arrayi &cell_index) { cell_index_on_mesh_ = cell_index; }
     Arrayi CellIndexOnMesh() const { return cell_index_on_mesh_; }
+    void setPackageId(size_t package_id) { package_id_ = package_id; }
+    size_t PackageId() const { return package_id_; }
 
   protected:
+    size_t package_id_;         /**< dense id of this data package in the memory pool of the mesh. */
     Arrayi cell_index_on_mesh_; /**< index of this data package on the background mesh, zero if it is not on the mesh. */
     /** reserved value: 0 not occupying background mesh, 1 occupying.
      *  guide to use: larger for high priority of the data package. */
@@ -101,6 +103,9 @@ class BaseDataPackage
  * the DataLowerBound() locates the first data for initialization.
  * Also note that, as a inner package is contained in a background mesh cell,
  * it will be constructed based on the grid position (lower-left corner) of the cell.
+ * The data of a mesh variable for all packages are saved in a package data array indexed by package id,
+ * which is owned by the mesh. A package only keeps the ids of its neighbor packages,
+ * by which the data with address index, i.e. including the buffer, are found by index arithmetic.
  */
 template <int PKG_SIZE, int ADDRS_BUFFER>
 class GridDataPackage : public BaseDataPackage, public BaseMesh
@@ -110,14 +115,85 @@ class GridDataPackage : public BaseDataPackage, public BaseMesh
     static constexpr int pkg_addrs_size = PKG_SIZE + ADDRS_BUFFER * 2;
     static constexpr int pkg_addrs_buffer = ADDRS_BUFFER;
     static constexpr int pkg_ops_end = PKG_SIZE + pkg_addrs_buffer;
+    /** number of the packages in the neighborhood, including the package itself. */
+    static constexpr int number_of_neighbor_pkgs = Dimensions == 2 ? 9 : 27;
+    using NeighborPackageIds = std::array<size_t, number_of_neighbor_pkgs>;
     template <typename DataType>
     using PackageData = PackageDataMatrix<DataType, PKG_SIZE>;
+    /** Data of a mesh variable for all packages, indexed by package id. */
     template <typename DataType>
-    using PackageDataAddress = PackageDataMatrix<DataType *, pkg_addrs_size>;
+    using PackageDataArray = ConcurrentVec<PackageData<DataType>>;
     /** Matrix data for temporary usage. Note that it is array with pkg_addrs_size.  */
     template <typename DataType>
     using PackageTemporaryData = PackageDataMatrix<DataType, pkg_addrs_size>;
 
+    /**
+     * @class PackageDataAddress
+     * @brief Accessor of the data of a package with address index.
+     * It is used as a matrix of data addresses, i.e. *pkg_data_addrs[i][j] in 2D,
+     * but the address is computed from the neighbor package ids instead of being saved.
+     */
+    template <typename DataType>
+    class PackageDataAddress
+    {
+        template <int Depth>
+        class SubscriptProxy
+        {
+            const PackageDataAddress &pkg_data_addrs_;
+            Arrayi addrs_index_;
+
+          public:
+            SubscriptProxy(const PackageDataAddress &pkg_data_addrs, const Arrayi &addrs_index)
+                : pkg_data_addrs_(pkg_data_addrs), addrs_index_(addrs_index){};
+            auto operator[](int index) const
+            {
+                Arrayi addrs_index = addrs_index_;
+                addrs_index[Depth] = index;
+                if constexpr (Depth == Dimensions - 1)
+                    return pkg_data_addrs_.DataAddress(addrs_index);
+                else
+                    return SubscriptProxy<Depth + 1>(pkg_data_addrs_, addrs_index);
+            };
+        };
+
+        template <int Depth, typename MatrixType>
+        static DataType &DataFromIndex(MatrixType &data, const Arrayi &data_index)
+        {
+            if constexpr (Depth == Dimensions - 1)
+                return data[data_index[Depth]];
+            else
+                return DataFromIndex<Depth + 1>(data[data_index[Depth]], data_index);
+        };
+
+        PackageDataArray<DataType> &pkg_data_array_;
+        const NeighborPackageIds &neighbor_pkg_ids_;
+
+      public:
+        PackageDataAddress(PackageDataArray<DataType> &pkg_data_array, const NeighborPackageIds &neighbor_pkg_ids)
+            : pkg_data_array_(pkg_data_array), neighbor_pkg_ids_(neighbor_pkg_ids){};
+
+        DataType *DataAddress(const Arrayi &addrs_index) const
+        {
+            // the address index is non-negative, so that the unsigned division and modulo reduce to bit operations
+            int neighbor = 0;
+            Arrayi data_index = Arrayi::Zero();
+            for (int n = 0; n != Dimensions; ++n)
+            {
+                unsigned int shifted_index = addrs_index[n] + pkg_size - pkg_addrs_buffer;
+                data_index[n] = shifted_index % pkg_size;
+                neighbor = 3 * neighbor + shifted_index / pkg_size;
+            }
+            return &DataFromIndex<0>(pkg_data_array_[neighbor_pkg_ids_[neighbor]], data_index);
+        };
+
+        SubscriptProxy<1> operator[](int index) const
+        {
+            Arrayi addrs_index = Arrayi::Zero();
+            addrs_index[0] = index;
+            return SubscriptProxy<1>(*this, addrs_index);
+        };
+    };
+
     /** Default constructor for singular package */
     GridDataPackage() : BaseDataPackage(), BaseMesh(pkg_addrs_size * Arrayi::Ones()){};
     /** Constructor for inner package */
@@ -140,18 +216,19 @@ class GridDataPackage : public BaseDataPackage, public BaseMesh
     PackageData<DataType> &getPackageData(const MeshVariable<DataType> &mesh_variable)
     {
         constexpr int type_index = DataTypeIndex<DataType>::value;
-        return std::get<type_index>(all_pkg_data_)[mesh_variable.IndexInContainer()];
+        return std::get<type_index>(*all_pkg_data_)[mesh_variable.IndexInContainer()][package_id_];
     };
     /** access specific package data address with mesh variable */
     template <typename DataType>
-    PackageDataAddress<DataType> &getPackageDataAddress(const MeshVariable<DataType> &mesh_variable)
+    PackageDataAddress<DataType> getPackageDataAddress(const MeshVariable<DataType> &mesh_variable)
     {
         constexpr int type_index = DataTypeIndex<DataType>::value;
-        return std::get<type_index>(all_pkg_data_addrs_)[mesh_variable.IndexInContainer()];
+        return PackageDataAddress<DataType>(
+            std::get<type_index>(*all_pkg_data_)[mesh_variable.IndexInContainer()], neighbor_pkg_ids_);
     };
     /** probe by applying bi and tri-linear interpolation within the package. */
     template <typename DataType>
-    DataType probeDataPackage(PackageDataAddress<DataType> &pkg_data_addrs, const Vecd &position);
+    DataType probeDataPackage(const PackageDataAddress<DataType> &pkg_data_addrs, const Vecd &position);
     /** assign value to data package according to the position of data */
     template <typename DataType, typename FunctionByPosition>
     void assignByPosition(const MeshVariable<DataType> &mesh_variable,
@@ -162,12 +239,12 @@ class GridDataPackage : public BaseDataPackage, public BaseMesh
                          const MeshVariable<OutDataType> &out_variable);
     /** obtain averaged value at a corner of a data cell */
     template <typename DataType>
-    DataType CornerAverage(PackageDataAddress<DataType> &pkg_data_addrs,
+    DataType CornerAverage(const PackageDataAddress<DataType> &pkg_data_addrs,
                            Arrayi addrs_index, Arrayi corner_direction);
 
   protected:
-    DataContainerAssemble<PackageData> all_pkg_data_;
-    DataContainerAssemble<PackageDataAddress> all_pkg_data_addrs_;
+    DataContainerAssemble<PackageDataArray> *all_pkg_data_ = nullptr;
+    NeighborPackageIds neighbor_pkg_ids_;
 
     /** lower bound coordinate for the data as reference */
     Vecd DataLowerBound() { return mesh_lower_bound_ + grid_spacing_ * Vecd::Ones() * (Real)pkg_addrs_buffer; };
@@ -175,50 +252,33 @@ class GridDataPackage : public BaseDataPackage, public BaseMesh
     template <typename DataType>
     struct AllVariablesAllocation
     {
-        void operator()(DataContainerAssemble<PackageData> &all_pkg_data,
-                        DataContainerAssemble<PackageDataAddress> &all_pkg_data_addrs,
-                        const MeshVariableAssemble &all_mesh_variables_)
+        void operator()(DataContainerAssemble<PackageDataArray> &all_pkg_data, size_t package_id)
         {
             constexpr int type_index = DataTypeIndex<DataType>::value;
-            size_t total_variables = std::get<type_index>(all_mesh_variables_).size();
-            std::get<type_index>(all_pkg_data).resize(total_variables);
-            std::get<type_index>(all_pkg_data_addrs).resize(total_variables);
+            for (PackageDataArray<DataType> &pkg_data_array : std::get<type_index>(all_pkg_data))
+            {
+                pkg_data_array.grow_to_at_least(package_id + 1);
+            }
         };
     };
     DataAssembleOperation<AllVariablesAllocation> allocate_all_variables_;
-    /** set the initial package data address for singular data package */
-    template <typename DataType>
-    struct AssignSingularPackageDataAddress
-    {
-        void operator()(DataContainerAssemble<PackageData> &all_pkg_data,
-                        DataContainerAssemble<PackageDataAddress> &all_pkg_data_addrs);
-    };
-    DataAssembleOperation<AssignSingularPackageDataAddress> assign_singular_pkg_data_addrs_;
-    /** assign address for all package data when the package is an inner one */
-    template <typename DataType>
-    struct AssignPackageDataAddress
-    {
-        void operator()(DataContainerAssemble<PackageDataAddress> &all_pkg_data_addrs,
-                        const Arrayi &addrs_index,
-                        DataContainerAssemble<PackageData> &all_pkg_data,
-                        const Arrayi &data_index);
-    };
-    DataAssembleOperation<AssignPackageDataAddress> assign_pkg_data_addrs_;
 
   public:
-    void allocateAllVariables(const MeshVariableAssemble &all_mesh_variables_)
+    void allocateAllVariables(DataContainerAssemble<PackageDataArray> &all_pkg_data)
     {
-        allocate_all_variables_(all_pkg_data_, all_pkg_data_addrs_, all_mesh_variables_);
+        all_pkg_data_ = &all_pkg_data;
+        allocate_all_variables_(all_pkg_data, package_id_);
     };
 
+    /** set all neighbors to the package itself, used for singular data package */
     void assignSingularPackageDataAddress()
     {
-        assign_singular_pkg_data_addrs_(all_pkg_data_, all_pkg_data_addrs_);
+        neighbor_pkg_ids_.fill(package_id_);
     };
 
-    void assignPackageDataAddress(const Arrayi &addrs_index, GridDataPackage *src_pkg, const Arrayi &data_index)
+    void assignNeighborPackageId(int neighbor, size_t neighbor_pkg_id)
     {
-        assign_pkg_data_addrs_(all_pkg_data_addrs_, addrs_index, src_pkg->all_pkg_data_, data_index);
+        neighbor_pkg_ids_[neighbor] = neighbor_pkg_id;
     };
 };
 
@@ -260,6 +320,8 @@ class MeshWithGridDataPackages : public Mesh
   protected:
     MeshVariableAssemble all_mesh_variables_;              /**< all mesh variables on this mesh. */
     MyMemoryPool<GridDataPackageType> data_pkg_pool_;      /**< memory pool for all packages in the mesh. */
+    /** data of all mesh variables for all packages, indexed by package id. */
+    DataContainerAssemble<GridDataPackageType::template PackageDataArray> all_pkg_data_;
     MeshDataMatrix<GridDataPackageType *> data_pkg_addrs_; /**< Address of data packages. */
     ConcurrentVec<GridDataPackageType *> inner_data_pkgs_; /**< Inner data packages which is able to carry out spatial operations. */
     /** Singular data packages. provided for far field condition with usually only two values.
@@ -270,7 +332,6 @@ class MeshWithGridDataPackages : public Mesh
     static constexpr int pkg_ops_end = GridDataPackageType::pkg_ops_end;           /**< the size of operation loops. */
     static constexpr int pkg_addrs_size = GridDataPackageType::pkg_addrs_size;     /**< the size of address matrix in the data packages. */
     const Real data_spacing_;                                                      /**< spacing of data in the data packages*/
-    std::mutex mutex_my_pool;                                                      /**< mutex exclusion for memory pool */
     BaseMesh global_mesh_;                                                         /**< the mesh for the locations of all possible data points. */
 
     void allocateMeshDataMatrix(); /**< allocate memories for addresses of data packages. */
@@ -285,6 +346,8 @@ class MeshWithGridDataPackages : public Mesh
         {
             constexpr int type_index = DataTypeIndex<DataType>::value;
             size_t new_variable_index = std::get<type_index>(all_mesh_variables_).size();
+            // the package data array is allocated for all existing packages when the variable is registered
+            std::get<type_index>(all_pkg_data_).emplace_back().grow_to_at_least(NumberOfDataPackages());
             return addVariableToAssemble<DataType>(all_mesh_variables_, mesh_variable_ptrs_,
                                                    variable_name, new_variable_index);
         }
@@ -296,8 +359,10 @@ class MeshWithGridDataPackages : public Mesh
         const DataContainerAddressAssemble<MeshVariable> &all_mesh_variables_,
         const InitializeSingularData &initialize_singular_data)
     {
-        GridDataPackageType *new_data_pkg = data_pkg_pool_.malloc();
-        new_data_pkg->allocateAllVariables(all_mesh_variables_);
+        size_t package_id = data_pkg_pool_.allocate();
+        GridDataPackageType *new_data_pkg = &data_pkg_pool_[package_id];
+        new_data_pkg->setPackageId(package_id);
+        new_data_pkg->allocateAllVariables(all_pkg_data_);
         initialize_singular_data(new_data_pkg);
         new_data_pkg->assignSingularPackageDataAddress();
         singular_data_pkgs_addrs_.push_back(new_data_pkg);
@@ -309,12 +374,12 @@ class MeshWithGridDataPackages : public Mesh
         const Arrayi &cell_index,
         const InitializePackageData &initialize_package_data)
     {
-        mutex_my_pool.lock();
         Vecd cell_position = CellPositionFromIndex(cell_index);
         Vecd grid_position = GridPositionFromCellPosition(cell_position);
-        GridDataPackageType *new_data_pkg = data_pkg_pool_.malloc(grid_position, data_spacing_);
-        mutex_my_pool.unlock();
-        new_data_pkg->allocateAllVariables(all_mesh_variables_);
+        size_t package_id = data_pkg_pool_.allocate(grid_position, data_spacing_);
+        GridDataPackageType *new_data_pkg = &data_pkg_pool_[package_id];
+        new_data_pkg->setPackageId(package_id);
+        new_data_pkg->allocateAllVariables(all_pkg_data_);
         initialize_package_data(new_data_pkg);
         new_data_pkg->setCellIndexOnMesh(cell_index);
         assignDataPackageAddress(cell_index, new_data_pkg);
@@ -324,6 +389,10 @@ class MeshWithGridDataPackages : public Mesh
     void assignDataPackageAddress(const Arrayi &cell_index, GridDataPackageType *data_pkg);
     /** Return data package with given cell index. */
     GridDataPackageType *DataPackageFromCellIndex(const Arrayi &cell_index);
+    /** Return data package with given package id. */
+    GridDataPackageType *DataPackageFromId(size_t package_id) { return &data_pkg_pool_[package_id]; };
+    /** Return the number of all data packages, which is also the upper bound of package ids. */
+    size_t NumberOfDataPackages() { return data_pkg_pool_.capacity(); };
     void initializePackageAddressesInACell(const Arrayi &cell_index);
     /** Find related cell index and data index for a data package address matrix */
     std::pair<int, int> CellShiftAndDataIndex(int data_addrs_index_component)
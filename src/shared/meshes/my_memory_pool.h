@@ -22,82 +22,73 @@
  * ------------------------------------------------------------------------- */
 /**
  * @file 	my_memory_pool.h
- * @brief 	A class template for scalable memory allocation from memory blocks provided by an underlying allocator.
- * @details A memory_pool allocates and frees memory in a way that scales with the number of processors.
- *			The memory is obtained as big chunks from an underlying allocator specified by the template argument.
- *			The latter must satisfy the subset of the allocator requirements from the [allocator.requirements] ISO C++ Standard section.
- *			A memory_pool meet the Memory Pool named requirement.
+ * @brief 	A class template for scalable memory allocation of data packages from contiguous memory blocks.
+ * @details The nodes are saved in a concurrent vector, whose segments are contiguous memory blocks
+ *			with increasing size and whose elements are never relocated when it grows.
+ *			Therefore, nodes can be allocated concurrently without locking and
+ *			each node is addressable by a dense integer id, i.e. its index in the concurrent vector.
+ *			Relinquished nodes are recycled through a concurrent queue of free ids.
  * @author	Chi Zhang and Xiangyu Hu
  */
 
 #ifndef MY_MEMORY_POOL_H
 #define MY_MEMORY_POOL_H
 
-#define TBB_PREVIEW_MEMORY_POOL 1
+#include "tbb/concurrent_queue.h"
+#include "tbb/concurrent_vector.h"
 
-#include "tbb/enumerable_thread_specific.h"
-#include "tbb/memory_pool.h"
-
-#include <list>
+#include <new>
 
 /**
  * @class MyMemoryPool
- * @brief Note that the data package T should has a default constructor.
+ * @brief Note that the data package T should be constructible with the arguments given to malloc.
  */
 template <class T>
 class MyMemoryPool
 {
-
-#ifdef __EMSCRIPTEN__
-    std::allocator<T> my_pool; /**< memory pool. */
-    std::list<T> data_list;    /**< list of all nodes allocated. */
-#else
-    tbb::memory_pool<std::allocator<T>> my_pool;            /**< memory pool. */
-    typedef tbb::memory_pool_allocator<T> pool_allocator_t; /**< memory allocator. */
-    std::list<T, pool_allocator_t> data_list;               /**< list of all nodes allocated. */
-#endif
-    std::list<T *> free_list; /**< list of all free nodes. */
+    tbb::concurrent_vector<T> data_blocks_; /**< all nodes allocated, in contiguous blocks. */
+    tbb::concurrent_queue<size_t> free_ids_; /**< ids of all free nodes. */
 
   public:
-#ifdef __EMSCRIPTEN__
-    MyMemoryPool() : data_list(my_pool){};
-#else
-    MyMemoryPool() : data_list(pool_allocator_t(my_pool)){};
-#endif
+    MyMemoryPool(){};
+    ~MyMemoryPool(){};
 
-    ~MyMemoryPool(){
-        // my_pool.recycle();
-    };
-    /**  Prepare an available node. */
+    /** Prepare an available node and return its id. Thread safe. */
     template <typename... Args>
-    T *malloc(Args &&...args)
+    size_t allocate(Args &&...args)
     {
-        if (free_list.empty())
-        {
-            data_list.emplace_back(std::forward<Args>(args)...);
-            return (&data_list.back());
-        }
-        else
+        size_t id = 0;
+        if (free_ids_.try_pop(id))
         {
-            T *result = free_list.front();
-            free_list.pop_front();
-            return result;
+            T *recycled = &data_blocks_[id];
+            recycled->~T();
+            new (recycled) T(std::forward<Args>(args)...);
+            return id;
         }
+        return data_blocks_.emplace_back(std::forward<Args>(args)...) - data_blocks_.begin();
+    };
+    /** Prepare an available node and return its address. Thread safe. */
+    template <typename... Args>
+    T *malloc(Args &&...args)
+    {
+        return &data_blocks_[allocate(std::forward<Args>(args)...)];
     };
     /** Relinquish an unused node. */
-    void free(T *ptr)
+    void free(size_t id)
     {
-        free_list.push_back(ptr);
+        free_ids_.push(id);
     };
-    /** Return the total number of nodes allocated. */
-    int capacity()
+    /** Access a node by its id. */
+    T &operator[](size_t id) { return data_blocks_[id]; };
+    /** Return the total number of nodes allocated, also the upper bound of ids. */
+    size_t capacity()
     {
-        return data_list.size();
+        return data_blocks_.size();
     };
     /** Return the number of current available nodes. */
-    int available_node()
+    size_t available_node()
     {
-        return free_list.size();
+        return free_ids_.unsafe_size();
     };
 };
 
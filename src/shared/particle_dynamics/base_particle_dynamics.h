@@ -115,8 +115,8 @@ class DataDelegateSimple
 
   protected:
     ParticlesType *particles_;
-    StdLargeVec<size_t> &sorted_id_;
-    StdLargeVec<size_t> &unsorted_id_;
+    StdLargeVec<ParticleIndex> &sorted_id_;
+    StdLargeVec<ParticleIndex> &unsorted_id_;
 };
 
 /**
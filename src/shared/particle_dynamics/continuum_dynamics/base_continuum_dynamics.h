@@ -60,7 +60,8 @@ class InteractionWithWall : public BaseInteractionType<FSIContactData>
 
   protected:
     StdVec<StdLargeVec<Vecd> *> wall_vel_ave_, wall_force_ave_, wall_n_;
-    StdVec<StdLargeVec<Real> *> wall_mass_, wall_Vol_;
+    StdVec<StdLargeVec<Real> *> wall_mass_;
+    StdVec<StdLargeVec<StorageReal> *> wall_Vol_;
 };
 } // namespace continuum_dynamics
 } // namespace SPH
@@ -25,7 +25,7 @@ void ShearAccelerationRelaxation::interaction(size_t index_i, Real dt)
         size_t index_j = inner_neighborhood.j_[n];
         Real r_ij = inner_neighborhood.r_ij_[n];
         Real dW_ijV_j = inner_neighborhood.dW_ij_[n] * Vol_[index_j];
-        Vecd &e_ij = inner_neighborhood.e_ij_[n];
+        const Vecd &e_ij = inner_neighborhood.e_ij_[n];
         Real eta_ij = 2 * (0.7 * (Real)Dimensions + 2.1) * (vel_[index_i] - vel_[index_j]).dot(e_ij) / (r_ij + TinyReal);
         acceleration += eta_ij * dW_ijV_j * e_ij;
     }
@@ -56,24 +56,22 @@ void ShearStressRelaxation::interaction(size_t index_i, Real dt)
     {
         size_t index_j = inner_neighborhood.j_[n];
         Real dW_ijV_j = inner_neighborhood.dW_ij_[n] * Vol_[index_i];
-        Vecd &e_ij = inner_neighborhood.e_ij_[n];
+        const Vecd &e_ij = inner_neighborhood.e_ij_[n];
         Vecd v_ij = vel_[index_i] - vel_[index_j];
         velocity_gradient -= v_ij * (B_[index_i] * e_ij * dW_ijV_j).transpose();
     }
     velocity_gradient_[index_i] = velocity_gradient;
     /*calculate strain*/
-    Matd strain_rate = 0.5 * (velocity_gradient + velocity_gradient.transpose());
-    strain_tensor_rate_[index_i] = strain_rate;
+    strain_tensor_rate_[index_i] = SymMatd(velocity_gradient);
     strain_tensor_[index_i] += strain_tensor_rate_[index_i] * 0.5 * dt;
-    Matd strain_i = strain_tensor_[index_i];
-    von_mises_strain_[index_i] = getVonMisesStressFromMatrix(strain_i);
+    von_mises_strain_[index_i] = getVonMisesStressFromMatrix(strain_tensor_[index_i]);
 }
 //====================================================================================//
 void ShearStressRelaxation::update(size_t index_i, Real dt)
 {
     shear_stress_rate_[index_i] = continuum_.ConstitutiveRelationShearStress(velocity_gradient_[index_i], shear_stress_[index_i]);
     shear_stress_[index_i] += shear_stress_rate_[index_i] * dt * 0.5;
-    Matd stress_tensor_i = shear_stress_[index_i] - p_[index_i] * Matd::Identity();
+    SymMatd stress_tensor_i = shear_stress_[index_i] - p_[index_i] * SymMatd::Identity();
     von_mises_stress_[index_i] = getVonMisesStressFromMatrix(stress_tensor_i);
 }
 //====================================================================================//
@@ -88,8 +86,8 @@ void StressDiffusion::interaction(size_t index_i, Real dt)
     Vecd acc_prior_i = force_prior_[index_i] / mass_[index_i];
     Real gravity = abs(acc_prior_i(1, 0));
     Real density = plastic_continuum_.getDensity();
-    Mat3d diffusion_stress_rate_ = Mat3d::Zero();
-    Mat3d diffusion_stress_ = Mat3d::Zero();
+    SymMat3d diffusion_stress_rate_ = SymMat3d::Zero();
+    SymMat3d diffusion_stress_ = SymMat3d::Zero();
     Neighborhood &inner_neighborhood = inner_configuration_[index_i];
     for (size_t n = 0; n != inner_neighborhood.current_size_; ++n)
     {
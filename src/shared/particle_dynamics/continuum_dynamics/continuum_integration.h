@@ -52,7 +52,7 @@ class ContinuumInitialCondition : public LocalDynamics, public PlasticContinuumD
 
   protected:
     StdLargeVec<Vecd> &pos_, &vel_;
-    StdLargeVec<Mat3d> &stress_tensor_3D_;
+    StdLargeVec<SymMat3d> &stress_tensor_3D_;
 };
 
 template <class FluidDynamicsType>
@@ -79,7 +79,7 @@ class ShearAccelerationRelaxation : public fluid_dynamics::BaseIntegration<Conti
   protected:
     GeneralContinuum &continuum_;
     Real G_, smoothing_length_;
-    StdLargeVec<Matd> &shear_stress_;
+    StdLargeVec<SymMatd> &shear_stress_;
     StdLargeVec<Vecd> &acc_shear_;
 };
 
@@ -94,8 +94,11 @@ class ShearStressRelaxation : public fluid_dynamics::BaseIntegration<ContinuumDa
 
   protected:
     GeneralContinuum &continuum_;
-    StdLargeVec<Matd> &shear_stress_, &shear_stress_rate_, &velocity_gradient_, &strain_tensor_, &strain_tensor_rate_;
-    StdLargeVec<Real> &von_mises_stress_, &von_mises_strain_, &Vol_;
+    StdLargeVec<SymMatd> &shear_stress_, &shear_stress_rate_;
+    StdLargeVec<Matd> &velocity_gradient_;
+    StdLargeVec<SymMatd> &strain_tensor_, &strain_tensor_rate_;
+    StdLargeVec<Real> &von_mises_stress_, &von_mises_strain_;
+    StdLargeVec<StorageReal> &Vol_;
     StdLargeVec<Matd> &B_;
 };
 
@@ -109,8 +112,8 @@ class BasePlasticIntegration : public fluid_dynamics::BaseIntegration<DataDelega
 
   protected:
     PlasticContinuum &plastic_continuum_;
-    StdLargeVec<Mat3d> &stress_tensor_3D_, &strain_tensor_3D_, &stress_rate_3D_, &strain_rate_3D_;
-    StdLargeVec<Mat3d> &elastic_strain_tensor_3D_, &elastic_strain_rate_3D_;
+    StdLargeVec<SymMat3d> &stress_tensor_3D_, &strain_tensor_3D_, &stress_rate_3D_, &strain_rate_3D_;
+    StdLargeVec<SymMat3d> &elastic_strain_tensor_3D_, &elastic_strain_rate_3D_;
     StdLargeVec<Matd> &velocity_gradient_;
 };
 
@@ -173,7 +176,8 @@ class PlasticIntegration2ndHalf<Inner<>, RiemannSolverType>
   protected:
     RiemannSolverType riemann_solver_;
     StdLargeVec<Real> &acc_deviatoric_plastic_strain_, &vertical_stress_;
-    StdLargeVec<Real> &Vol_, &mass_;
+    StdLargeVec<StorageReal> &Vol_;
+    StdLargeVec<Real> &mass_;
     Real E_, nu_;
 };
 using PlasticIntegration2ndHalfInnerNoRiemann = PlasticIntegration2ndHalf<Inner<>, NoRiemannSolver>;
@@ -63,7 +63,7 @@ void PlasticIntegration1stHalf<Inner<>, RiemannSolverType>::interaction(size_t i
     Vecd force = Vecd::Zero();
     Real rho_dissipation(0);
     Real rho_i = rho_[index_i];
-    Matd stress_tensor_i = degradeToMatd(stress_tensor_3D_[index_i]); 
+    Matd stress_tensor_i = degradeToMatd(stress_tensor_3D_[index_i].toMatrix()); 
     const Neighborhood &inner_neighborhood = inner_configuration_[index_i];
 
     for (size_t n = 0; n != inner_neighborhood.current_size_; ++n)
@@ -71,7 +71,7 @@ void PlasticIntegration1stHalf<Inner<>, RiemannSolverType>::interaction(size_t i
         size_t index_j = inner_neighborhood.j_[n];
         Real dW_ijV_j = inner_neighborhood.dW_ij_[n] * Vol_[index_j];
         Vecd nablaW_ijV_j = inner_neighborhood.dW_ij_[n]  * Vol_[index_j] * inner_neighborhood.e_ij_[n];
-        Matd stress_tensor_j = degradeToMatd(stress_tensor_3D_[index_j]);
+        Matd stress_tensor_j = degradeToMatd(stress_tensor_3D_[index_j].toMatrix());
         force += mass_[index_i] * rho_[index_j] * ((stress_tensor_i + stress_tensor_j) / (rho_i * rho_[index_j])) * nablaW_ijV_j;
         rho_dissipation += riemann_solver_.DissipativeUJump(p_[index_i] - p_[index_j]) * dW_ijV_j;
     }
@@ -97,17 +97,17 @@ void PlasticIntegration1stHalf<Contact<Wall>, RiemannSolverType>::interaction(si
     Vecd force_prior_i = computeNonConservativeForce(index_i);
     Vecd force = force_prior_i;
     Real rho_dissipation(0);
-    Matd stress_tensor_i = degradeToMatd(stress_tensor_3D_[index_i]);
+    Matd stress_tensor_i = degradeToMatd(stress_tensor_3D_[index_i].toMatrix());
     for (size_t k = 0; k < this->contact_configuration_.size(); ++k)
     {
         StdLargeVec<Vecd> &force_ave_k = *(wall_force_ave_[k]);
         StdLargeVec<Real> &wall_mass_k = *(wall_mass_[k]);
-        StdLargeVec<Real>& wall_Vol_k = *(wall_Vol_[k]);
+        StdLargeVec<StorageReal>& wall_Vol_k = *(wall_Vol_[k]);
         Neighborhood &wall_neighborhood = (*contact_configuration_[k])[index_i];
         for (size_t n = 0; n != wall_neighborhood.current_size_; ++n)
         {
             size_t index_j = wall_neighborhood.j_[n];
-            Vecd &e_ij = wall_neighborhood.e_ij_[n];
+            const Vecd &e_ij = wall_neighborhood.e_ij_[n];
             Real dW_ijV_j = wall_neighborhood.dW_ij_[n] * wall_Vol_k[index_j];
             Real r_ij = wall_neighborhood.r_ij_[n];
             Real face_wall_external_acceleration = (force_prior_i / mass_[index_i] - force_ave_k[index_j] / wall_mass_k[index_j]).dot(-e_ij);
@@ -167,21 +167,22 @@ void PlasticIntegration2ndHalf<Inner<>, RiemannSolverType>::update(size_t index_
     rho_[index_i] += drho_dt_[index_i] * dt * 0.5;
     Vol_[index_i] = mass_[index_i] / rho_[index_i];
     Mat3d velocity_gradient = upgradeToMat3d(velocity_gradient_[index_i]); 
-    Mat3d stress_tensor_rate_3D_ = plastic_continuum_.ConstitutiveRelation(velocity_gradient, stress_tensor_3D_[index_i]);
-    stress_rate_3D_[index_i] += stress_tensor_rate_3D_;
+    Mat3d stress_tensor = stress_tensor_3D_[index_i].toMatrix();
+    Mat3d stress_tensor_rate_3D_ = plastic_continuum_.ConstitutiveRelation(velocity_gradient, stress_tensor);
+    stress_rate_3D_[index_i] += SymMat3d(stress_tensor_rate_3D_);
     stress_tensor_3D_[index_i] += stress_rate_3D_[index_i] * dt;
     /*return mapping*/
-    Mat3d stress_tensor_ = plastic_continuum_.ReturnMapping(stress_tensor_3D_[index_i]);
-    stress_tensor_3D_[index_i] = stress_tensor_;
+    stress_tensor = stress_tensor_3D_[index_i].toMatrix();
+    stress_tensor_3D_[index_i] = SymMat3d(plastic_continuum_.ReturnMapping(stress_tensor));
     vertical_stress_[index_i] = stress_tensor_3D_[index_i](1, 1);
-    strain_rate_3D_[index_i] = 0.5 * (velocity_gradient + velocity_gradient.transpose());
+    strain_rate_3D_[index_i] = SymMat3d(velocity_gradient);
     strain_tensor_3D_[index_i] += strain_rate_3D_[index_i] * dt;
     /*calculate elastic strain*/
-    Mat3d deviatoric_stress = stress_tensor_3D_[index_i] - (1.0 / 3.0) * stress_tensor_3D_[index_i].trace() * Mat3d::Identity();
+    SymMat3d deviatoric_stress = stress_tensor_3D_[index_i].deviatoric();
     Real hydrostatic_pressure = (1.0 / 3.0) * stress_tensor_3D_[index_i].trace();
     elastic_strain_tensor_3D_[index_i] = deviatoric_stress / (2.0 * plastic_continuum_.getShearModulus(E_, nu_)) +
-                                         hydrostatic_pressure * Mat3d::Identity() / (9.0 * plastic_continuum_.getBulkModulus(E_, nu_));
-    Mat3d plastic_strain_tensor_3D = strain_tensor_3D_[index_i] - elastic_strain_tensor_3D_[index_i];
+                                         hydrostatic_pressure * SymMat3d::Identity() / (9.0 * plastic_continuum_.getBulkModulus(E_, nu_));
+    SymMat3d plastic_strain_tensor_3D = strain_tensor_3D_[index_i] - elastic_strain_tensor_3D_[index_i];
     acc_deviatoric_plastic_strain_[index_i] = particles_->getDeviatoricPlasticStrain(plastic_strain_tensor_3D);
 }
 //=================================================================================================//
@@ -202,12 +203,12 @@ void PlasticIntegration2ndHalf<Contact<Wall>, RiemannSolverType>::interaction(si
     {
         StdLargeVec<Vecd> &vel_ave_k = *(wall_vel_ave_[k]);
         StdLargeVec<Vecd> &n_k = *(wall_n_[k]);
-        StdLargeVec<Real>& wall_Vol_k = *(wall_Vol_[k]);
+        StdLargeVec<StorageReal>& wall_Vol_k = *(wall_Vol_[k]);
         Neighborhood &wall_neighborhood = (*contact_configuration_[k])[index_i];
         for (size_t n = 0; n != wall_neighborhood.current_size_; ++n)
         {
             size_t index_j = wall_neighborhood.j_[n];
-            Vecd &e_ij = wall_neighborhood.e_ij_[n];
+            const Vecd &e_ij = wall_neighborhood.e_ij_[n];
             Real dW_ijV_j = wall_neighborhood.dW_ij_[n] * wall_Vol_k[index_j];
             Vecd vel_in_wall = 2.0 * vel_ave_k[index_j] - vel_[index_i];
             density_change_rate += (vel_[index_i] - vel_in_wall).dot(e_ij) * dW_ijV_j;
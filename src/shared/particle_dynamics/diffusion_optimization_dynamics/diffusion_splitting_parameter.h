@@ -69,7 +69,8 @@ class ParameterSplittingByPDEWithBoundary
 
   protected:
     StdVec<StdLargeVec<Vecd> *> boundary_normal_vector_;
-    StdVec<StdLargeVec<Real> *> boundary_heat_flux_, boundary_Vol_;
+    StdVec<StdLargeVec<Real> *> boundary_heat_flux_;
+    StdVec<StdLargeVec<StorageReal> *> boundary_Vol_;
     StdVec<StdVec<StdLargeVec<Real>> *> boundary_species_;
     virtual ErrorAndParameters<VariableType> computeErrorAndParameters(size_t index_i, Real dt = 0.0) override;
 };
@@ -94,7 +94,7 @@ void ParameterSplittingByPDEInner<ParticlesType, VariableType>::interaction(size
         Neighborhood &inner_neighborhood = this->inner_configuration_[index_i];
         for (size_t n = 0; n != inner_neighborhood.current_size_; ++n)
         {
-            size_t &index_j = inner_neighborhood.j_[n];
+            size_t index_j = inner_neighborhood.j_[n];
             this->variable_[index_j] = this->parameter_recovery_[index_j];
         }
 
@@ -114,7 +114,7 @@ void ParameterSplittingByPDEInner<ParticlesType, VariableType>::interaction(size
             Neighborhood &inner_neighborhood = this->inner_configuration_[index_i];
             for (size_t n = 0; n != inner_neighborhood.current_size_; ++n)
             {
-                size_t &index_j = inner_neighborhood.j_[n];
+                size_t index_j = inner_neighborhood.j_[n];
                 this->variable_[index_j] = this->parameter_recovery_[index_j];
             }
         }
@@ -158,13 +158,13 @@ ErrorAndParameters<VariableType> ParameterSplittingByPDEWithBoundary<ParticlesTy
     {
         StdLargeVec<Real> &heat_flux_k = *(this->boundary_heat_flux_[k]);
         StdLargeVec<Vecd> &normal_vector_k = *(this->boundary_normal_vector_[k]);
-        StdLargeVec<Real>& Vol_k = *(this->boundary_Vol_[k]);
+        StdLargeVec<StorageReal> &Vol_k = *(this->boundary_Vol_[k]);
         StdVec<StdLargeVec<Real>> &species_k = *(boundary_species_[k]);
 
         Neighborhood &contact_neighborhood = (*this->contact_configuration_[k])[index_i];
         for (size_t n = 0; n != contact_neighborhood.current_size_; ++n)
         {
-            size_t &index_j = contact_neighborhood.j_[n];
+            size_t index_j = contact_neighborhood.j_[n];
 
             if (species_k[this->phi_][index_j] > 0.0)
             {
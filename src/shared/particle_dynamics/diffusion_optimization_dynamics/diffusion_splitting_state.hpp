@@ -25,9 +25,9 @@ ErrorAndParameters<VariableType> TemperatureSplittingByPDEInner<ParticlesType, V
     Neighborhood &inner_neighborhood = this->inner_configuration_[index_i];
     for (size_t n = 0; n != inner_neighborhood.current_size_; ++n)
     {
-        size_t &index_j = inner_neighborhood.j_[n];
-        Real &r_ij_ = inner_neighborhood.r_ij_[n];
-        Vecd &e_ij_ = inner_neighborhood.e_ij_[n];
+        size_t index_j = inner_neighborhood.j_[n];
+        const Real &r_ij_ = inner_neighborhood.r_ij_[n];
+        const Vecd &e_ij_ = inner_neighborhood.e_ij_[n];
 
         // linear projection
         VariableType variable_derivative = (variable_i - this->variable_[index_j]);
@@ -54,9 +54,9 @@ void TemperatureSplittingByPDEInner<ParticlesType, VariableType>::
     Neighborhood &inner_neighborhood = this->inner_configuration_[index_i];
     for (size_t n = 0; n != inner_neighborhood.current_size_; ++n)
     {
-        size_t &index_j = inner_neighborhood.j_[n];
-        Real &r_ij_ = inner_neighborhood.r_ij_[n];
-        Vecd &e_ij_ = inner_neighborhood.e_ij_[n];
+        size_t index_j = inner_neighborhood.j_[n];
+        const Real &r_ij_ = inner_neighborhood.r_ij_[n];
+        const Vecd &e_ij_ = inner_neighborhood.e_ij_[n];
 
         Real diff_coff_ij = this->all_diffusion_[this->phi_]->getInterParticleDiffusionCoeff(index_i, index_j, e_ij_);
         Real parameter_b = 2.0 * diff_coff_ij * inner_neighborhood.dW_ij_[n] * this->Vol_[index_j] * dt / r_ij_;
@@ -100,7 +100,7 @@ ErrorAndParameters<VariableType> TemperatureSplittingByPDEWithBoundary<Particles
     /* contact interaction. */
     for (size_t k = 0; k < this->contact_configuration_.size(); ++k)
     {
-        StdLargeVec<Real> &Vol_k = *(this->boundary_Vol_[k]);
+        StdLargeVec<StorageReal> &Vol_k = *(this->boundary_Vol_[k]);
         StdLargeVec<Real> &heat_flux_k = *(this->boundary_heat_flux_[k]);
         StdLargeVec<Vecd> &normal_vector_k = *(this->boundary_normal_vector_[k]);
         StdLargeVec<VariableType> &variable_k = *(this->boundary_variable_[k]);
@@ -108,7 +108,7 @@ ErrorAndParameters<VariableType> TemperatureSplittingByPDEWithBoundary<Particles
         Neighborhood &contact_neighborhood = (*this->contact_configuration_[k])[index_i];
         for (size_t n = 0; n != contact_neighborhood.current_size_; ++n)
         {
-            size_t &index_j = contact_neighborhood.j_[n];
+            size_t index_j = contact_neighborhood.j_[n];
 
             if (variable_k[index_j] > 0.0)
             {
@@ -64,7 +64,7 @@ class DiffusionRelaxation<Base, DataDelegationType<ParticlesType, ContactParticl
     typedef typename ParticlesType::DiffusionReactionMaterial Material;
     Material &material_;
 
-    StdLargeVec<Real> &Vol_;
+    StdLargeVec<StorageReal> &Vol_;
     StdVec<BaseDiffusion *> &all_diffusions_;
     StdVec<StdLargeVec<Real> *> &diffusion_species_;
     StdVec<StdLargeVec<Real> *> &gradient_species_;
@@ -170,12 +170,12 @@ template <typename... ContactParameters>
 class DiffusionRelaxation<Dirichlet<ContactParameters...>>
     : public DiffusionRelaxation<Contact<Base>, ContactParameters...>
 {
-    StdVec<StdLargeVec<Real>*> contact_Vol_;
+    StdVec<StdLargeVec<StorageReal> *> contact_Vol_;
 
   protected:
     StdVec<StdVec<StdLargeVec<Real> *>> contact_gradient_species_;
     void getDiffusionChangeRateDirichlet(
-        size_t particle_i, size_t particle_j, Vecd &e_ij, Real surface_area_ij,
+        size_t particle_i, size_t particle_j, const Vecd &e_ij, Real surface_area_ij,
         const StdVec<StdLargeVec<Real> *> &gradient_species_k);
 
   public:
@@ -192,7 +192,8 @@ class DiffusionRelaxation<Neumann<ContactParameters...>>
     : public DiffusionRelaxation<Contact<Base>, ContactParameters...>
 {
     StdLargeVec<Vecd> &n_;
-    StdVec<StdLargeVec<Real> *> contact_heat_flux_, contact_Vol_;
+    StdVec<StdLargeVec<Real> *> contact_heat_flux_;
+    StdVec<StdLargeVec<StorageReal> *> contact_Vol_;
     StdVec<StdLargeVec<Vecd> *> contact_n_;
 
   protected:
@@ -216,7 +217,7 @@ class DiffusionRelaxation<Robin<ContactParameters...>>
     StdVec<StdLargeVec<Real> *> contact_convection_;
     StdVec<Real *> contact_T_infinity_;
     StdVec<StdLargeVec<Vecd> *> contact_n_;
-    StdVec<StdLargeVec<Real>*> contact_Vol_;
+    StdVec<StdLargeVec<StorageReal> *> contact_Vol_;
 
   protected:
     void getDiffusionChangeRateRobin(
@@ -87,7 +87,7 @@ void DiffusionRelaxation<Inner<ParticlesType, KernelGradientType>>::
             size_t index_j = inner_neighborhood.j_[n];
             Real dW_ijV_j = inner_neighborhood.dW_ij_[n] * this->Vol_[index_j];
             Real r_ij_ = inner_neighborhood.r_ij_[n];
-            Vecd &e_ij = inner_neighborhood.e_ij_[n];
+            const Vecd &e_ij = inner_neighborhood.e_ij_[n];
 
             Real diff_coeff_ij = diffusion_m->getInterParticleDiffusionCoeff(index_i, index_j, e_ij);
             const Vecd &grad_ijV_j = this->kernel_gradient_(index_i, index_j, dW_ijV_j, e_ij);
@@ -157,7 +157,7 @@ DiffusionRelaxation<Dirichlet<CommonControlTypes...>>::
 //=================================================================================================//
 template <typename... CommonControlTypes>
 void DiffusionRelaxation<Dirichlet<CommonControlTypes...>>::
-    getDiffusionChangeRateDirichlet(size_t particle_i, size_t particle_j, Vecd &e_ij,
+    getDiffusionChangeRateDirichlet(size_t particle_i, size_t particle_j, const Vecd &e_ij,
                                     Real surface_area_ij, const StdVec<StdLargeVec<Real> *> &gradient_species_k)
 {
     for (size_t m = 0; m < this->all_diffusions_.size(); ++m)
@@ -176,14 +176,14 @@ void DiffusionRelaxation<Dirichlet<CommonControlTypes...>>::
     for (size_t k = 0; k < this->contact_configuration_.size(); ++k)
     {
         StdVec<StdLargeVec<Real> *> &gradient_species_k = this->contact_gradient_species_[k];
-        StdLargeVec<Real>& wall_Vol_k = *(contact_Vol_[k]);
+        StdLargeVec<StorageReal>& wall_Vol_k = *(contact_Vol_[k]);
         Neighborhood &contact_neighborhood = (*this->contact_configuration_[k])[index_i];
         for (size_t n = 0; n != contact_neighborhood.current_size_; ++n)
         {
             size_t index_j = contact_neighborhood.j_[n];
             Real r_ij_ = contact_neighborhood.r_ij_[n];
             Real dW_ijV_j = contact_neighborhood.dW_ij_[n] * wall_Vol_k[index_j];
-            Vecd &e_ij = contact_neighborhood.e_ij_[n];
+            const Vecd &e_ij = contact_neighborhood.e_ij_[n];
 
             const Vecd &grad_ijV_j = this->contact_kernel_gradients_[k](index_i, index_j, dW_ijV_j, e_ij);
             Real area_ij = 2.0 * grad_ijV_j.dot(e_ij) / r_ij_;
@@ -229,13 +229,13 @@ void DiffusionRelaxation<Neumann<CommonControlTypes...>>::
     {
         StdLargeVec<Real> &heat_flux_k = *(contact_heat_flux_[k]);
         StdLargeVec<Vecd> &n_k = *(contact_n_[k]);
-        StdLargeVec<Real>& Vol_k = *(contact_Vol_[k]);
+        StdLargeVec<StorageReal>& Vol_k = *(contact_Vol_[k]);
         Neighborhood &contact_neighborhood = (*this->contact_configuration_[k])[index_i];
         for (size_t n = 0; n != contact_neighborhood.current_size_; ++n)
         {
             size_t index_j = contact_neighborhood.j_[n];
             Real dW_ijV_j = contact_neighborhood.dW_ij_[n] * Vol_k[index_j];
-            Vecd &e_ij = contact_neighborhood.e_ij_[n];
+            const Vecd &e_ij = contact_neighborhood.e_ij_[n];
 
             const Vecd &grad_ijV_j = this->contact_kernel_gradients_[k](index_i, index_j, dW_ijV_j, e_ij);
             Vecd n_ij = n_[index_i] - n_k[index_j];
@@ -285,7 +285,7 @@ void DiffusionRelaxation<Robin<CommonControlTypes...>>::
     for (size_t k = 0; k < this->contact_configuration_.size(); ++k)
     {
         StdLargeVec<Vecd> &n_k = *(contact_n_[k]);
-        StdLargeVec<Real>& Vol_k = *(contact_Vol_[k]);
+        StdLargeVec<StorageReal>& Vol_k = *(contact_Vol_[k]);
         StdLargeVec<Real> &convection_k = *(contact_convection_[k]);
         Real &T_infinity_k = *(contact_T_infinity_[k]);
 
@@ -294,7 +294,7 @@ void DiffusionRelaxation<Robin<CommonControlTypes...>>::
         {
             size_t index_j = contact_neighborhood.j_[n];
             Real dW_ijV_j = contact_neighborhood.dW_ij_[n] * Vol_k[index_j];
-            Vecd &e_ij = contact_neighborhood.e_ij_[n];
+            const Vecd &e_ij = contact_neighborhood.e_ij_[n];
 
             const Vecd &grad_ijV_j = this->contact_kernel_gradients_[k](index_i, index_j, dW_ijV_j, e_ij);
             Vecd n_ij = n_[index_i] - n_k[index_j];
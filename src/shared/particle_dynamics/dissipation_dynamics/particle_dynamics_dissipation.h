@@ -71,7 +71,8 @@ class DampingBySplittingInner : public LocalDynamics, public DissipationDataInne
 
   protected:
     Real eta_; /**< damping coefficient */
-    StdLargeVec<Real> &Vol_, &mass_;
+    StdLargeVec<StorageReal> &Vol_;
+    StdLargeVec<Real> &mass_;
     StdLargeVec<VariableType> &variable_;
 
     virtual ErrorAndParameters<VariableType> computeErrorAndParameters(size_t index_i, Real dt = 0.0);
@@ -91,7 +92,8 @@ class DampingBySplittingComplex : public DampingBySplittingInner<VariableType>,
     virtual void updateStates(size_t index_i, Real dt, const ErrorAndParameters<VariableType> &error_and_parameters) override;
 
   private:
-    StdVec<StdLargeVec<Real> *> contact_Vol_, contact_mass_;
+    StdVec<StdLargeVec<StorageReal> *> contact_Vol_;
+    StdVec<StdLargeVec<Real> *> contact_mass_;
     StdVec<StdLargeVec<VariableType> *> contact_variable_;
 };
 
@@ -109,7 +111,7 @@ class DampingBySplittingWithWall : public BaseDampingBySplittingType<VariableTyp
     virtual ErrorAndParameters<VariableType> computeErrorAndParameters(size_t index_i, Real dt = 0.0) override;
 
   private:
-    StdVec<StdLargeVec<Real> *> wall_Vol_;
+    StdVec<StdLargeVec<StorageReal> *> wall_Vol_;
     StdVec<StdLargeVec<VariableType> *> wall_variable_;
 };
 
@@ -131,7 +133,8 @@ class DampingPairwiseInner : public LocalDynamics, public DissipationDataInner
     inline void interaction(size_t index_i, Real dt = 0.0);
 
   protected:
-    StdLargeVec<Real> &Vol_, &mass_;
+    StdLargeVec<StorageReal> &Vol_;
+    StdLargeVec<Real> &mass_;
     StdLargeVec<VariableType> &variable_;
     Real eta_; /**< damping coefficient */
 };
@@ -147,7 +150,8 @@ class DampingPairwiseComplex : public DampingPairwiseInner<VariableType>, public
     inline void interaction(size_t index_i, Real dt = 0.0);
 
   private:
-    StdVec<StdLargeVec<Real> *> contact_Vol_, contact_mass_;
+    StdVec<StdLargeVec<StorageReal> *> contact_Vol_;
+    StdVec<StdLargeVec<Real> *> contact_mass_;
     StdVec<StdLargeVec<VariableType> *> contact_variable_;
 };
 
@@ -169,7 +173,7 @@ class DampingPairwiseWithWall : public BaseDampingPairwiseType<VariableType>,
     inline void interaction(size_t index_i, Real dt = 0.0);
 
   private:
-    StdVec<StdLargeVec<Real> *> wall_Vol_;
+    StdVec<StdLargeVec<StorageReal> *> wall_Vol_;
     StdVec<StdLargeVec<VariableType> *> wall_variable_;
 };
 
@@ -190,9 +194,10 @@ class DampingPairwiseFromWall : public LocalDynamics,
 
   private:
     Real eta_; /**< damping coefficient */
-    StdLargeVec<Real> &Vol_, &mass_;
+    StdLargeVec<StorageReal> &Vol_;
+    StdLargeVec<Real> &mass_;
     StdLargeVec<VariableType> &variable_;
-    StdVec<StdLargeVec<Real> *> wall_Vol_;
+    StdVec<StdLargeVec<StorageReal> *> wall_Vol_;
     StdVec<StdLargeVec<VariableType> *> wall_variable_;
 };
 
@@ -132,7 +132,7 @@ void DampingBySplittingComplex<VariableType>::
     for (size_t k = 0; k < this->contact_configuration_.size(); ++k)
     {
         StdLargeVec<Real> &mass_k = *(this->contact_mass_[k]);
-        StdLargeVec<Real> &Vol_k = *(this->contact_Vol_[k]);
+        StdLargeVec<StorageReal> &Vol_k = *(this->contact_Vol_[k]);
         StdLargeVec<VariableType> &variable_k = *(this->contact_variable_[k]);
         Neighborhood &contact_neighborhood = (*this->contact_configuration_[k])[index_i];
         for (size_t n = 0; n != contact_neighborhood.current_size_; ++n)
@@ -280,7 +280,7 @@ void DampingPairwiseComplex<VariableType>::
     for (size_t k = 0; k < this->contact_configuration_.size(); ++k)
     {
         StdLargeVec<Real> &mass_k = *(this->contact_mass_[k]);
-        StdLargeVec<Real> &Vol_k = *(this->contact_Vol_[k]);
+        StdLargeVec<StorageReal> &Vol_k = *(this->contact_Vol_[k]);
         StdLargeVec<VariableType> &variable_k = *(this->contact_variable_[k]);
         Neighborhood &contact_neighborhood = (*this->contact_configuration_[k])[index_i];
         // forward sweep
@@ -343,7 +343,7 @@ void DampingPairwiseWithWall<VariableType, BaseDampingPairwiseType>::
     for (size_t k = 0; k < this->contact_configuration_.size(); ++k)
     {
         StdLargeVec<VariableType> &variable_k = *(this->wall_variable_[k]);
-        StdLargeVec<Real>& Vol_k = *(this->wall_Vol_[k]);
+        StdLargeVec<StorageReal> &Vol_k = *(this->wall_Vol_[k]);
         Neighborhood &contact_neighborhood = (*DissipationDataWithWall::contact_configuration_[k])[index_i];
         // forward sweep
         for (size_t n = 0; n != contact_neighborhood.current_size_; ++n)
@@ -395,7 +395,7 @@ void DampingPairwiseFromWall<VariableType>::
     for (size_t k = 0; k < contact_configuration_.size(); ++k)
     {
         StdLargeVec<VariableType> &variable_k = *(wall_variable_[k]);
-        StdLargeVec<Real> &Vol_k = *(wall_Vol_[k]);
+        StdLargeVec<StorageReal> &Vol_k = *(wall_Vol_[k]);
         Neighborhood &contact_neighborhood = (*contact_configuration_[k])[index_i];
         // forward sweep
         for (size_t n = 0; n != contact_neighborhood.current_size_; ++n)
@@ -7,7 +7,7 @@ namespace fluid_dynamics
 //=================================================================================================//
 BaseFlowBoundaryCondition::BaseFlowBoundaryCondition(BodyPartByCell &body_part)
     : BaseLocalDynamics<BodyPartByCell>(body_part), FluidDataSimple(sph_body_),
-      rho_(particles_->rho_), p_(*particles_->getVariableByName<Real>("Pressure")),
+      rho_(particles_->rho_), p_(*particles_->getVariableByName<StorageReal>("Pressure")),
       pos_(particles_->pos_), vel_(particles_->vel_){};
 //=================================================================================================//
 FlowVelocityBuffer::FlowVelocityBuffer(BodyPartByCell &body_part, Real relaxation_rate)
@@ -34,7 +34,7 @@ EmitterInflowCondition::
     : BaseLocalDynamics<BodyPartByParticle>(aligned_box_part), FluidDataSimple(sph_body_),
       fluid_(DynamicCast<Fluid>(this, particles_->getBaseMaterial())),
       pos_(particles_->pos_), vel_(particles_->vel_), force_(particles_->force_),
-      rho_(particles_->rho_), p_(*particles_->getVariableByName<Real>("Pressure")),
+      rho_(particles_->rho_), p_(*particles_->getVariableByName<StorageReal>("Pressure")),
       drho_dt_(*particles_->getVariableByName<Real>("DensityChangeRate")),
       inflow_pressure_(0), rho0_(fluid_.ReferenceDensity()),
       aligned_box_(aligned_box_part.aligned_box_),
@@ -57,12 +57,17 @@ EmitterInflowInjection::
     : BaseLocalDynamics<BodyPartByParticle>(aligned_box_part), FluidDataSimple(sph_body_),
       fluid_(DynamicCast<Fluid>(this, particles_->getBaseMaterial())),
       pos_(particles_->pos_), rho_(particles_->rho_),
-      p_(*particles_->getVariableByName<Real>("Pressure")),
+      p_(*particles_->getVariableByName<StorageReal>("Pressure")),
       buffer_(buffer), axis_(axis), aligned_box_(aligned_box_part.aligned_box_)
 {
     buffer_.checkParticlesReserved();
 }
 //=================================================================================================//
+void EmitterInflowInjection::setupDynamics(Real dt)
+{
+    buffer_.prepareBufferParticles(*particles_, identifier_.SizeOfLoopRange());
+}
+//=================================================================================================//
 void EmitterInflowInjection::update(size_t unsorted_index_i, Real dt)
 {
     size_t sorted_index_i = sorted_id_[unsorted_index_i];
@@ -48,7 +48,8 @@ class BaseFlowBoundaryCondition : public BaseLocalDynamics<BodyPartByCell>, publ
     virtual ~BaseFlowBoundaryCondition(){};
 
   protected:
-    StdLargeVec<Real> &rho_, &p_;
+    StdLargeVec<Real> &rho_;
+    StdLargeVec<StorageReal> &p_;
     StdLargeVec<Vecd> &pos_, &vel_;
 };
 
@@ -191,7 +192,9 @@ class EmitterInflowCondition : public BaseLocalDynamics<BodyPartByParticle>, pub
   protected:
     Fluid &fluid_;
     StdLargeVec<Vecd> &pos_, &vel_, &force_;
-    StdLargeVec<Real> &rho_, &p_, &drho_dt_;
+    StdLargeVec<Real> &rho_;
+    StdLargeVec<StorageReal> &p_;
+    StdLargeVec<Real> &drho_dt_;
     /** inflow pressure condition */
     Real inflow_pressure_;
     Real rho0_;
@@ -215,13 +218,15 @@ class EmitterInflowInjection : public BaseLocalDynamics<BodyPartByParticle>, pub
     EmitterInflowInjection(BodyAlignedBoxByParticle &aligned_box_part, ParticleBuffer<Base> &buffer, int axis);
     virtual ~EmitterInflowInjection(){};
 
+    virtual void setupDynamics(Real dt = 0.0) override;
     void update(size_t unsorted_index_i, Real dt = 0.0);
 
   protected:
     std::mutex mutex_switch_to_real_; /**< mutex exclusion for memory conflict */
     Fluid &fluid_;
     StdLargeVec<Vecd> &pos_;
-    StdLargeVec<Real> &rho_, &p_;
+    StdLargeVec<Real> &rho_;
+    StdLargeVec<StorageReal> &p_;
     ParticleBuffer<Base> &buffer_;
     const int axis_; /**< the axis direction for bounding*/
     AlignedBoxShape &aligned_box_;
@@ -48,7 +48,9 @@ class NonReflectiveBoundaryCorrection : public LocalDynamics, public DataDelegat
     Fluid &fluid_;
     Real rho_farfield_, sound_speed_;
     Vecd vel_farfield_;
-    StdLargeVec<Real> &rho_, &p_, &Vol_, &mass_;
+    StdLargeVec<Real> &rho_;
+    StdLargeVec<StorageReal> &p_, &Vol_;
+    StdLargeVec<Real> &mass_;
     StdLargeVec<Vecd> &vel_, &mom_, &pos_;
     StdLargeVec<Real> inner_weight_summation_, rho_average_, vel_normal_average_;
     StdLargeVec<Vecd> vel_tangential_average_, vel_average_;
@@ -51,7 +51,8 @@ class DensitySummation<Base, DataDelegationType>
     virtual ~DensitySummation(){};
 
   protected:
-    StdLargeVec<Real> &rho_, &mass_, &rho_sum_, &Vol_;
+    StdLargeVec<Real> &rho_, &mass_, &rho_sum_;
+    StdLargeVec<StorageReal> &Vol_;
     Real rho0_, inv_sigma0_, W0_;
 };
 
@@ -8,7 +8,7 @@ namespace fluid_dynamics
 EulerianCompressibleAcousticTimeStepSize::
     EulerianCompressibleAcousticTimeStepSize(SPHBody &sph_body)
     : AcousticTimeStepSize(sph_body), rho_(particles_->rho_),
-      p_(*particles_->getVariableByName<Real>("Pressure")), vel_(particles_->vel_),
+      p_(*particles_->getVariableByName<StorageReal>("Pressure")), vel_(particles_->vel_),
       smoothing_length_(sph_body.sph_adaptation_->ReferenceSmoothingLength()),
       compressible_fluid_(CompressibleFluid(1.0, 1.4)){};
 //=================================================================================================//
@@ -48,7 +48,8 @@ namespace fluid_dynamics
 class EulerianCompressibleAcousticTimeStepSize : public AcousticTimeStepSize
 {
   protected:
-    StdLargeVec<Real> &rho_, &p_;
+    StdLargeVec<Real> &rho_;
+    StdLargeVec<StorageReal> &p_;
     StdLargeVec<Vecd> &vel_;
     Real smoothing_length_;
 
@@ -69,7 +70,8 @@ class BaseIntegrationInCompressible : public BaseIntegration<FluidDataInner>
 
   protected:
     CompressibleFluid compressible_fluid_;
-    StdLargeVec<Real> &Vol_, &E_, &dE_dt_, &dmass_dt_;
+    StdLargeVec<StorageReal> &Vol_;
+    StdLargeVec<Real> &E_, &dE_dt_, &dmass_dt_;
     StdLargeVec<Vecd> &mom_, &force_, &force_prior_;
 };
 
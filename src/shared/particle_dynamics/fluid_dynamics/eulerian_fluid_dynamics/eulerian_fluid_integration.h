@@ -45,7 +45,8 @@ class EulerianIntegration : public BaseIntegration<DataDelegationType>
 
   protected:
     StdLargeVec<Vecd> &mom_, &dmom_dt_;
-    StdLargeVec<Real> &dmass_dt_, &Vol_;
+    StdLargeVec<Real> &dmass_dt_;
+    StdLargeVec<StorageReal> &Vol_;
 };
 
 template <typename... InteractionTypes>
@@ -41,7 +41,7 @@ namespace SPH
 struct CompressibleFluidState : FluidStateIn
 {
     Real &E_;
-    CompressibleFluidState(Real &rho, Vecd &vel, Real &p, Real &E)
+    CompressibleFluidState(Real &rho, Vecd &vel, Real p, Real &E)
         : FluidStateIn(rho, vel, p), E_(E){};
 };
 struct CompressibleFluidStarState : FluidStateOut
@@ -63,7 +63,8 @@ public:
     }
 
 protected:
-    StdLargeVec<Real> &Vol_, &mass_, &rho_;
+    StdLargeVec<StorageReal> &Vol_;
+    StdLargeVec<Real> &mass_, &rho_;
 };
 
 template <class DataDelegationType>
@@ -76,7 +77,9 @@ class BaseIntegration : public LocalDynamics, public DataDelegationType
 
   protected:
     Fluid &fluid_;
-    StdLargeVec<Real> &rho_, &mass_, &Vol_, &p_, &drho_dt_;
+    StdLargeVec<Real> &rho_, &mass_;
+    StdLargeVec<StorageReal> &Vol_, &p_;
+    StdLargeVec<Real> &drho_dt_;
     StdLargeVec<Vecd> &pos_, &vel_, &force_, &force_prior_;
 };
 
@@ -133,8 +136,8 @@ class Integration1stHalf<Contact<>, RiemannSolverType, KernelCorrectionType>
     KernelCorrectionType correction_;
     StdVec<KernelCorrectionType> contact_corrections_;
     StdVec<RiemannSolverType> riemann_solvers_;
-    StdVec<StdLargeVec<Real> *> contact_p_;
-    StdVec<StdLargeVec<Real>*> contact_Vol_;
+    StdVec<StdLargeVec<StorageReal> *> contact_p_;
+    StdVec<StdLargeVec<StorageReal> *> contact_Vol_;
 };
 
 template <class RiemannSolverType, class KernelCorrectionType>
@@ -165,7 +168,8 @@ class Integration2ndHalf<Inner<>, RiemannSolverType>
 
   protected:
     RiemannSolverType riemann_solver_;
-    StdLargeVec<Real> &mass_, & Vol_;
+    StdLargeVec<Real> &mass_;
+    StdLargeVec<StorageReal> &Vol_;
 };
 using Integration2ndHalfInnerRiemann = Integration2ndHalf<Inner<>, AcousticRiemannSolver>;
 using Integration2ndHalfInnerNoRiemann = Integration2ndHalf<Inner<>, NoRiemannSolver>;
@@ -195,7 +199,7 @@ class Integration2ndHalf<Contact<>, RiemannSolverType>
 
   protected:
     StdVec<RiemannSolverType> riemann_solvers_;
-    StdVec<StdLargeVec<Real> *> contact_p_, contact_Vol_;
+    StdVec<StdLargeVec<StorageReal> *> contact_p_, contact_Vol_;
     StdVec<StdLargeVec<Vecd> *> contact_vel_;
 };
 
@@ -13,7 +13,7 @@ BaseIntegration<DataDelegationType>::BaseIntegration(BaseRelationType &base_rela
     : LocalDynamics(base_relation.getSPHBody()), DataDelegationType(base_relation),
       fluid_(DynamicCast<Fluid>(this, this->particles_->getBaseMaterial())),
       rho_(this->particles_->rho_), mass_(this->particles_->mass_), Vol_(this->particles_->Vol_),
-      p_(*this->particles_->template getVariableByName<Real>("Pressure")),
+      p_(*this->particles_->template getVariableByName<StorageReal>("Pressure")),
       drho_dt_(*this->particles_->template registerSharedVariable<Real>("DensityChangeRate")),
       pos_(this->particles_->pos_), vel_(this->particles_->vel_),
       force_(this->particles_->force_), force_prior_(this->particles_->force_prior_) {}
@@ -36,12 +36,12 @@ Integration1stHalf<Inner<>, RiemannSolverType, KernelCorrectionType>::
     particles_->registerSortableVariable<Vecd>("Force");
     particles_->registerSortableVariable<Real>("DensityChangeRate");
     particles_->registerSortableVariable<Real>("Density");
-    particles_->registerSortableVariable<Real>("Pressure");
-    particles_->registerSortableVariable<Real>("VolumetricMeasure");
+    particles_->registerSortableVariable<StorageReal>("Pressure");
+    particles_->registerSortableVariable<StorageReal>("VolumetricMeasure");
     //----------------------------------------------------------------------
     //		add restart output particle data
     //----------------------------------------------------------------------
-    particles_->addVariableToRestart<Real>("Pressure");
+    particles_->addVariableToRestart<StorageReal>("Pressure");
     particles_->addVariableToRestart<Real>("DensityChangeRate");
 }
 //=================================================================================================//
@@ -93,12 +93,12 @@ void Integration1stHalf<Contact<Wall>, RiemannSolverType, KernelCorrectionType>:
     {
         StdLargeVec<Vecd>& force_ave_k = *(wall_force_ave_[k]);
         StdLargeVec<Real>& wall_mass_k = *(wall_mass_[k]);
-        StdLargeVec<Real>& wall_Vol_k = *(wall_Vol_[k]);
+        StdLargeVec<StorageReal>& wall_Vol_k = *(wall_Vol_[k]);
         Neighborhood& wall_neighborhood = (*contact_configuration_[k])[index_i];
         for (size_t n = 0; n != wall_neighborhood.current_size_; ++n)
         {
             size_t index_j = wall_neighborhood.j_[n];
-            Vecd& e_ij = wall_neighborhood.e_ij_[n];
+            const Vecd &e_ij = wall_neighborhood.e_ij_[n];
             Real dW_ijV_j = wall_neighborhood.dW_ij_[n] * wall_Vol_k[index_j];
             Real r_ij = wall_neighborhood.r_ij_[n];
 
@@ -123,8 +123,8 @@ Integration1stHalf<Contact<>, RiemannSolverType, KernelCorrectionType>::
         contact_corrections_.push_back(KernelCorrectionType(this->contact_particles_[k]));
         Fluid &contact_fluid = DynamicCast<Fluid>(this, this->contact_particles_[k]->getBaseMaterial());
         riemann_solvers_.push_back(RiemannSolverType(this->fluid_, contact_fluid));
-        contact_p_.push_back(this->contact_particles_[k]->template getVariableByName<Real>("Pressure"));
-        contact_Vol_.push_back(this->contact_particles_[k]->template getVariableByName<Real>("VolumetricMeasure"));
+        contact_p_.push_back(this->contact_particles_[k]->template getVariableByName<StorageReal>("Pressure"));
+        contact_Vol_.push_back(this->contact_particles_[k]->template getVariableByName<StorageReal>("VolumetricMeasure"));
     }
 }
 //=================================================================================================//
@@ -136,15 +136,15 @@ void Integration1stHalf<Contact<>, RiemannSolverType, KernelCorrectionType>::
     Real rho_dissipation(0);
     for (size_t k = 0; k < this->contact_configuration_.size(); ++k)
     {
-        StdLargeVec<Real> &p_k = *(this->contact_p_[k]);
-        StdLargeVec<Real> &Vol_k  = *(this->contact_Vol_[k]);
+        StdLargeVec<StorageReal> &p_k = *(this->contact_p_[k]);
+        StdLargeVec<StorageReal> &Vol_k = *(this->contact_Vol_[k]);
         KernelCorrectionType &correction_k = contact_corrections_[k];
         RiemannSolverType &riemann_solver_k = riemann_solvers_[k];
         Neighborhood &contact_neighborhood = (*this->contact_configuration_[k])[index_i];
         for (size_t n = 0; n != contact_neighborhood.current_size_; ++n)
         {
             size_t index_j = contact_neighborhood.j_[n];
-            Vecd &e_ij = contact_neighborhood.e_ij_[n];
+            const Vecd &e_ij = contact_neighborhood.e_ij_[n];
             Real dW_ijV_j = contact_neighborhood.dW_ij_[n] * Vol_k[index_j];
 
             force -= this->mass_[index_i] * riemann_solver_k.AverageP(this->p_[index_i] * correction_(index_i), p_k[index_j] * correction_k(index_j)) *
@@ -209,12 +209,12 @@ void Integration2ndHalf<Contact<Wall>, RiemannSolverType>::interaction(size_t in
     {
         StdLargeVec<Vecd> &vel_ave_k = *(wall_vel_ave_[k]);
         StdLargeVec<Vecd> &n_k = *(wall_n_[k]);
-        StdLargeVec<Real>& wall_Vol_k = *(wall_Vol_[k]);
+        StdLargeVec<StorageReal>& wall_Vol_k = *(wall_Vol_[k]);
         Neighborhood &wall_neighborhood = (*contact_configuration_[k])[index_i];
         for (size_t n = 0; n != wall_neighborhood.current_size_; ++n)
         {
             size_t index_j = wall_neighborhood.j_[n];
-            Vecd &e_ij = wall_neighborhood.e_ij_[n];
+            const Vecd &e_ij = wall_neighborhood.e_ij_[n];
             Real dW_ijV_j = wall_neighborhood.dW_ij_[n] * wall_Vol_k[index_j];
 
             Vecd vel_in_wall = 2.0 * vel_ave_k[index_j] - vel_[index_i];
@@ -237,7 +237,7 @@ Integration2ndHalf<Contact<>, RiemannSolverType>::
         Fluid &contact_fluid = DynamicCast<Fluid>(this, contact_particles_[k]->getBaseMaterial());
         riemann_solvers_.push_back(RiemannSolverType(fluid_, contact_fluid));
         contact_vel_.push_back(contact_particles_[k]->template getVariableByName<Vecd>("Velocity"));
-        contact_Vol_.push_back(contact_particles_[k]->template getVariableByName<Real>("VolumetricMeasure"));
+        contact_Vol_.push_back(contact_particles_[k]->template getVariableByName<StorageReal>("VolumetricMeasure"));
     }
 }
 //=================================================================================================//
@@ -249,13 +249,13 @@ void Integration2ndHalf<Contact<>, RiemannSolverType>::interaction(size_t index_
     for (size_t k = 0; k < this->contact_configuration_.size(); ++k)
     {
         StdLargeVec<Vecd> &vel_k = *(this->contact_vel_[k]);
-        StdLargeVec<Real>& Vol_k = *(this->contact_Vol_[k]);
+        StdLargeVec<StorageReal> &Vol_k = *(this->contact_Vol_[k]);
         RiemannSolverType &riemann_solver_k = riemann_solvers_[k];
         Neighborhood &contact_neighborhood = (*this->contact_configuration_[k])[index_i];
         for (size_t n = 0; n != contact_neighborhood.current_size_; ++n)
         {
             size_t index_j = contact_neighborhood.j_[n];
-            Vecd &e_ij = contact_neighborhood.e_ij_[n];
+            const Vecd &e_ij = contact_neighborhood.e_ij_[n];
             Real dW_ijV_j = contact_neighborhood.dW_ij_[n] * Vol_k[index_j];
 
             Vecd vel_ave = riemann_solver_k.AverageV(this->vel_[index_i], vel_k[index_j]);
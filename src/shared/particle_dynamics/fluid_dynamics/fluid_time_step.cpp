@@ -9,7 +9,7 @@ namespace fluid_dynamics
 AcousticTimeStepSize::AcousticTimeStepSize(SPHBody &sph_body, Real acousticCFL)
     : LocalDynamicsReduce<ReduceMax>(sph_body),
       FluidDataSimple(sph_body), fluid_(DynamicCast<Fluid>(this, particles_->getBaseMaterial())),
-      rho_(particles_->rho_), p_(*particles_->getVariableByName<Real>("Pressure")),
+      rho_(particles_->rho_), p_(*particles_->getVariableByName<StorageReal>("Pressure")),
       mass_(particles_->mass_), vel_(particles_->vel_),
       force_(particles_->force_), force_prior_(particles_->force_prior_),
       smoothing_length_min_(sph_body.sph_adaptation_->MinimumSmoothingLength()),
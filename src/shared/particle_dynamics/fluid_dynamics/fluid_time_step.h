@@ -52,7 +52,9 @@ class AcousticTimeStepSize : public LocalDynamicsReduce<ReduceMax>, public Fluid
 
   protected:
     Fluid &fluid_;
-    StdLargeVec<Real> &rho_, &p_, &mass_;
+    StdLargeVec<Real> &rho_;
+    StdLargeVec<StorageReal> &p_;
+    StdLargeVec<Real> &mass_;
     StdLargeVec<Vecd> &vel_, &force_, &force_prior_;
     Real smoothing_length_min_;
     Real acousticCFL_;
@@ -22,7 +22,7 @@ void StaticConfinementDensity::update(size_t index_i, Real dt)
 StaticConfinementIntegration1stHalf::StaticConfinementIntegration1stHalf(NearShapeSurface &near_surface)
     : BaseLocalDynamics<BodyPartByCell>(near_surface), FluidDataSimple(sph_body_),
       fluid_(DynamicCast<Fluid>(this, particles_->getBaseMaterial())),
-      rho_(particles_->rho_), p_(*particles_->getVariableByName<Real>("Pressure")),
+      rho_(particles_->rho_), p_(*particles_->getVariableByName<StorageReal>("Pressure")),
       mass_(particles_->mass_), pos_(particles_->pos_), vel_(particles_->vel_),
       force_(particles_->force_),
       level_set_shape_(&near_surface.getLevelSetShape()),
@@ -37,7 +37,7 @@ void StaticConfinementIntegration1stHalf::update(size_t index_i, Real dt)
 StaticConfinementIntegration2ndHalf::StaticConfinementIntegration2ndHalf(NearShapeSurface &near_surface)
     : BaseLocalDynamics<BodyPartByCell>(near_surface), FluidDataSimple(sph_body_),
       fluid_(DynamicCast<Fluid>(this, particles_->getBaseMaterial())),
-      rho_(particles_->rho_), p_(*particles_->getVariableByName<Real>("Pressure")),
+      rho_(particles_->rho_), p_(*particles_->getVariableByName<StorageReal>("Pressure")),
       drho_dt_(*particles_->getVariableByName<Real>("DensityChangeRate")),
       pos_(particles_->pos_), vel_(particles_->vel_),
       level_set_shape_(&near_surface.getLevelSetShape()),
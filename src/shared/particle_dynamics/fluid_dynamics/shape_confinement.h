@@ -69,7 +69,9 @@ class StaticConfinementIntegration1stHalf : public BaseLocalDynamics<BodyPartByC
 
   protected:
     Fluid &fluid_;
-    StdLargeVec<Real> &rho_, &p_, &mass_;
+    StdLargeVec<Real> &rho_;
+    StdLargeVec<StorageReal> &p_;
+    StdLargeVec<Real> &mass_;
     StdLargeVec<Vecd> &pos_, &vel_, &force_;
     LevelSetShape *level_set_shape_;
     AcousticRiemannSolver riemann_solver_;
@@ -88,7 +90,9 @@ class StaticConfinementIntegration2ndHalf : public BaseLocalDynamics<BodyPartByC
 
   protected:
     Fluid &fluid_;
-    StdLargeVec<Real> &rho_, &p_, &drho_dt_;
+    StdLargeVec<Real> &rho_;
+    StdLargeVec<StorageReal> &p_;
+    StdLargeVec<Real> &drho_dt_;
     StdLargeVec<Vecd> &pos_, &vel_;
     LevelSetShape *level_set_shape_;
     AcousticRiemannSolver riemann_solver_;
@@ -49,7 +49,7 @@ class SurfaceTensionStress : public LocalDynamics, public FluidContactData
     StdLargeVec<Vecd> color_gradient_;
     StdLargeVec<Matd> surface_tension_stress_;
     StdVec<Real> contact_surface_tension_, contact_fraction_;
-    StdVec<StdLargeVec<Real>*> contact_Vol_;
+    StdVec<StdLargeVec<StorageReal> *> contact_Vol_;
 };
 
 template <typename... T>
@@ -65,7 +65,8 @@ class SurfaceStressForce<DataDelegationType>
     virtual ~SurfaceStressForce(){};
 
   protected:
-    StdLargeVec<Real> &rho_, &mass_, &Vol_;
+    StdLargeVec<Real> &rho_, &mass_;
+    StdLargeVec<StorageReal> &Vol_;
     StdLargeVec<Vecd> &color_gradient_, &surface_tension_force_;
     StdLargeVec<Matd> &surface_tension_stress_;
 };
@@ -89,7 +90,7 @@ class SurfaceStressForce<Contact<>> : public SurfaceStressForce<FluidContactData
     void interaction(size_t index_i, Real dt = 0.0);
 
   protected:
-    StdVec<StdLargeVec<Real>*> contact_Vol_;
+    StdVec<StdLargeVec<StorageReal> *> contact_Vol_;
     StdVec<StdLargeVec<Vecd> *> contact_color_gradient_;
     StdVec<StdLargeVec<Matd> *> contact_surface_tension_stress_;
     StdVec<Real> contact_surface_tension_, contact_fraction_;
@@ -84,7 +84,7 @@ void TransportVelocityCorrection<Contact<Boundary>, CommonControlTypes...>::
         Vecd inconsistency = Vecd::Zero();
         for (size_t k = 0; k < this->contact_configuration_.size(); ++k)
         {
-            StdLargeVec<Real> &wall_Vol_k = *(wall_Vol_[k]);
+            StdLargeVec<StorageReal> &wall_Vol_k = *(wall_Vol_[k]);
             Neighborhood &contact_neighborhood = (*this->contact_configuration_[k])[index_i];
             for (size_t n = 0; n != contact_neighborhood.current_size_; ++n)
             {
@@ -107,7 +107,7 @@ TransportVelocityCorrection<Contact<>, KernelCorrectionType, CommonControlTypes.
     for (size_t k = 0; k != this->contact_particles_.size(); ++k)
     {
         contact_kernel_corrections_.push_back(KernelCorrectionType(this->contact_particles_[k]));
-        contact_Vol_.push_back(this->contact_particles_[k]->template getVariableByName<Real>("VolumetricMeasure"));
+        contact_Vol_.push_back(this->contact_particles_[k]->template getVariableByName<StorageReal>("VolumetricMeasure"));
     }
 }
 //=================================================================================================//
@@ -120,7 +120,7 @@ void TransportVelocityCorrection<Contact<>, KernelCorrectionType, CommonControlT
         Vecd inconsistency = Vecd::Zero();
         for (size_t k = 0; k < this->contact_configuration_.size(); ++k)
         {
-            StdLargeVec<Real> &Vol_k = *(this->contact_Vol_[k]);
+            StdLargeVec<StorageReal> &Vol_k = *(this->contact_Vol_[k]);
             Neighborhood &contact_neighborhood = (*this->contact_configuration_[k])[index_i];
             KernelCorrectionType &kernel_correction_k = this->contact_kernel_corrections_[k];
             for (size_t n = 0; n != contact_neighborhood.current_size_; ++n)
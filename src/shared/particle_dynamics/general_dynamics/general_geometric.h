@@ -79,7 +79,8 @@ class NormalDirectionFromParticles : public LocalDynamics, public GeneralDataDel
   protected:
     Shape &initial_shape_;
     StdLargeVec<Vecd> &pos_, &n_, &n0_;
-    StdLargeVec<Real> &phi_, &phi0_, &Vol_;
+    StdLargeVec<Real> &phi_, &phi0_;
+    StdLargeVec<StorageReal> &Vol_;
 };
 } // namespace SPH
 #endif // GENERAL_GEOMETRIC_H
@@ -50,6 +50,24 @@ class BaseInterpolation : public LocalDynamics, public InterpolationContactData
         for (size_t k = 0; k != this->contact_particles_.size(); ++k)
         {
             contact_Vol_.push_back(&(this->contact_particles_[k]->Vol_));
+#if SPHINXSYS_USE_MIXED_PRECISION
+            /** a scalar stored in storage precision, e.g. pressure, is observed in Real */
+            StdLargeVec<StorageReal> *contact_storage_data = nullptr;
+            if constexpr (std::is_same_v<DataType, Real>)
+            {
+                if (findVariableByName<StorageReal>(this->contact_particles_[k]->AllDiscreteVariables(), variable_name) != nullptr)
+                {
+                    contact_storage_data =
+                        this->contact_particles_[k]->template getVariableByName<StorageReal>(variable_name);
+                }
+            }
+            contact_storage_data_.push_back(contact_storage_data);
+            if (contact_storage_data != nullptr)
+            {
+                contact_data_.push_back(nullptr);
+                continue;
+            }
+#endif
             StdLargeVec<DataType> *contact_data =
                 this->contact_particles_[k]->template getVariableByName<DataType>(variable_name);
             contact_data_.push_back(contact_data);
@@ -64,25 +82,45 @@ class BaseInterpolation : public LocalDynamics, public InterpolationContactData
 
         for (size_t k = 0; k < this->contact_configuration_.size(); ++k)
         {
-            StdLargeVec<Real> &Vol_k = *(contact_Vol_[k]);
-            StdLargeVec<DataType> &data_k = *(contact_data_[k]);
             Neighborhood &contact_neighborhood = (*this->contact_configuration_[k])[index_i];
-            for (size_t n = 0; n != contact_neighborhood.current_size_; ++n)
+#if SPHINXSYS_USE_MIXED_PRECISION
+            if constexpr (std::is_same_v<DataType, Real>)
             {
-                size_t index_j = contact_neighborhood.j_[n];
-                Real weight_j = contact_neighborhood.W_ij_[n] * Vol_k[index_j];
-
-                observed_quantity += weight_j * data_k[index_j];
-                ttl_weight += weight_j;
+                if (contact_storage_data_[k] != nullptr)
+                {
+                    accumulateContactData(*(contact_Vol_[k]), *(contact_storage_data_[k]), contact_neighborhood,
+                                          observed_quantity, ttl_weight);
+                    continue;
+                }
             }
+#endif
+            accumulateContactData(*(contact_Vol_[k]), *(contact_data_[k]), contact_neighborhood,
+                                  observed_quantity, ttl_weight);
         }
         (*interpolated_quantities_)[index_i] = observed_quantity / (ttl_weight + TinyReal);
     };
 
   protected:
     StdLargeVec<DataType> *interpolated_quantities_;
-    StdVec<StdLargeVec<Real> *> contact_Vol_;
+    StdVec<StdLargeVec<StorageReal> *> contact_Vol_;
     StdVec<StdLargeVec<DataType> *> contact_data_;
+#if SPHINXSYS_USE_MIXED_PRECISION
+    StdVec<StdLargeVec<StorageReal> *> contact_storage_data_;
+#endif
+
+    template <typename ContactDataType>
+    void accumulateContactData(StdLargeVec<StorageReal> &Vol_k, StdLargeVec<ContactDataType> &data_k,
+                               Neighborhood &contact_neighborhood, DataType &observed_quantity, Real &ttl_weight)
+    {
+        for (size_t n = 0; n != contact_neighborhood.current_size_; ++n)
+        {
+            size_t index_j = contact_neighborhood.j_[n];
+            Real weight_j = contact_neighborhood.W_ij_[n] * Vol_k[index_j];
+
+            observed_quantity += weight_j * data_k[index_j];
+            ttl_weight += weight_j;
+        }
+    };
 };
 
 /**
@@ -155,7 +193,7 @@ class CorrectInterpolationKernelWeights : public LocalDynamics,
 
         for (size_t k = 0; k < contact_configuration_.size(); ++k)
         {
-            StdLargeVec<Real> &Vol_k = *(contact_Vol_[k]);
+            StdLargeVec<StorageReal> &Vol_k = *(contact_Vol_[k]);
             Neighborhood &contact_neighborhood = (*contact_configuration_[k])[index_i];
             for (size_t n = 0; n != contact_neighborhood.current_size_; ++n)
             {
@@ -178,14 +216,15 @@ class CorrectInterpolationKernelWeights : public LocalDynamics,
             Neighborhood &contact_neighborhood = (*contact_configuration_[k])[index_i];
             for (size_t n = 0; n != contact_neighborhood.current_size_; ++n)
             {
-                contact_neighborhood.W_ij_[n] -= normalized_weight_correction.dot(contact_neighborhood.e_ij_[n]) *
-                                                 contact_neighborhood.dW_ij_[n];
+                Real weight_correction_ij = normalized_weight_correction.dot(contact_neighborhood.e_ij_[n]) *
+                                            contact_neighborhood.dW_ij_[n];
+                contact_neighborhood.W_ij_.setValue(n, contact_neighborhood.W_ij_[n] - weight_correction_ij);
             }
         }
     };
 
   protected:
-    StdVec<StdLargeVec<Real> *> contact_Vol_;
+    StdVec<StdLargeVec<StorageReal> *> contact_Vol_;
 };
 } // namespace SPH
 #endif // GENERAL_INTERPOLATION_H
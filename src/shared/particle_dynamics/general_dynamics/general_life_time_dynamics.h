@@ -47,7 +47,7 @@ class BaseLifeTimeDynamics : public LocalDynamics, public GeneralDataDelegateSim
     Real inv_rho0_;
     StdLargeVec<Real> &rho_;
     StdLargeVec<Vecd> &pos_;
-    StdLargeVec<Real> &Vol_;
+    StdLargeVec<StorageReal> &Vol_;
     StdLargeVec<Real> &mass_;
     StdLargeVec<Real> &h_ratio_;
 };
@@ -233,7 +233,7 @@ Vecd ComputeDensityErrorWithWall::computeKernelGradient(size_t index_rho)
     Neighborhood &contact_neighborhood = inner_configuration_[index_rho];
     for (size_t k = 0; k != contact_bodies_.size(); ++k)
     {
-        StdLargeVec<Real>& Vol_k = *(contact_Vol_[k]);
+        StdLargeVec<StorageReal>& Vol_k = *(contact_Vol_[k]);
         for (size_t n = 0; n != contact_neighborhood.current_size_; ++n)
         {
             size_t index_j = contact_neighborhood.j_[n];
@@ -67,7 +67,7 @@ class ComputeDensityErrorInner : public LocalDynamics, public GeneralDataDelegat
     ParticleSplitAndMerge &particle_adaptation_;
     Real rho0_, inv_sigma0_;
     StdLargeVec<Real> &h_ratio_;
-    StdLargeVec<Real> &Vol_;
+    StdLargeVec<StorageReal> &Vol_;
     Vecd E_cof_ = Vecd::Zero();
     Real sigma_E_ = 0.0;
     Real E_cof_sigma_ = 0.0;
@@ -105,7 +105,7 @@ class ComputeDensityErrorWithWall : public ComputeDensityErrorInner, public Gene
     virtual ~ComputeDensityErrorWithWall(){};
 
   protected:
-    StdVec<StdLargeVec<Real> *> contact_Vol_;
+    StdVec<StdLargeVec<StorageReal> *> contact_Vol_;
 
     virtual Vecd computeKernelGradient(size_t index_rho) override;
     virtual Real computeNewGeneratedParticleDensity(size_t index_rho, const Vecd &position) override;
@@ -127,7 +127,7 @@ class ParticleRefinementWithPrescribedArea : public LocalDynamics, public Genera
     BoundingBox refinement_region_bounds_;
     ParticleSplitAndMerge &particle_adaptation_;
     Real inv_rho0_;
-    StdLargeVec<Real> &Vol_;
+    StdLargeVec<StorageReal> &Vol_;
     StdLargeVec<Vecd> &pos_;
     StdLargeVec<Real> &rho_;
     StdLargeVec<Real> &mass_;
@@ -48,7 +48,7 @@ class LinearGradientCorrectionMatrix<DataDelegationType>
     virtual ~LinearGradientCorrectionMatrix(){};
 
   protected:
-    StdLargeVec<Real> &Vol_;
+    StdLargeVec<StorageReal> &Vol_;
     StdLargeVec<Matd> &B_;
 };
 
@@ -80,7 +80,7 @@ class LinearGradientCorrectionMatrix<Contact<>>
     void interaction(size_t index_i, Real dt = 0.0);
 
   protected:
-    StdVec<StdLargeVec<Real> *> contact_Vol_;
+    StdVec<StdLargeVec<StorageReal> *> contact_Vol_;
     StdVec<StdLargeVec<Real> *> contact_mass_;
 };
 
@@ -30,9 +30,10 @@ void KernelGradientCorrection<DataDelegationType>::
 
         Vecd corrected_direction = average_correction_matrix(index_i, index_j) * neighborhood.e_ij_[n];
         Real direction_norm = corrected_direction.norm();
-        neighborhood.dW_ij_[n] *= direction_norm;
-        neighborhood.e_ij_[n] = corrected_direction / (direction_norm + Eps);
-        neighborhood.r_ij_[n] = displacement.dot(neighborhood.e_ij_[n]);
+        Vecd corrected_e_ij = corrected_direction / (direction_norm + Eps);
+        neighborhood.dW_ij_.setValue(n, neighborhood.dW_ij_[n] * direction_norm);
+        neighborhood.e_ij_.setValue(n, corrected_e_ij);
+        neighborhood.r_ij_.setValue(n, displacement.dot(corrected_e_ij));
     }
 }
 //=================================================================================================//
@@ -52,7 +52,8 @@ class FreeSurfaceIndication<DataDelegationType>
 
   protected:
     StdLargeVec<int> &indicator_;
-    StdLargeVec<Real> &pos_div_, &Vol_;
+    StdLargeVec<Real> &pos_div_;
+    StdLargeVec<StorageReal> &Vol_;
     Real threshold_by_dimensions_;
 };
 
@@ -104,7 +105,7 @@ class FreeSurfaceIndication<Contact<>>
     void interaction(size_t index_i, Real dt = 0.0);
 
 protected:
-    StdVec<StdLargeVec<Real>*> contact_Vol_;
+    StdVec<StdLargeVec<StorageReal> *> contact_Vol_;
 };
 
 /**
@@ -126,7 +127,8 @@ class FreeSurfaceIndication<Contact<NonWetting>>
     void interaction(size_t index_i, Real dt = 0.0);
 
   protected:
-    StdVec<StdLargeVec<Real> *> contact_phi_, contact_Vol_;
+    StdVec<StdLargeVec<Real> *> contact_phi_;
+    StdVec<StdLargeVec<StorageReal> *> contact_Vol_;
 };
 
 using FreeSurfaceIndicationComplex =
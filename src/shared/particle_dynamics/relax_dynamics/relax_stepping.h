@@ -54,7 +54,7 @@ class RelaxationResidue<Base, DataDelegationType>
 
   protected:
     SPHAdaptation *sph_adaptation_;
-    StdLargeVec<Real> &Vol_;
+    StdLargeVec<StorageReal> &Vol_;
     StdLargeVec<Vecd> &residue_;
 };
 
@@ -107,7 +107,7 @@ class RelaxationResidue<Contact<>>
     void interaction(size_t index_i, Real dt = 0.0);
 
 protected:
-    StdVec<StdLargeVec<Real>*> contact_Vol_;
+    StdVec<StdLargeVec<StorageReal> *> contact_Vol_;
 };
 
 /**
@@ -149,7 +149,8 @@ class UpdateSmoothingLengthRatioByShape : public LocalDynamics,
                                           public RelaxDataDelegateSimple
 {
   protected:
-    StdLargeVec<Real> &h_ratio_, &Vol_;
+    StdLargeVec<Real> &h_ratio_;
+    StdLargeVec<StorageReal> &Vol_;
     StdLargeVec<Vecd> &pos_;
     Shape &target_shape_;
     ParticleRefinementByShape *particle_adaptation_;
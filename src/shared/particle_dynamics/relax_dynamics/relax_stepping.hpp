@@ -18,7 +18,10 @@ RelaxationResidue<Base, DataDelegationType>::RelaxationResidue(BaseRelationType
 template <typename... Args>
 RelaxationResidue<Inner<LevelSetCorrection>>::RelaxationResidue(Args &&...args)
     : RelaxationResidue<Inner<>>(std::forward<Args>(args)...), pos_(particles_->pos_),
-      level_set_shape_(DynamicCast<LevelSetShape>(this, this->getRelaxShape())){};
+      level_set_shape_(DynamicCast<LevelSetShape>(this, this->getRelaxShape()))
+{
+    level_set_shape_.prefetchKernelIntegrals(pos_, particles_->total_real_particles_);
+};
 //=================================================================================================//
 template <class RelaxationResidueType>
 template <typename FirstArg, typename... OtherArgs>
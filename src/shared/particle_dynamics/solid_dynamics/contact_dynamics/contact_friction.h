@@ -63,13 +63,13 @@ class PairwiseFrictionFromWall : public LocalDynamics, public ContactWithWallDat
         {
             StdLargeVec<Vecd> &vel_k = *(wall_vel_n_[k]);
             StdLargeVec<Vecd> &n_k = *(wall_n_[k]);
-            StdLargeVec<Real>& Vol_k = *(wall_Vol_n_[k]);
+            StdLargeVec<StorageReal>& Vol_k = *(wall_Vol_n_[k]);
             Neighborhood &contact_neighborhood = (*contact_configuration_[k])[index_i];
             // forward sweep
             for (size_t n = 0; n != contact_neighborhood.current_size_; ++n)
             {
                 size_t index_j = contact_neighborhood.j_[n];
-                Vecd &e_ij = contact_neighborhood.e_ij_[n];
+                const Vecd &e_ij = contact_neighborhood.e_ij_[n];
 
                 parameter_b[n] = eta_ * contact_neighborhood.dW_ij_[n] * Vol_k[index_j] * Vol_i * dt / contact_neighborhood.r_ij_[n];
 
@@ -83,7 +83,7 @@ class PairwiseFrictionFromWall : public LocalDynamics, public ContactWithWallDat
             for (size_t n = contact_neighborhood.current_size_; n != 0; --n)
             {
                 size_t index_j = contact_neighborhood.j_[n - 1];
-                Vecd &e_ij = contact_neighborhood.e_ij_[n];
+                const Vecd &e_ij = contact_neighborhood.e_ij_[n];
 
                 // only update particle i
                 Vecd vel_derivative = (vel_i - vel_k[index_j]);
@@ -96,9 +96,10 @@ class PairwiseFrictionFromWall : public LocalDynamics, public ContactWithWallDat
 
   protected:
     Real eta_; /**< friction coefficient */
-    StdLargeVec<Real> &Vol_, &mass_;
+    StdLargeVec<StorageReal> &Vol_;
+    StdLargeVec<Real> &mass_;
     StdLargeVec<Vecd> &vel_;
-    StdVec<StdLargeVec<Real> *> wall_Vol_n_;
+    StdVec<StdLargeVec<StorageReal> *> wall_Vol_n_;
     StdVec<StdLargeVec<Vecd> *> wall_vel_n_, wall_n_;
 };
 
@@ -55,7 +55,7 @@ class RepulsionForce<Base, DataDelegationType>
 
   protected:
     StdLargeVec<Vecd> &repulsion_force_;
-    StdLargeVec<Real> &Vol_;
+    StdLargeVec<StorageReal> &Vol_;
 };
 
 template <>
@@ -86,7 +86,8 @@ class RepulsionForce<Contact<>> : public RepulsionForce<Base, ContactDynamicsDat
     Solid &solid_;
     StdLargeVec<Real> &repulsion_density_;
     StdVec<Solid *> contact_solids_;
-    StdVec<StdLargeVec<Real> *> contact_contact_density_, contact_Vol_;
+    StdVec<StdLargeVec<Real> *> contact_contact_density_;
+    StdVec<StdLargeVec<StorageReal> *> contact_Vol_;
 };
 using ContactForce = RepulsionForce<Contact<>>;
 
@@ -101,7 +102,7 @@ class RepulsionForce<Contact<Wall>> : public RepulsionForce<Base, ContactWithWal
   protected:
     Solid &solid_;
     StdLargeVec<Real> &repulsion_density_;
-    StdVec<StdLargeVec<Real>*> contact_Vol_;
+    StdVec<StdLargeVec<StorageReal> *> contact_Vol_;
 };
 using ContactForceFromWall = RepulsionForce<Contact<Wall>>;
 
@@ -116,7 +117,8 @@ class RepulsionForce<Wall, Contact<>> : public RepulsionForce<Base, ContactDynam
 
   protected:
     StdVec<Solid *> contact_solids_;
-    StdVec<StdLargeVec<Real> *> contact_contact_density_, contact_Vol_;
+    StdVec<StdLargeVec<Real> *> contact_contact_density_;
+    StdVec<StdLargeVec<StorageReal> *> contact_Vol_;
 };
 using ContactForceToWall = RepulsionForce<Wall, Contact<>>;
 
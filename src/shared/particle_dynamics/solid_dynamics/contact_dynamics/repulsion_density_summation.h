@@ -104,7 +104,7 @@ class ShellContactDensity : public RepulsionDensitySummation<Base, ContactDynami
     Real particle_spacing_;
     StdVec<Real> calibration_factor_;
     StdVec<Real> offset_W_ij_;
-    StdVec<StdLargeVec<Real> *> contact_Vol_;
+    StdVec<StdLargeVec<StorageReal> *> contact_Vol_;
 
     /** Abscissas and weights for Gauss-Legendre quadrature integration with n=3 nodes */
     const StdVec<Real> three_gaussian_points_ = {-0.7745966692414834, 0.0, 0.7745966692414834};
@@ -130,7 +130,7 @@ class DeformationGradientBySummation : public LocalDynamics, public ElasticSolid
     };
 
   protected:
-    StdLargeVec<Real>& Vol_;
+    StdLargeVec<StorageReal> &Vol_;
     StdLargeVec<Vecd> &pos_;
     StdLargeVec<Matd> &B_, &F_;
 };
@@ -146,7 +146,8 @@ class BaseElasticIntegration : public LocalDynamics, public ElasticSolidDataInne
     virtual ~BaseElasticIntegration(){};
 
   protected:
-    StdLargeVec<Real> &rho_, &mass_, &Vol_;
+    StdLargeVec<Real> &rho_, &mass_;
+    StdLargeVec<StorageReal> &Vol_;
     StdLargeVec<Vecd> &pos_, &vel_, &force_;
     StdLargeVec<Matd> &B_, &F_, &dF_dt_;
 };
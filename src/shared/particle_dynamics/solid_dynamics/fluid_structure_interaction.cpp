@@ -42,7 +42,7 @@ void ViscousForceFromFluid::interaction(size_t index_i, Real dt)
         Real mu_k = mu_[k];
         Real smoothing_length_k = smoothing_length_[k];
         StdLargeVec<Vecd> &vel_n_k = *(contact_vel_[k]);
-        StdLargeVec<Real> &Vol_k = *(contact_Vol_[k]);
+        StdLargeVec<StorageReal> &Vol_k = *(contact_Vol_[k]);
         Neighborhood &contact_neighborhood = (*contact_configuration_[k])[index_i];
         for (size_t n = 0; n != contact_neighborhood.current_size_; ++n)
         {
@@ -54,7 +54,7 @@ class BaseForceFromFluid : public LocalDynamics, public FSIContactData, public F
     StdLargeVec<Vecd> &getForceFromFluid() { return force_from_fluid_; };
 
   protected:
-    StdLargeVec<Real> &Vol_;
+    StdLargeVec<StorageReal> &Vol_;
     StdVec<Fluid *> contact_fluids_;
     StdLargeVec<Vecd> &force_from_fluid_;
 };
@@ -72,7 +72,7 @@ class ViscousForceFromFluid : public BaseForceFromFluid
 
   protected:
     StdLargeVec<Vecd> &vel_ave_;
-    StdVec<StdLargeVec<Real>*> contact_Vol_;
+    StdVec<StdLargeVec<StorageReal> *> contact_Vol_;
     StdVec<StdLargeVec<Vecd>*> contact_vel_;
     StdVec<Real> mu_;
     StdVec<Real> smoothing_length_;
@@ -97,7 +97,8 @@ class PressureForceFromFluid : public BaseForceFromFluid
 
   protected:
     StdLargeVec<Vecd> &vel_ave_, &force_ave_, &n_;
-    StdVec<StdLargeVec<Real> *> contact_rho_n_, contact_mass_, contact_p_, contact_Vol_;
+    StdVec<StdLargeVec<Real> *> contact_rho_n_, contact_mass_;
+    StdVec<StdLargeVec<StorageReal> *> contact_p_, contact_Vol_;
     StdVec<StdLargeVec<Vecd> *> contact_vel_, contact_force_prior_;
     StdVec<RiemannSolverType> riemann_solvers_;
 };
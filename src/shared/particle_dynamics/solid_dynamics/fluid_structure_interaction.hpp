@@ -21,7 +21,7 @@ PressureForceFromFluid<FluidIntegration2ndHalfType>::
         contact_mass_.push_back(&(contact_particles_[k]->mass_));
         contact_vel_.push_back(&(contact_particles_[k]->vel_));
         contact_Vol_.push_back(&(contact_particles_[k]->Vol_));
-        contact_p_.push_back(contact_particles_[k]->template getVariableByName<Real>("Pressure"));
+        contact_p_.push_back(contact_particles_[k]->template getVariableByName<StorageReal>("Pressure"));
         contact_force_prior_.push_back(&(contact_particles_[k]->force_prior_));
         riemann_solvers_.push_back(RiemannSolverType(*contact_fluids_[k], *contact_fluids_[k]));
     }
@@ -33,10 +33,10 @@ void PressureForceFromFluid<FluidIntegration2ndHalfType>::interaction(size_t ind
     Vecd force = Vecd::Zero();
     for (size_t k = 0; k < contact_configuration_.size(); ++k)
     {
-        StdLargeVec<Real> &Vol_k = *(contact_Vol_[k]);
+        StdLargeVec<StorageReal> &Vol_k = *(contact_Vol_[k]);
         StdLargeVec<Real> &rho_n_k = *(contact_rho_n_[k]);
         StdLargeVec<Real> &mass_k = *(contact_mass_[k]);
-        StdLargeVec<Real> &p_k = *(contact_p_[k]);
+        StdLargeVec<StorageReal> &p_k = *(contact_p_[k]);
         StdLargeVec<Vecd> &vel_k = *(contact_vel_[k]);
         StdLargeVec<Vecd> &force_prior_k = *(contact_force_prior_[k]);
         RiemannSolverType &riemann_solvers_k = riemann_solvers_[k];
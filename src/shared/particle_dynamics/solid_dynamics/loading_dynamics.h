@@ -203,7 +203,7 @@ class PressureForceOnShell : public LoadingForce, public SolidDataSimple
 {
   protected:
     Real pressure_;
-    StdLargeVec<Real> &Vol_;
+    StdLargeVec<StorageReal> &Vol_;
     StdLargeVec<Vecd> &n_;
 
   public:
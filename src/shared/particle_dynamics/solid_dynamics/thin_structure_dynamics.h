@@ -129,7 +129,7 @@ class ShellCorrectConfiguration : public LocalDynamics, public ShellDataInner
     };
 
   protected:
-    StdLargeVec<Real> &Vol_;
+    StdLargeVec<StorageReal> &Vol_;
     StdLargeVec<Matd> &B_;
     StdLargeVec<Vecd> &n0_;
     StdLargeVec<Matd> &transformation_matrix_;
@@ -168,7 +168,7 @@ class ShellDeformationGradientTensor : public LocalDynamics, public ShellDataInn
     };
 
   protected:
-    StdLargeVec<Real> &Vol_;
+    StdLargeVec<StorageReal> &Vol_;
     StdLargeVec<Vecd> &pos_, &pseudo_n_, &n0_;
     StdLargeVec<Matd> &B_, &F_, &F_bending_;
     StdLargeVec<Matd> &transformation_matrix_;
@@ -185,7 +185,8 @@ class BaseShellRelaxation : public LocalDynamics, public ShellDataInner
     virtual ~BaseShellRelaxation(){};
 
   protected:
-    StdLargeVec<Real> &rho_, &thickness_, &mass_, &Vol_;
+    StdLargeVec<Real> &rho_, &thickness_, &mass_;
+    StdLargeVec<StorageReal> &Vol_;
     StdLargeVec<Vecd> &pos_, &vel_, &force_, &force_prior_;
     StdLargeVec<Vecd> &n0_, &pseudo_n_, &dpseudo_n_dt_, &dpseudo_n_d2t_, &rotation_,
         &angular_vel_, &dangular_vel_dt_;
@@ -390,7 +391,7 @@ class ShellCurvature : public LocalDynamics, public ShellDataInner
     void compute_initial_curvature();
 
   private:
-    StdLargeVec<Real> &Vol_;
+    StdLargeVec<StorageReal> &Vol_;
     StdLargeVec<Vecd> &n0_;
     StdLargeVec<Matd> &B_;
     StdLargeVec<Matd> &transformation_matrix_;
@@ -415,7 +416,7 @@ class AverageShellCurvature : public LocalDynamics, public ShellDataInner
     void update(size_t index_i, Real);
 
   private:
-    StdLargeVec<Real> &Vol_;
+    StdLargeVec<StorageReal> &Vol_;
     StdLargeVec<Vecd> &n_;
     StdLargeVec<Real> &k1_ave_; // first principle curvature
     StdLargeVec<Real> &k2_ave_; // second principle curvature
@@ -63,13 +63,23 @@ ParticleGenerator<Reload>::ParticleGenerator(SPHBody &sph_body, const std::strin
         exit(1);
     }
 
-    file_path_ = reload_folder + "/" + reload_body_name + "_rld.xml";
+    file_path_ = reload_folder + "/" + reload_body_name + "_rld";
 }
 //=================================================================================================//
 void ParticleGenerator<Reload>::initializeGeometricVariables()
 {
     base_material_.registerReloadLocalParameters(&base_particles_);
-    base_particles_.readFromXmlForReloadParticle(file_path_);
+    std::string binary_file_path = file_path_ + ".bin";
+    std::string xml_file_path = file_path_ + ".xml";
+    if (fs::exists(binary_file_path) && base_particles_.readFromBinaryForReloadParticle(binary_file_path, xml_file_path))
+    {
+        return;
+    }
+
+    // reload from the XML file and convert it so that the binary file is used next time,
+    // the checksum of the XML file is kept for rebuilding the binary file once the former is changed
+    base_particles_.readFromXmlForReloadParticle(xml_file_path);
+    base_particles_.writeToBinaryForReloadParticle(binary_file_path, fileChecksum(xml_file_path));
 }
 //=================================================================================================//
 } // namespace SPH
@@ -71,8 +71,8 @@ class ParticleGenerator<Base>
     BaseParticles &base_particles_;
     Real particle_spacing_ref_;
     StdLargeVec<Vecd> &pos_;
-    StdLargeVec<Real> &Vol_;
-    StdLargeVec<size_t> &unsorted_id_;
+    StdLargeVec<StorageReal> &Vol_;
+    StdLargeVec<ParticleIndex> &unsorted_id_;
     virtual void initializePosition(const Vecd &position);
     virtual void initializePositionAndVolumetricMeasure(const Vecd &position, Real volumetric_measure);
 };
@@ -105,7 +105,13 @@ class ParticleGenerator<Observer> : public ParticleGenerator<Base>
     StdVec<Vecd> positions_;
 };
 
-template <> // generate particles by reloading dynamically relaxed particles
+/**
+ * Generate particles by reloading dynamically relaxed particles.
+ * The binary reload file is memory mapped and copied into the reload variables in bulk.
+ * Without the binary file, or if the XML reload file is changed after the binary file,
+ * the XML reload file is read and converted to the binary one.
+ */
+template <>
 class ParticleGenerator<Reload> : public ParticleGenerator<Base>
 {
     BaseMaterial &base_material_;
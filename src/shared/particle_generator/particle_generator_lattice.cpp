@@ -21,9 +21,35 @@ GeneratingMethod<Lattice>::GeneratingMethod(SPHBody &sph_body)
     }
 }
 //=================================================================================================//
+StdVec<Vecd> GeneratingMethod<Lattice>::mergeSlabPositions(StdVec<StdVec<Vecd>> &slab_positions)
+{
+    size_t total_number = 0;
+    for (const StdVec<Vecd> &positions : slab_positions)
+        total_number += positions.size();
+
+    StdVec<Vecd> merged_positions;
+    merged_positions.reserve(total_number);
+    for (StdVec<Vecd> &positions : slab_positions)
+    {
+        merged_positions.insert(merged_positions.end(), positions.begin(), positions.end());
+        StdVec<Vecd>().swap(positions);
+    }
+    return merged_positions;
+}
+//=================================================================================================//
 ParticleGenerator<Lattice>::ParticleGenerator(SPHBody &sph_body)
     : ParticleGenerator<Base>(sph_body), GeneratingMethod<Lattice>(sph_body) {}
 //=================================================================================================//
+void ParticleGenerator<Lattice>::initializeGeometricVariables()
+{
+    Real particle_volume = pow(lattice_spacing_, Dimensions);
+    StdVec<Vecd> lattice_positions = findContainedLatticePositions();
+    for (const Vecd &particle_position : lattice_positions)
+    {
+        initializePositionAndVolumetricMeasure(particle_position, particle_volume);
+    }
+}
+//=================================================================================================//
 ParticleGenerator<Lattice, Adaptive>::ParticleGenerator(SPHBody &sph_body, Shape &target_shape)
     : ParticleGenerator<Lattice>(sph_body), target_shape_(target_shape),
       particle_adaptation_(DynamicCast<ParticleRefinementByShape>(this, sph_body.sph_adaptation_))
@@ -58,4 +84,52 @@ ParticleGenerator<ThickSurface, Lattice>::ParticleGenerator(SPHBody &sph_body, R
                            : 0.5 * thickness_;
 }
 //=================================================================================================//
+void ParticleGenerator<ThickSurface, Lattice>::initializeGeometricVariables()
+{
+    // Calculate the total volume and
+    // count the number of cells inside the body volume, where we might put particles.
+    StdVec<Vecd> lattice_positions = findContainedLatticePositions();
+    all_cells_ = lattice_positions.size();
+    total_volume_ = all_cells_ * pow(lattice_spacing_, Dimensions);
+    Real number_of_particles = total_volume_ / avg_particle_volume_ + 0.5;
+    planned_number_of_particles_ = int(number_of_particles);
+
+    // initialize a uniform distribution between 0 (inclusive) and 1 (exclusive)
+    std::mt19937_64 rng;
+    std::uniform_real_distribution<Real> unif(0, 1);
+
+    // Calculate the interval based on the number of particles.
+    Real interval = planned_number_of_particles_ / (all_cells_ + TinyReal);
+    if (interval <= 0)
+        interval = 1; // It has to be lager than 0.
+
+    // Add a particle in each interval, randomly. We will skip the last intervals if we already reach the number of particles.
+    StdVec<Vecd> particle_positions;
+    for (const Vecd &lattice_position : lattice_positions)
+    {
+        Real random_real = unif(rng);
+        if (random_real <= interval && particle_positions.size() < planned_number_of_particles_)
+        {
+            particle_positions.push_back(lattice_position);
+        }
+    }
+
+    StdVec<Vecd> particle_normals(particle_positions.size());
+    parallel_for(
+        IndexRange(0, particle_positions.size()),
+        [&](const IndexRange &r)
+        {
+            for (size_t i = r.begin(); i != r.end(); ++i)
+            {
+                particle_normals[i] = initial_shape_.findNormalDirection(particle_positions[i]);
+            }
+        });
+
+    for (size_t i = 0; i != particle_positions.size(); ++i)
+    {
+        initializePositionAndVolumetricMeasure(particle_positions[i], avg_particle_volume_ / thickness_);
+        initializeSurfaceProperties(particle_normals[i], thickness_);
+    }
+}
+//=================================================================================================//
 } // namespace SPH
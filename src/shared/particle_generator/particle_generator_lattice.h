@@ -50,6 +50,14 @@ class GeneratingMethod<Lattice>
     Real lattice_spacing_;      /**< Initial particle spacing. */
     BoundingBox domain_bounds_; /**< Domain bounds. */
     Shape &initial_shape_;      /**< Geometry shape for body. */
+
+    /** The lattice positions contained by the initial shape.
+     * The lattice slabs are checked in parallel, each into its own buffer,
+     * and the buffers are merged in the order of the slabs.
+     * Therefore, the positions are in the same order as the serial loop over the lattice,
+     * and the particle numbering is reproducible. */
+    StdVec<Vecd> findContainedLatticePositions();
+    StdVec<Vecd> mergeSlabPositions(StdVec<StdVec<Vecd>> &slab_positions);
 };
 
 template <>
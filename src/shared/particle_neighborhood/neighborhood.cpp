@@ -16,10 +16,10 @@ void Neighborhood::removeANeighbor(size_t neighbor_n)
 {
     current_size_--;
     j_[neighbor_n] = j_[current_size_];
-    W_ij_[neighbor_n] = W_ij_[current_size_];
-    dW_ij_[neighbor_n] = dW_ij_[current_size_];
-    r_ij_[neighbor_n] = r_ij_[current_size_];
-    e_ij_[neighbor_n] = e_ij_[current_size_];
+    W_ij_.setValue(neighbor_n, W_ij_[current_size_]);
+    dW_ij_.setValue(neighbor_n, dW_ij_[current_size_]);
+    r_ij_.setValue(neighbor_n, r_ij_[current_size_]);
+    e_ij_.setValue(neighbor_n, e_ij_[current_size_]);
 }
 //=================================================================================================//
 void NeighborBuilder::createNeighbor(Neighborhood &neighborhood, const Real &distance,
@@ -38,10 +38,10 @@ void NeighborBuilder::initializeNeighbor(Neighborhood &neighborhood, const Real
 {
     size_t current_size = neighborhood.current_size_;
     neighborhood.j_[current_size] = index_j;
-    neighborhood.W_ij_[current_size] = kernel_->W(distance, displacement);
-    neighborhood.dW_ij_[current_size] = kernel_->dW(distance, displacement);
-    neighborhood.r_ij_[current_size] = distance;
-    neighborhood.e_ij_[current_size] = kernel_->e(distance, displacement);
+    neighborhood.W_ij_.setValue(current_size, kernel_->W(distance, displacement));
+    neighborhood.dW_ij_.setValue(current_size, kernel_->dW(distance, displacement));
+    neighborhood.r_ij_.setValue(current_size, distance);
+    neighborhood.e_ij_.setValue(current_size, kernel_->e(distance, displacement));
 }
 //=================================================================================================//
 void NeighborBuilder::createNeighbor(Neighborhood &neighborhood, const Real &distance,
@@ -63,12 +63,11 @@ void NeighborBuilder::initializeNeighbor(Neighborhood &neighborhood, const Real
 {
     size_t current_size = neighborhood.current_size_;
     neighborhood.j_[current_size] = index_j;
-    neighborhood.W_ij_[current_size] = distance < kernel_->CutOffRadius(i_h_ratio)
-                                           ? kernel_->W(i_h_ratio, distance, displacement)
-                                           : 0.0;
-    neighborhood.dW_ij_[current_size] = kernel_->dW(h_ratio_min, distance, displacement);
-    neighborhood.r_ij_[current_size] = distance;
-    neighborhood.e_ij_[current_size] = displacement / (distance + TinyReal);
+    Real weight = distance < kernel_->CutOffRadius(i_h_ratio) ? kernel_->W(i_h_ratio, distance, displacement) : 0.0;
+    neighborhood.W_ij_.setValue(current_size, weight);
+    neighborhood.dW_ij_.setValue(current_size, kernel_->dW(h_ratio_min, distance, displacement));
+    neighborhood.r_ij_.setValue(current_size, distance);
+    neighborhood.e_ij_.setValue(current_size, displacement / (distance + TinyReal));
 }
 //=================================================================================================//
 Kernel *NeighborBuilder::chooseKernel(SPHBody &body, SPHBody &target_body)
@@ -243,10 +242,10 @@ void BaseNeighborBuilderContactShell::initializeNeighbor(Neighborhood &neighborh
 {
     size_t current_size = neighborhood.current_size_;
     neighborhood.j_[current_size] = index_j;
-    neighborhood.W_ij_[current_size] = W_ij;
-    neighborhood.dW_ij_[current_size] = dW_ij;
-    neighborhood.r_ij_[current_size] = distance;
-    neighborhood.e_ij_[current_size] = e_ij;
+    neighborhood.W_ij_.setValue(current_size, W_ij);
+    neighborhood.dW_ij_.setValue(current_size, dW_ij);
+    neighborhood.r_ij_.setValue(current_size, distance);
+    neighborhood.e_ij_.setValue(current_size, e_ij);
 }
 //=================================================================================================//
 NeighborBuilderContactToShell::NeighborBuilderContactToShell(SPHBody &body, SPHBody &contact_body, bool normal_correction)
@@ -52,11 +52,11 @@ class Neighborhood
     size_t current_size_;   /**< the current number of neighbors */
     size_t allocated_size_; /**< the limit of neighbors does not require memory allocation  */
 
-    StdLargeVec<size_t> j_;   /**< index of the neighbor particle. */
-    StdLargeVec<Real> W_ij_;  /**< kernel value or particle volume contribution */
-    StdLargeVec<Real> dW_ij_; /**< derivative of kernel function or inter-particle surface contribution */
-    StdLargeVec<Real> r_ij_;  /**< distance between j and i. */
-    StdLargeVec<Vecd> e_ij_;  /**< unit vector pointing from j to i or inter-particle surface direction */
+    StdLargeVec<ParticleIndex> j_; /**< index of the neighbor particle. */
+    StorageLargeVec<Real> W_ij_;   /**< kernel value or particle volume contribution */
+    StorageLargeVec<Real> dW_ij_;  /**< derivative of kernel function or inter-particle surface contribution */
+    StorageLargeVec<Real> r_ij_;   /**< distance between j and i. */
+    StorageLargeVec<Vecd> e_ij_;   /**< unit vector pointing from j to i or inter-particle surface direction */
 
     Neighborhood() : current_size_(0), allocated_size_(0){};
     ~Neighborhood(){};
@@ -4,12 +4,18 @@
 #include "base_body_part.h"
 #include "base_material.h"
 #include "base_particle_generator.h"
+#include "particle_iterators.h"
 #include "xml_parser.h"
 
+#include <cstring>
+
 //=====================================================================================================//
 namespace SPH
 {
 //=================================================================================================//
+/** signature of the binary particle-reload files */
+static const std::string reload_file_signature = "SPHRLD02";
+//=================================================================================================//
 BaseParticles::BaseParticles(SPHBody &sph_body, BaseMaterial *base_material)
     : total_real_particles_(0), real_particles_bound_(0), particles_bound_(0),
       particle_sorting_(*this),
@@ -17,8 +23,8 @@ BaseParticles::BaseParticles(SPHBody &sph_body, BaseMaterial *base_material)
       base_material_(*base_material),
       restart_xml_parser_("xml_restart", "particles"),
       reload_xml_parser_("xml_particle_reload", "particles"),
-      resize_particles_(all_particle_data_),
-      copy_particle_data_(all_particle_data_),
+      resize_particles_(all_particle_data_, all_soa_particle_data_),
+      copy_particle_data_(all_particle_data_, all_soa_particle_data_),
       write_restart_variable_to_xml_(variables_to_restart_, restart_xml_parser_),
       write_reload_variable_to_xml_(variables_to_reload_, reload_xml_parser_),
       read_restart_variable_from_xml_(variables_to_restart_, restart_xml_parser_),
@@ -33,7 +39,7 @@ BaseParticles::BaseParticles(SPHBody &sph_body, BaseMaterial *base_material)
     //		add particle reload data on geometries
     //----------------------------------------------------------------------
     addVariableToList<Vecd>(variables_to_reload_, "Position");
-    addVariableToList<Real>(variables_to_reload_, "VolumetricMeasure");
+    addVariableToList<StorageReal>(variables_to_reload_, "VolumetricMeasure");
 }
 //=================================================================================================//
 void BaseParticles::initializeOtherVariables()
@@ -60,7 +66,7 @@ void BaseParticles::initializeOtherVariables()
     addVariableToList<Vecd>(variables_to_restart_, "Velocity");
     addVariableToList<Vecd>(variables_to_restart_, "ForcePrior");
     addVariableToList<Vecd>(variables_to_restart_, "Force");
-    addVariableToList<Real>(variables_to_restart_, "VolumetricMeasure");
+    addVariableToList<StorageReal>(variables_to_restart_, "VolumetricMeasure");
     //----------------------------------------------------------------------
     //		initialize unregistered data
     //----------------------------------------------------------------------
@@ -132,6 +138,14 @@ void BaseParticles::writePltFileHeader(std::ofstream &output_file)
     {
         output_file << ",\"" << variable->Name() << "\"";
     };
+#if SPHINXSYS_USE_MIXED_PRECISION
+
+    constexpr int type_index_StorageReal = DataTypeIndex<StorageReal>::value;
+    for (DiscreteVariable<StorageReal> *variable : std::get<type_index_StorageReal>(variables_to_write_))
+    {
+        output_file << ",\"" << variable->Name() << "\"";
+    };
+#endif
 }
 //=================================================================================================//
 void BaseParticles::computeDerivedVariables()
@@ -170,6 +184,120 @@ void BaseParticles::writePltFileParticleData(std::ofstream &output_file, size_t
         StdLargeVec<Real> &variable_data = *(std::get<type_index_Real>(all_particle_data_)[variable->IndexInContainer()]);
         output_file << variable_data[index] << " ";
     };
+#if SPHINXSYS_USE_MIXED_PRECISION
+
+    constexpr int type_index_StorageReal = DataTypeIndex<StorageReal>::value;
+    for (DiscreteVariable<StorageReal> *variable : std::get<type_index_StorageReal>(variables_to_write_))
+    {
+        StdLargeVec<StorageReal> &variable_data = *(std::get<type_index_StorageReal>(all_particle_data_)[variable->IndexInContainer()]);
+        output_file << variable_data[index] << " ";
+    };
+#endif
+}
+//=================================================================================================//
+template <typename GetParticleIndex>
+void BaseParticles::writeMappedParticlesToVtkAppendedData(VtkAppendedData &appended_data, size_t number_of_particles,
+                                                          const GetParticleIndex &get_particle_index,
+                                                          const std::set<std::string> &skipped_variables)
+{
+    IndexRange output_range(0, number_of_particles);
+    ParticleIndex *sorted_id = appended_data.addDataArray<ParticleIndex>("SortedParticle_ID", number_of_particles);
+    ParticleIndex *unsorted_id = appended_data.addDataArray<ParticleIndex>("UnsortedParticle_ID", number_of_particles);
+    particle_for(par, output_range,
+                 [&](size_t n)
+                 {
+                     size_t i = get_particle_index(n);
+                     sorted_id[n] = ParticleIndex(i);
+                     unsorted_id[n] = unsorted_id_[i];
+                 });
+
+    constexpr int type_index_int = DataTypeIndex<int>::value;
+    for (DiscreteVariable<int> *variable : std::get<type_index_int>(variables_to_write_))
+    {
+        if (skipped_variables.count(variable->Name()) != 0)
+            continue;
+        StdLargeVec<int> &variable_data = *(std::get<type_index_int>(all_particle_data_)[variable->IndexInContainer()]);
+        int *values = appended_data.addDataArray<int>(variable->Name(), number_of_particles);
+        particle_for(par, output_range, [&](size_t n)
+                     { values[n] = variable_data[get_particle_index(n)]; });
+    }
+
+    constexpr int type_index_Real = DataTypeIndex<Real>::value;
+    for (DiscreteVariable<Real> *variable : std::get<type_index_Real>(variables_to_write_))
+    {
+        if (skipped_variables.count(variable->Name()) != 0)
+            continue;
+        StdLargeVec<Real> &variable_data = *(std::get<type_index_Real>(all_particle_data_)[variable->IndexInContainer()]);
+        Real *values = appended_data.addDataArray<Real>(variable->Name(), number_of_particles);
+        particle_for(par, output_range, [&](size_t n)
+                     { values[n] = variable_data[get_particle_index(n)]; });
+    }
+#if SPHINXSYS_USE_MIXED_PRECISION
+
+    constexpr int type_index_StorageReal = DataTypeIndex<StorageReal>::value;
+    for (DiscreteVariable<StorageReal> *variable : std::get<type_index_StorageReal>(variables_to_write_))
+    {
+        if (skipped_variables.count(variable->Name()) != 0)
+            continue;
+        StdLargeVec<StorageReal> &variable_data = *(std::get<type_index_StorageReal>(all_particle_data_)[variable->IndexInContainer()]);
+        StorageReal *values = appended_data.addDataArray<StorageReal>(variable->Name(), number_of_particles);
+        particle_for(par, output_range, [&](size_t n)
+                     { values[n] = variable_data[get_particle_index(n)]; });
+    }
+#endif
+
+    constexpr int type_index_Vecd = DataTypeIndex<Vecd>::value;
+    for (DiscreteVariable<Vecd> *variable : std::get<type_index_Vecd>(variables_to_write_))
+    {
+        if (skipped_variables.count(variable->Name()) != 0)
+            continue;
+        StdLargeVec<Vecd> &variable_data = *(std::get<type_index_Vecd>(all_particle_data_)[variable->IndexInContainer()]);
+        Real *values = appended_data.addDataArray<Real>(variable->Name(), number_of_particles, 3);
+        particle_for(par, output_range, [&](size_t n)
+                     { Eigen::Map<Vec3d>(values + 3 * n) = upgradeToVec3d(variable_data[get_particle_index(n)]); });
+    }
+
+    constexpr int type_index_Matd = DataTypeIndex<Matd>::value;
+    for (DiscreteVariable<Matd> *variable : std::get<type_index_Matd>(variables_to_write_))
+    {
+        if (skipped_variables.count(variable->Name()) != 0)
+            continue;
+        StdLargeVec<Matd> &variable_data = *(std::get<type_index_Matd>(all_particle_data_)[variable->IndexInContainer()]);
+        Real *values = appended_data.addDataArray<Real>(variable->Name(), number_of_particles, 9);
+        particle_for(par, output_range, [&](size_t n)
+                     { Eigen::Map<Mat3d>(values + 9 * n) = upgradeToMat3d(variable_data[get_particle_index(n)]); });
+    }
+
+    constexpr int type_index_SymMatd = DataTypeIndex<SymMatd>::value;
+    for (DiscreteVariable<SymMatd> *variable : std::get<type_index_SymMatd>(variables_to_write_))
+    {
+        if (skipped_variables.count(variable->Name()) != 0)
+            continue;
+        StdLargeVec<SymMatd> &variable_data = *(std::get<type_index_SymMatd>(all_particle_data_)[variable->IndexInContainer()]);
+        Real *values = appended_data.addDataArray<Real>(variable->Name(), number_of_particles, 9);
+        particle_for(par, output_range, [&](size_t n)
+                     { Eigen::Map<Mat3d>(values + 9 * n) = upgradeToMat3d(variable_data[get_particle_index(n)].toMatrix()); });
+    }
+}
+//=================================================================================================//
+void BaseParticles::writeParticlesToVtkAppendedData(VtkAppendedData &appended_data, const IndexRange &particle_range,
+                                                    const std::set<std::string> &skipped_variables)
+{
+    size_t first = particle_range.begin();
+    writeMappedParticlesToVtkAppendedData(
+        appended_data, particle_range.size(), [&](size_t n)
+        { return first + n; },
+        skipped_variables);
+}
+//=================================================================================================//
+void BaseParticles::writeParticlesToVtkAppendedData(VtkAppendedData &appended_data, const IndexVector &particle_list,
+                                                    const IndexRange &list_range, const std::set<std::string> &skipped_variables)
+{
+    const size_t *listed_particles = particle_list.data() + list_range.begin();
+    writeMappedParticlesToVtkAppendedData(
+        appended_data, list_range.size(), [&](size_t n)
+        { return listed_particles[n]; },
+        skipped_variables);
 }
 //=================================================================================================//
 void BaseParticles::writeParticlesToPltFile(std::ofstream &output_file)
@@ -249,6 +377,27 @@ void BaseParticles::writeSurfaceParticlesToVtuFile(std::ostream &output_file, Bo
         output_file << "    </DataArray>\n";
     }
 
+    // write symmetric matrices
+    constexpr int type_index_SymMatd = DataTypeIndex<SymMatd>::value;
+    for (DiscreteVariable<SymMatd> *variable : std::get<type_index_SymMatd>(variables_to_write_))
+    {
+        StdLargeVec<SymMatd> &variable_data = *(std::get<type_index_SymMatd>(all_particle_data_)[variable->IndexInContainer()]);
+        output_file << "    <DataArray Name=\"" << variable->Name() << "\" type=\"Float32\"  NumberOfComponents=\"9\" Format=\"ascii\">\n";
+        output_file << "    ";
+        for (size_t i = 0; i != total_surface_particles; ++i)
+        {
+            size_t particle_i = surface_particles.body_part_particles_[i];
+            Mat3d matrix_value = upgradeToMat3d(variable_data[particle_i].toMatrix());
+            for (int k = 0; k != 3; ++k)
+            {
+                Vec3d col_vector = matrix_value.col(k);
+                output_file << std::fixed << std::setprecision(9) << col_vector[0] << " " << col_vector[1] << " " << col_vector[2] << " ";
+            }
+        }
+        output_file << std::endl;
+        output_file << "    </DataArray>\n";
+    }
+
     // write vectors
     constexpr int type_index_Vecd = DataTypeIndex<Vecd>::value;
     for (DiscreteVariable<Vecd> *variable : std::get<type_index_Vecd>(variables_to_write_))
@@ -281,6 +430,24 @@ void BaseParticles::writeSurfaceParticlesToVtuFile(std::ostream &output_file, Bo
         output_file << std::endl;
         output_file << "    </DataArray>\n";
     }
+#if SPHINXSYS_USE_MIXED_PRECISION
+
+    // write scalars in storage precision
+    constexpr int type_index_StorageReal = DataTypeIndex<StorageReal>::value;
+    for (DiscreteVariable<StorageReal> *variable : std::get<type_index_StorageReal>(variables_to_write_))
+    {
+        StdLargeVec<StorageReal> &variable_data = *(std::get<type_index_StorageReal>(all_particle_data_)[variable->IndexInContainer()]);
+        output_file << "    <DataArray Name=\"" << variable->Name() << "\" type=\"Float32\" Format=\"ascii\">\n";
+        output_file << "    ";
+        for (size_t i = 0; i != total_surface_particles; ++i)
+        {
+            size_t particle_i = surface_particles.body_part_particles_[i];
+            output_file << std::fixed << std::setprecision(9) << variable_data[particle_i] << " ";
+        }
+        output_file << std::endl;
+        output_file << "    </DataArray>\n";
+    }
+#endif
 
     // write integers
     constexpr int type_index_int = DataTypeIndex<int>::value;
@@ -322,6 +489,46 @@ void BaseParticles::readParticleFromXmlForRestart(std::string &filefullpath)
     read_restart_variable_from_xml_(all_particle_data_);
 }
 //=================================================================================================//
+StdVec<BaseParticles::RawVariableData> BaseParticles::getRawVariableData(ParticleVariables &variables)
+{
+    StdVec<RawVariableData> raw_variable_data;
+    OperationOnDataAssemble<ParticleVariables, CollectRawVariableData>
+        collect_raw_variable_data(variables, raw_variable_data);
+    collect_raw_variable_data(all_particle_data_);
+    return raw_variable_data;
+}
+//=================================================================================================//
+void BaseParticles::writeRawVariableDataToBinary(BinaryDataWriter &writer, const StdVec<RawVariableData> &variables_data)
+{
+    writer.addBlock(body_name_, total_real_particles_);
+    for (const RawVariableData &variable_data : variables_data)
+    {
+        writer.addArray(variable_data.name_, variable_data.type_index_, variable_data.element_size_, variable_data.data_);
+    }
+}
+//=================================================================================================//
+void BaseParticles::readRawVariableDataFromBinary(const BinaryDataReader &reader, const BinaryBlockRecord &block,
+                                                  const StdVec<RawVariableData> &variables_data)
+{
+    for (const RawVariableData &variable_data : variables_data)
+    {
+        auto array_record = std::find_if(block.arrays_.begin(), block.arrays_.end(),
+                                         [&](const BinaryArrayRecord &record)
+                                         { return record.name_ == variable_data.name_; });
+        if (array_record == block.arrays_.end() ||
+            int(array_record->type_index_) != variable_data.type_index_ ||
+            array_record->element_size_ != variable_data.element_size_ ||
+            array_record->bytes_ != variable_data.element_size_ * total_real_particles_)
+        {
+            std::cout << "\n Error: the variable " << variable_data.name_ << " of body "
+                      << body_name_ << " is not found or does not match in the binary file!" << std::endl;
+            std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+            exit(1);
+        }
+        std::memcpy(variable_data.data_, reader.ArrayData(*array_record), array_record->bytes_);
+    }
+}
+//=================================================================================================//
 void BaseParticles::writeToXmlForReloadParticle(std::string &filefullpath)
 {
     resizeXmlDocForParticles(reload_xml_parser_);
@@ -337,9 +544,42 @@ void BaseParticles::readFromXmlForReloadParticle(std::string &filefullpath)
     {
         unsorted_id_.push_back(i);
     };
+    ParticleDataArena::FirstTouchScope first_touch_scope(total_real_particles_);
     resize_particles_(total_real_particles_);
     read_reload_variable_from_xml_(all_particle_data_);
 }
 //=================================================================================================//
+void BaseParticles::writeToBinaryForReloadParticle(std::string &filefullpath, uint64_t source_checksum)
+{
+    BinaryDataWriter writer(reload_file_signature, 0.0, source_checksum);
+    writeRawVariableDataToBinary(writer, getReloadVariableData());
+    writer.writeToFile(filefullpath);
+}
+//=================================================================================================//
+bool BaseParticles::readFromBinaryForReloadParticle(std::string &filefullpath, const std::string &source_filefullpath)
+{
+    BinaryDataReader reader(filefullpath, reload_file_signature);
+    if (!source_filefullpath.empty() && !reader.isUpToDateWith(source_filefullpath))
+    {
+        return false;
+    }
+    if (reader.Blocks().size() != 1)
+    {
+        std::cout << "\n Error: the reload file " << filefullpath << " does not hold a single body!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+    const BinaryBlockRecord &block = reader.Blocks()[0];
+    total_real_particles_ = block.number_of_elements_;
+    for (size_t i = 0; i != total_real_particles_; ++i)
+    {
+        unsorted_id_.push_back(i);
+    };
+    ParticleDataArena::FirstTouchScope first_touch_scope(total_real_particles_);
+    resize_particles_(total_real_particles_);
+    readRawVariableDataFromBinary(reader, block, getReloadVariableData());
+    return true;
+}
+//=================================================================================================//
 } // namespace SPH
   //=====================================================================================================//
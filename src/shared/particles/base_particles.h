@@ -34,11 +34,14 @@
 #include "base_data_package.h"
 #include "base_material.h"
 #include "base_variable.h"
+#include "binary_data_file.h"
 #include "particle_sorting.h"
 #include "sph_data_containers.h"
+#include "vtk_appended_data.h"
 #include "xml_parser.h"
 
 #include <fstream>
+#include <set>
 
 namespace SPH
 {
@@ -97,10 +100,10 @@ class BaseParticles
     StdLargeVec<Vecd> force_;       /**< Force induced by pressure- or stress */
     StdLargeVec<Vecd> force_prior_; /**< Other, such as gravity and viscous, forces computed before force_ */
 
-    StdLargeVec<Real> Vol_;      /**< Volumetric measure, also area and length of surface and linear particle */
-    StdLargeVec<Real> rho_;      /**< Density */
-    StdLargeVec<Real> mass_;     /**< Mass*/
-    StdLargeVec<int> indicator_; /**< particle indicator: 0 for bulk, 1 for free surface indicator, other to be defined */
+    StdLargeVec<StorageReal> Vol_; /**< Volumetric measure, also area and length of surface and linear particle */
+    StdLargeVec<Real> rho_;        /**< Density */
+    StdLargeVec<Real> mass_;       /**< Mass*/
+    StdLargeVec<int> indicator_;   /**< particle indicator: 0 for bulk, 1 for free surface indicator, other to be defined */
     //----------------------------------------------------------------------
     // Global information for defining particle groups
     //----------------------------------------------------------------------
@@ -135,6 +138,14 @@ class BaseParticles
     template <typename DataType>
     StdLargeVec<DataType> *getVariableByName(const std::string &variable_name);
     ParticleVariables &AllDiscreteVariables() { return all_discrete_variables_; };
+    /** register a variable saved in structure-of-arrays layout, which is resized, copied and sorted
+     *  together with other particle data, but not yet included in output and restart. */
+    template <typename DataType>
+    void registerVariable(SoALargeVec<DataType> &variable_addrs, const std::string &variable_name,
+                          DataType initial_value = ZeroData<DataType>::value);
+    template <typename DataType>
+    SoALargeVec<DataType> *getSoAVariableByName(const std::string &variable_name);
+    SoAParticleData &getAllSoAParticleData() { return all_soa_particle_data_; };
 
     template <typename DataType>
     DataType *registerSingleVariable(const std::string &variable_name,
@@ -161,10 +172,11 @@ class BaseParticles
     //----------------------------------------------------------------------
     //		Particle data for sorting
     //----------------------------------------------------------------------
-    StdLargeVec<size_t> unsorted_id_; /**< the ids assigned just after particle generated. */
-    StdLargeVec<size_t> sorted_id_;   /**< the sorted particle ids of particles from unsorted ids. */
-    StdLargeVec<size_t> sequence_;    /**< the sequence referred for sorting. */
+    StdLargeVec<ParticleIndex> unsorted_id_; /**< the ids assigned just after particle generated. */
+    StdLargeVec<ParticleIndex> sorted_id_;   /**< the sorted particle ids of particles from unsorted ids. */
+    StdLargeVec<size_t> sequence_;           /**< the sequence referred for sorting. */
     ParticleData sortable_data_;
+    SoAParticleData sortable_soa_data_;
     ParticleVariables sortable_variables_;
     ParticleSorting particle_sorting_;
 
@@ -177,13 +189,40 @@ class BaseParticles
     //----------------------------------------------------------------------
     template <typename OutStreamType>
     void writeParticlesToVtk(OutStreamType &output_stream);
+    void writeParticlesToVtkAppendedData(VtkAppendedData &appended_data, const IndexRange &particle_range,
+                                         const std::set<std::string> &skipped_variables = {});
+    void writeParticlesToVtkAppendedData(VtkAppendedData &appended_data, const std::set<std::string> &skipped_variables = {})
+    {
+        writeParticlesToVtkAppendedData(appended_data, IndexRange(0, total_real_particles_), skipped_variables);
+    };
+    /** write the particles listed in the given range of a particle list, e.g. a selected subset */
+    void writeParticlesToVtkAppendedData(VtkAppendedData &appended_data, const IndexVector &particle_list,
+                                         const IndexRange &list_range, const std::set<std::string> &skipped_variables = {});
     void writeParticlesToPltFile(std::ofstream &output_file);
     virtual void writeSurfaceParticlesToVtuFile(std::ostream &output_file, BodySurface &surface_particles);
     void resizeXmlDocForParticles(XmlParser &xml_parser);
     void writeParticlesToXmlForRestart(std::string &filefullpath);
     void readParticleFromXmlForRestart(std::string &filefullpath);
+    /** address of the contiguous data of a particle variable for binary input and output */
+    struct RawVariableData
+    {
+        std::string name_;
+        int type_index_;
+        size_t element_size_;
+        char *data_;
+    };
+    StdVec<RawVariableData> getRestartVariableData() { return getRawVariableData(variables_to_restart_); };
+    StdVec<RawVariableData> getReloadVariableData() { return getRawVariableData(variables_to_reload_); };
+    /** add the real particles of the given variables as a block named after the body */
+    void writeRawVariableDataToBinary(BinaryDataWriter &writer, const StdVec<RawVariableData> &variables_data);
+    /** copy the arrays of a block into the given variables, the number of real particles should be set before */
+    void readRawVariableDataFromBinary(const BinaryDataReader &reader, const BinaryBlockRecord &block,
+                                       const StdVec<RawVariableData> &variables_data);
     void writeToXmlForReloadParticle(std::string &filefullpath);
     void readFromXmlForReloadParticle(std::string &filefullpath);
+    void writeToBinaryForReloadParticle(std::string &filefullpath, uint64_t source_checksum = 0);
+    /** read the binary file unless it is outdated by the source file, and return whether it is read */
+    bool readFromBinaryForReloadParticle(std::string &filefullpath, const std::string &source_filefullpath = "");
     XmlParser *getReloadXmlParser() { return &reload_xml_parser_; };
     virtual BaseParticles *ThisObjectPtr() { return this; };
     //----------------------------------------------------------------------
@@ -200,6 +239,8 @@ class BaseParticles
     XmlParser reload_xml_parser_;
     ParticleData all_particle_data_;
     ParticleVariables all_discrete_variables_;
+    SoAParticleData all_soa_particle_data_;
+    ParticleVariables all_soa_variables_;
     SingleVariables all_single_variables_;
     ParticleVariables variables_to_write_;
     ParticleVariables variables_to_restart_;
@@ -211,14 +252,21 @@ class BaseParticles
     //----------------------------------------------------------------------
     //		Small structs for generalize particle operations
     //----------------------------------------------------------------------
+    /** Particle data in structure-of-arrays layout is handled together with that of the same data type. */
     struct ResizeParticles
     {
+        SoAParticleData &soa_particle_data_;
+        explicit ResizeParticles(SoAParticleData &soa_particle_data) : soa_particle_data_(soa_particle_data){};
+
         template <typename DataType>
         void operator()(DataContainerAddressKeeper<StdLargeVec<DataType>> &data_keeper, size_t new_size);
     };
 
     struct CopyParticleData
     {
+        SoAParticleData &soa_particle_data_;
+        explicit CopyParticleData(SoAParticleData &soa_particle_data) : soa_particle_data_(soa_particle_data){};
+
         template <typename DataType>
         void operator()(DataContainerAddressKeeper<StdLargeVec<DataType>> &data_keeper, size_t index, size_t another_index);
     };
@@ -232,6 +280,15 @@ class BaseParticles
         void operator()(DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables, ParticleData &all_particle_data);
     };
 
+    struct CollectRawVariableData
+    {
+        StdVec<RawVariableData> &raw_variable_data_;
+        CollectRawVariableData(StdVec<RawVariableData> &raw_variable_data) : raw_variable_data_(raw_variable_data){};
+
+        template <typename DataType>
+        void operator()(DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables, ParticleData &all_particle_data);
+    };
+
     struct ReadAParticleVariableFromXml
     {
         XmlParser &xml_parser_;
@@ -251,6 +308,12 @@ class BaseParticles
   protected:
     OperationOnDataAssemble<ParticleVariables, WriteAParticleVariableToXml> write_restart_variable_to_xml_, write_reload_variable_to_xml_;
     OperationOnDataAssemble<ParticleVariables, ReadAParticleVariableFromXml> read_restart_variable_from_xml_, read_reload_variable_from_xml_;
+    StdVec<RawVariableData> getRawVariableData(ParticleVariables &variables);
+    /** the n-th written particle is given by the particle index function */
+    template <typename GetParticleIndex>
+    void writeMappedParticlesToVtkAppendedData(VtkAppendedData &appended_data, size_t number_of_particles,
+                                               const GetParticleIndex &get_particle_index,
+                                               const std::set<std::string> &skipped_variables);
 };
 
 /**
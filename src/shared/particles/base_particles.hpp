@@ -19,9 +19,11 @@ void BaseParticles::registerVariable(StdLargeVec<DataType> &variable_addrs,
                                      const std::string &variable_name, DataType initial_value)
 {
     DiscreteVariable<DataType> *variable = findVariableByName<DataType>(all_discrete_variables_, variable_name);
+    DiscreteVariable<DataType> *soa_variable = findVariableByName<DataType>(all_soa_variables_, variable_name);
 
-    if (variable == nullptr)
+    if (variable == nullptr && soa_variable == nullptr)
     {
+        ParticleDataArena::FirstTouchScope first_touch_scope(total_real_particles_);
         variable_addrs.resize(particles_bound_, initial_value);
 
         constexpr int type_index = DataTypeIndex<DataType>::value;
@@ -51,6 +53,48 @@ void BaseParticles::registerVariable(StdLargeVec<DataType> &variable_addrs,
 }
 //=================================================================================================//
 template <typename DataType>
+void BaseParticles::registerVariable(SoALargeVec<DataType> &variable_addrs,
+                                     const std::string &variable_name, DataType initial_value)
+{
+    DiscreteVariable<DataType> *variable = findVariableByName<DataType>(all_discrete_variables_, variable_name);
+    DiscreteVariable<DataType> *soa_variable = findVariableByName<DataType>(all_soa_variables_, variable_name);
+
+    if (variable == nullptr && soa_variable == nullptr)
+    {
+        ParticleDataArena::FirstTouchScope first_touch_scope(total_real_particles_);
+        variable_addrs.resize(particles_bound_, initial_value);
+
+        constexpr int type_index = DataTypeIndex<DataType>::value;
+        std::get<type_index>(all_soa_particle_data_).push_back(&variable_addrs);
+        size_t new_variable_index = std::get<type_index>(all_soa_particle_data_).size() - 1;
+
+        addVariableToAssemble<DataType>(all_soa_variables_, all_discrete_variable_ptrs_, variable_name, new_variable_index);
+    }
+    else
+    {
+        std::cout << "\n Error: the variable '" << variable_name << "' has already been registered!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+}
+//=================================================================================================//
+template <typename DataType>
+SoALargeVec<DataType> *BaseParticles::getSoAVariableByName(const std::string &variable_name)
+{
+    DiscreteVariable<DataType> *variable = findVariableByName<DataType>(all_soa_variables_, variable_name);
+
+    if (variable != nullptr)
+    {
+        constexpr int type_index = DataTypeIndex<DataType>::value;
+        return std::get<type_index>(all_soa_particle_data_)[variable->IndexInContainer()];
+    }
+
+    std::cout << "\nError: the variable '" << variable_name << "' is not registered in structure-of-arrays layout!\n";
+    std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+    return nullptr;
+}
+//=================================================================================================//
+template <typename DataType>
 DataType *BaseParticles::registerSingleVariable(const std::string &variable_name, DataType initial_value)
 {
     SingleVariable<DataType> *variable = findVariableByName<DataType>(all_single_variables_, variable_name);
@@ -170,18 +214,26 @@ template <typename DataType>
 void BaseParticles::registerSortableVariable(const std::string &variable_name)
 {
     DiscreteVariable<DataType> *variable = findVariableByName<DataType>(all_discrete_variables_, variable_name);
+    DiscreteVariable<DataType> *soa_variable = findVariableByName<DataType>(all_soa_variables_, variable_name);
+    constexpr int type_index = DataTypeIndex<DataType>::value;
 
-    if (variable != nullptr)
+    if (variable != nullptr || soa_variable != nullptr)
     {
         DiscreteVariable<DataType> *listed_variable = findVariableByName<DataType>(sortable_variables_, variable_name);
 
-        if (listed_variable == nullptr)
+        if (listed_variable == nullptr && variable != nullptr)
         {
-            constexpr int type_index = DataTypeIndex<DataType>::value;
             std::get<type_index>(sortable_variables_).push_back(variable);
             StdLargeVec<DataType> *variable_data = std::get<type_index>(all_particle_data_)[variable->IndexInContainer()];
             std::get<type_index>(sortable_data_).push_back(variable_data);
         }
+
+        if (listed_variable == nullptr && soa_variable != nullptr)
+        {
+            std::get<type_index>(sortable_variables_).push_back(soa_variable);
+            SoALargeVec<DataType> *variable_data = std::get<type_index>(all_soa_particle_data_)[soa_variable->IndexInContainer()];
+            std::get<type_index>(sortable_soa_data_).push_back(variable_data);
+        }
     }
     else
     {
@@ -206,6 +258,12 @@ operator()(DataContainerAddressKeeper<StdLargeVec<DataType>> &data_keeper, size_
     {
         data_keeper[i]->resize(new_size, ZeroData<DataType>::value);
     }
+
+    constexpr int type_index = DataTypeIndex<DataType>::value;
+    for (SoALargeVec<DataType> *soa_data : std::get<type_index>(soa_particle_data_))
+    {
+        soa_data->resize(new_size, ZeroData<DataType>::value);
+    }
 }
 //=================================================================================================//
 template <typename DataType>
@@ -216,6 +274,12 @@ operator()(DataContainerAddressKeeper<StdLargeVec<DataType>> &data_keeper, size_
     {
         (*data_keeper[i])[index] = (*data_keeper[i])[another_index];
     }
+
+    constexpr int type_index = DataTypeIndex<DataType>::value;
+    for (SoALargeVec<DataType> *soa_data : std::get<type_index>(soa_particle_data_))
+    {
+        soa_data->copyValue(index, another_index);
+    }
 }
 //=================================================================================================//
 template <typename DataType>
@@ -252,6 +316,19 @@ operator()(DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables, Pa
     }
 }
 //=================================================================================================//
+template <typename DataType>
+void BaseParticles::CollectRawVariableData::
+operator()(DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables, ParticleData &all_particle_data)
+{
+    constexpr int type_index = DataTypeIndex<DataType>::value;
+    for (DiscreteVariable<DataType> *variable : variables)
+    {
+        StdLargeVec<DataType> &variable_data = *(std::get<type_index>(all_particle_data)[variable->IndexInContainer()]);
+        raw_variable_data_.push_back(
+            {variable->Name(), type_index, sizeof(DataType), reinterpret_cast<char *>(variable_data.data())});
+    }
+}
+//=================================================================================================//
 template <typename StreamType>
 void BaseParticles::writeParticlesToVtk(StreamType &output_stream)
 {
@@ -306,6 +383,23 @@ void BaseParticles::writeParticlesToVtk(StreamType &output_stream)
         output_stream << std::endl;
         output_stream << "    </DataArray>\n";
     }
+#if SPHINXSYS_USE_MIXED_PRECISION
+
+    // write scalars in storage precision
+    constexpr int type_index_StorageReal = DataTypeIndex<StorageReal>::value;
+    for (DiscreteVariable<StorageReal> *variable : std::get<type_index_StorageReal>(variables_to_write_))
+    {
+        StdLargeVec<StorageReal> &variable_data = *(std::get<type_index_StorageReal>(all_particle_data_)[variable->IndexInContainer()]);
+        output_stream << "    <DataArray Name=\"" << variable->Name() << "\" type=\"Float32\" Format=\"ascii\">\n";
+        output_stream << "    ";
+        for (size_t i = 0; i != total_real_particles; ++i)
+        {
+            output_stream << std::fixed << std::setprecision(9) << variable_data[i] << " ";
+        }
+        output_stream << std::endl;
+        output_stream << "    </DataArray>\n";
+    }
+#endif
 
     // write vectors
     constexpr int type_index_Vecd = DataTypeIndex<Vecd>::value;
@@ -342,6 +436,26 @@ void BaseParticles::writeParticlesToVtk(StreamType &output_stream)
         output_stream << std::endl;
         output_stream << "    </DataArray>\n";
     }
+
+    // write symmetric matrices
+    constexpr int type_index_SymMatd = DataTypeIndex<SymMatd>::value;
+    for (DiscreteVariable<SymMatd> *variable : std::get<type_index_SymMatd>(variables_to_write_))
+    {
+        StdLargeVec<SymMatd> &variable_data = *(std::get<type_index_SymMatd>(all_particle_data_)[variable->IndexInContainer()]);
+        output_stream << "    <DataArray Name=\"" << variable->Name() << "\" type= \"Float32\"  NumberOfComponents=\"9\" Format=\"ascii\">\n";
+        output_stream << "    ";
+        for (size_t i = 0; i != total_real_particles; ++i)
+        {
+            Mat3d matrix_value = upgradeToMat3d(variable_data[i].toMatrix());
+            for (int k = 0; k != 3; ++k)
+            {
+                Vec3d col_vector = matrix_value.col(k);
+                output_stream << std::fixed << std::setprecision(9) << col_vector[0] << " " << col_vector[1] << " " << col_vector[2] << " ";
+            }
+        }
+        output_stream << std::endl;
+        output_stream << "    </DataArray>\n";
+    }
 }
 //=================================================================================================//
 template <typename DataType>
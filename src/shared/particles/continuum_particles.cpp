@@ -25,13 +25,13 @@ void ContinuumParticles::initializeOtherVariables()
     //		register sortable particle data
     //----------------------------------------------------------------------
     registerSortableVariable<Vecd>("AccelerationByShear");
-    registerSortableVariable<Matd>("ShearStress");
-    registerSortableVariable<Matd>("ShearStressRate");
+    registerSortableVariable<SymMatd>("ShearStress");
+    registerSortableVariable<SymMatd>("ShearStressRate");
     registerSortableVariable<Real>("VonMisesStress");
     registerSortableVariable<Real>("VonMisesStrain");
     registerSortableVariable<Matd>("VelocityGradient");
-    registerSortableVariable<Matd>("StrainTensor");
-    registerSortableVariable<Matd>("StrainTensorRate");
+    registerSortableVariable<SymMatd>("StrainTensor");
+    registerSortableVariable<SymMatd>("StrainTensorRate");
     //----------------------------------------------------------------------
     registerVariable(pos0_, "InitialPosition", [&](size_t i) -> Vecd
                      { return pos_[i]; });
@@ -62,20 +62,19 @@ void PlasticContinuumParticles::initializeOtherVariables()
     //----------------------------------------------------------------------
     //		register sortable particle data
     //----------------------------------------------------------------------
-    registerSortableVariable<Mat3d>("ElasticStrainTensor3D");
-    registerSortableVariable<Mat3d>("ElasticStrainRate3D");
-    registerSortableVariable<Mat3d>("StrainTensor3D");
-    registerSortableVariable<Mat3d>("StressTensor3D");
-    registerSortableVariable<Mat3d>("StrainRate3D");
-    registerSortableVariable<Mat3d>("StressRate3D");
+    registerSortableVariable<SymMat3d>("ElasticStrainTensor3D");
+    registerSortableVariable<SymMat3d>("ElasticStrainRate3D");
+    registerSortableVariable<SymMat3d>("StrainTensor3D");
+    registerSortableVariable<SymMat3d>("StressTensor3D");
+    registerSortableVariable<SymMat3d>("StrainRate3D");
+    registerSortableVariable<SymMat3d>("StressRate3D");
     registerSortableVariable<Real>("VerticalStress");
     registerSortableVariable<Real>("AccDeviatoricPlasticStrain");
 }
 //=================================================================================================//
-Real PlasticContinuumParticles::getDeviatoricPlasticStrain(Mat3d &strain_tensor)
+Real PlasticContinuumParticles::getDeviatoricPlasticStrain(const SymMat3d &strain_tensor)
 {
-    Mat3d deviatoric_strain_tensor = strain_tensor - (1.0 / (Real)Dimensions) * strain_tensor.trace() * Mat3d::Identity();
-    Real sum = (deviatoric_strain_tensor.cwiseProduct(deviatoric_strain_tensor)).sum();
-    return sqrt(sum * 2.0 / 3.0);
+    SymMat3d deviatoric_strain_tensor = strain_tensor - (1.0 / (Real)Dimensions) * strain_tensor.trace() * SymMat3d::Identity();
+    return sqrt(deviatoric_strain_tensor.squaredNorm() * 2.0 / 3.0);
 }
 } // namespace SPH
\ No newline at end of file
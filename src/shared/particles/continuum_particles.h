@@ -37,12 +37,12 @@ class GeneralContinuum;
 class ContinuumParticles : public BaseParticles
 {
   public:
-    StdLargeVec<Matd> strain_tensor_;
-    StdLargeVec<Matd> strain_tensor_rate_;
+    StdLargeVec<SymMatd> strain_tensor_;
+    StdLargeVec<SymMatd> strain_tensor_rate_;
     StdLargeVec<Vecd> acc_shear_;
 
-    StdLargeVec<Matd> shear_stress_;
-    StdLargeVec<Matd> shear_stress_rate_;
+    StdLargeVec<SymMatd> shear_stress_;
+    StdLargeVec<SymMatd> shear_stress_rate_;
     StdLargeVec<Matd> velocity_gradient_;
 
     StdLargeVec<Real> von_mises_stress_;
@@ -64,18 +64,18 @@ class ContinuumParticles : public BaseParticles
 class PlasticContinuumParticles : public ContinuumParticles
 {
   public:
-    StdLargeVec<Mat3d> elastic_strain_tensor_3D_;
-    StdLargeVec<Mat3d> elastic_strain_rate_3D_;
+    StdLargeVec<SymMat3d> elastic_strain_tensor_3D_;
+    StdLargeVec<SymMat3d> elastic_strain_rate_3D_;
 
-    StdLargeVec<Mat3d> strain_tensor_3D_;
-    StdLargeVec<Mat3d> stress_tensor_3D_;
-    StdLargeVec<Mat3d> strain_rate_3D_;
-    StdLargeVec<Mat3d> stress_rate_3D_;
+    StdLargeVec<SymMat3d> strain_tensor_3D_;
+    StdLargeVec<SymMat3d> stress_tensor_3D_;
+    StdLargeVec<SymMat3d> strain_rate_3D_;
+    StdLargeVec<SymMat3d> stress_rate_3D_;
 
     StdLargeVec<Real> vertical_stress_;
     StdLargeVec<Real> acc_deviatoric_plastic_strain_;
 
-    Real getDeviatoricPlasticStrain(Mat3d &strain_tensor);
+    Real getDeviatoricPlasticStrain(const SymMat3d &strain_tensor);
 
     PlasticContinuum &plastic_continuum_;
 
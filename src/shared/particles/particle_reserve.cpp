@@ -1,5 +1,7 @@
 #include "particle_reserve.h"
 
+#include "base_body_relation.h"
+
 namespace SPH
 {
 //=================================================================================================//
@@ -35,6 +37,7 @@ void ParticleBuffer<Base>::allocateBufferParticles(BaseParticles &base_particles
     base_particles.increaseAllParticlesBounds(buffer_size);
     size_t new_bound = base_particles.real_particles_bound_;
 
+    ParticleDataArena::FirstTouchScope first_touch_scope(base_particles.total_real_particles_);
     base_particles.resize_particles_(new_bound);
     for (size_t i = old_bound; i != new_bound; ++i)
     {
@@ -42,6 +45,40 @@ void ParticleBuffer<Base>::allocateBufferParticles(BaseParticles &base_particles
     }
 }
 //=================================================================================================//
+void ParticleBuffer<Base>::prepareBufferParticles(BaseParticles &base_particles, size_t expected_size)
+{
+    size_t available_size = base_particles.real_particles_bound_ - base_particles.total_real_particles_;
+    if (growth_factor_ > 0.0 && available_size < expected_size)
+    {
+        size_t growth_size = std::ceil(Real(base_particles.real_particles_bound_) * growth_factor_);
+        growBufferParticles(base_particles, SMAX(expected_size - available_size, growth_size));
+    }
+}
+//=================================================================================================//
+void ParticleBuffer<Base>::growBufferParticles(BaseParticles &base_particles, size_t buffer_size)
+{
+    if (base_particles.particles_bound_ != base_particles.real_particles_bound_)
+    {
+        std::cout << "\n ERROR: The buffer can not grow when ghost particles are reserved!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+
+    size_t old_bound = base_particles.real_particles_bound_;
+    allocateBufferParticles(base_particles, buffer_size);
+    size_t new_bound = base_particles.real_particles_bound_;
+    for (size_t i = old_bound; i != new_bound; ++i)
+    {
+        base_particles.sorted_id_.push_back(i);
+        base_particles.sequence_.push_back(0);
+    }
+
+    for (SPHRelation *relation : base_particles.getSPHBody().getBodyRelations())
+    {
+        relation->resizeConfiguration();
+    }
+}
+//=================================================================================================//
 void Ghost<Base>::checkWithinGhostSize(const ParticlesBound &ghost_bound)
 {
     if (ghost_bound.second - ghost_bound.first > ghost_size_)
@@ -61,6 +98,7 @@ size_t Ghost<Base>::allocateGhostParticles(BaseParticles &base_particles, size_t
 {
     size_t ghost_lower_bound = base_particles.particles_bound_;
     base_particles.particles_bound_ += ghost_size;
+    ParticleDataArena::FirstTouchScope first_touch_scope(base_particles.total_real_particles_);
     base_particles.resize_particles_(base_particles.particles_bound_);
     base_particles.unsorted_id_.resize(base_particles.particles_bound_, 0);
     return ghost_lower_bound;
@@ -70,6 +70,16 @@ class ParticleBuffer<Base> : public ParticleReserve
     virtual ~ParticleBuffer(){};
     void checkEnoughBuffer(BaseParticles &base_particles);
     void allocateBufferParticles(BaseParticles &base_particles, size_t buffer_size);
+    /** Let the buffer grow on demand by at least growth_factor times of the present particle bound.
+     *  Note that it is not allowed when ghost particles are reserved behind the buffer. */
+    void setElasticGrowth(Real growth_factor = 0.5) { growth_factor_ = growth_factor; };
+    /** Make sure that the buffer is enough for the expected number of switched particles.
+     *  As all particle data may be reallocated, it should be called out of any parallel loop. */
+    void prepareBufferParticles(BaseParticles &base_particles, size_t expected_size);
+
+  protected:
+    Real growth_factor_ = 0.0;
+    void growBufferParticles(BaseParticles &base_particles, size_t buffer_size);
 };
 
 template <class BufferSizeEstimator>
@@ -12,7 +12,9 @@ SwapSortableParticleData::SwapSortableParticleData(BaseParticles &base_particles
     : sequence_(base_particles.sequence_),
       unsorted_id_(base_particles.unsorted_id_),
       sortable_data_(base_particles.sortable_data_),
-      swap_particle_data_value_(sortable_data_) {}
+      sortable_soa_data_(base_particles.sortable_soa_data_),
+      swap_particle_data_value_(sortable_data_),
+      swap_soa_particle_data_value_(sortable_soa_data_) {}
 //=================================================================================================//
 void SwapSortableParticleData::operator()(size_t *a, size_t *b)
 {
@@ -22,6 +24,7 @@ void SwapSortableParticleData::operator()(size_t *a, size_t *b)
     size_t index_b = b - sequence_.data();
     std::swap(unsorted_id_[index_a], unsorted_id_[index_b]);
     swap_particle_data_value_(index_a, index_b);
+    swap_soa_particle_data_value_(index_a, index_b);
 }
 //=================================================================================================//
 ParticleSorting::ParticleSorting(BaseParticles &base_particles)
@@ -40,8 +43,8 @@ void ParticleSorting::sortingParticleData(size_t *begin, size_t size)
 //=================================================================================================//
 void ParticleSorting::updateSortedId()
 {
-    const StdLargeVec<size_t> &unsorted_id = base_particles_.unsorted_id_;
-    StdLargeVec<size_t> &sorted_id = base_particles_.sorted_id_;
+    const StdLargeVec<ParticleIndex> &unsorted_id = base_particles_.unsorted_id_;
+    StdLargeVec<ParticleIndex> &sorted_id = base_particles_.sorted_id_;
     size_t total_real_particles = base_particles_.total_real_particles_;
     parallel_for(
         IndexRange(0, total_real_particles),
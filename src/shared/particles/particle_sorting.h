@@ -209,6 +209,15 @@ struct SwapParticleDataValue
             std::swap(variable[index_a], variable[index_b]);
         }
     };
+
+    template <typename DataType>
+    void operator()(DataContainerAddressKeeper<SoALargeVec<DataType>> &data_keeper, size_t index_a, size_t index_b) const
+    {
+        for (size_t i = 0; i != data_keeper.size(); ++i)
+        {
+            data_keeper[i]->swapValues(index_a, index_b);
+        }
+    };
 };
 
 /**
@@ -231,9 +240,11 @@ class SwapSortableParticleData
 {
   protected:
     StdLargeVec<size_t> &sequence_;
-    StdLargeVec<size_t> &unsorted_id_;
+    StdLargeVec<ParticleIndex> &unsorted_id_;
     ParticleData &sortable_data_;
+    SoAParticleData &sortable_soa_data_;
     OperationOnDataAssemble<ParticleData, SwapParticleDataValue> swap_particle_data_value_;
+    OperationOnDataAssemble<SoAParticleData, SwapParticleDataValue> swap_soa_particle_data_value_;
 
   public:
     explicit SwapSortableParticleData(BaseParticles &base_particles);
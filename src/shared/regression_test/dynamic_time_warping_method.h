@@ -34,9 +34,24 @@
 
 namespace SPH
 {
+/** the p norm of the difference between two observed values. */
+inline Real dtwPNorm(Real variable_a, Real variable_b) { return std::abs(variable_a - variable_b); };
+template <typename Variable>
+Real dtwPNorm(const Variable &variable_a, const Variable &variable_b) { return (variable_a - variable_b).norm(); };
+/**
+ * @brief The dtw distance between two series within a Sakoe-Chiba band.
+ * @details Only two rows of the cost matrix are kept. The computation is abandoned
+ * 			once the minimum of a row exceeds the upper bound, and this lower bound is returned instead.
+ */
+template <typename VariableType>
+Real bandedDTWDistance(const StdVec<VariableType> &series_a, const StdVec<VariableType> &series_b, Real upper_bound = MaxReal);
+
 /**
  * @class RegressionTestDynamicTimeWarping
  * @brief the regression test is based on the dynamic time warping.
+ * @details The reference results and DTW distances are stored in binary files,
+ * 			and the DTW distance is computed by bandedDTWDistance.
+ * 			A database in the legacy xml format is converted to the binary format when it is first used.
  */
 template <class ObserveMethodType>
 class RegressionTestDynamicTimeWarping : public RegressionTestTimeAverage<ObserveMethodType>
@@ -45,41 +60,39 @@ class RegressionTestDynamicTimeWarping : public RegressionTestTimeAverage<Observ
     using VariableType = decltype(ObserveMethodType::type_indicator_);
 
   protected:
-    std::string dtw_distance_filefullpath_; /* the path for DTW distance. */
-    XmlEngine dtw_distance_xml_engine_in_;  /* xml engine for dtw distance input. */
-    XmlEngine dtw_distance_xml_engine_out_; /* xml engine for dtw distance output. */
+    std::string dtw_distance_filefullpath_;        /* the path for DTW distance. */
+    std::string legacy_dtw_distance_filefullpath_; /* the path for DTW distance in the legacy xml database. */
+    XmlEngine dtw_distance_xml_engine_in_;         /* xml engine for legacy dtw distance input. */
 
     StdVec<Real> dtw_distance_, dtw_distance_new_; /* the container of DTW distance between each pairs. */
 
-    /** the method used for calculating the p_norm. (calculateDTWDistance) */
-    Real calculatePNorm(Real variable_a, Real variable_b)
-    {
-        return std::abs(variable_a - variable_b);
-    };
-    template <typename Variable>
-    Real calculatePNorm(const Variable &variable_a, const Variable variable_b)
-    {
-        return (variable_a - variable_b).norm();
-    };
-
-    /** the local constrained method used for calculating the dtw distance between two lines. */
-    StdVec<Real> calculateDTWDistance(BiVector<VariableType> dataset_a_, BiVector<VariableType> dataset_b_);
+    /** the banded dtw distances of all observations computed in parallel. */
+    StdVec<Real> calculateBandedDTWDistance(const BiVector<VariableType> &dataset_a, const BiVector<VariableType> &dataset_b,
+                                            const StdVec<Real> &upper_bounds);
+    std::string referenceResultPath(int index_of_run, const std::string &extension = ".bin");
+    /** convert the legacy xml reference results and recompute their distances with the banded method. */
+    void convertLegacyDatabase();
 
   public:
     template <typename... Args>
     explicit RegressionTestDynamicTimeWarping(Args &&...args)
         : RegressionTestTimeAverage<ObserveMethodType>(std::forward<Args>(args)...),
-          dtw_distance_xml_engine_in_("dtw_distance_xml_engine_in", "dtw_distance"),
-          dtw_distance_xml_engine_out_("dtw_distance_xml_engine_out", "dtw_distance")
+          dtw_distance_xml_engine_in_("dtw_distance_xml_engine_in", "dtw_distance")
     {
-        dtw_distance_filefullpath_ = this->input_folder_path_ + "/" + this->dynamics_identifier_name_ + "_" + this->quantity_name_ + "_dtwdistance.xml";
+        std::string file_path = this->input_folder_path_ + "/" + this->dynamics_identifier_name_ + "_" + this->quantity_name_;
+        dtw_distance_filefullpath_ = file_path + "_dtwdistance.bin";
+        legacy_dtw_distance_filefullpath_ = file_path + "_dtwdistance.xml";
     };
     virtual ~RegressionTestDynamicTimeWarping(){};
 
     void setupTheTest();                           /** setup the test and defined basic variables. */
-    void readDTWDistanceFromXml();                 /** read the old DTW distance from the .xml file. */
+    void readDTWDistanceFromXml();                 /** read the old DTW distance from the legacy .xml file. */
+    void readDTWDistance();                        /** read the old DTW distance from the .bin file. */
     void updateDTWDistance();                      /** update the maximum DTWDistance with the new result. */
-    void writeDTWDistanceToXml();                  /* write the updated DTWDistance to .xml file.*/
+    void writeDTWDistance();                       /* write the updated DTWDistance to .bin file.*/
+    void readReferenceResult(int index_of_run);    /* read the result with the specified index from the .bin file. */
+    void writeReferenceResult(int index_of_run);   /* write the current result with the specified index to the .bin file. */
+    void writeReferenceResult(int index_of_run, const BiVector<VariableType> &result); /* write the given result to the .bin file. */
     bool compareDTWDistance(Real threshold_value); /* compare the DTWDistance if converged. */
     void resultTest();                             /** test the new result if it is converged within the range. */
 
@@ -94,15 +107,15 @@ class RegressionTestDynamicTimeWarping : public RegressionTestTimeAverage<Observ
             setupTheTest();
             if (filter == "true")
                 this->filterExtremeValues();
-            readDTWDistanceFromXml();
+            readDTWDistance();
             /* loop all existed result to get maximum dtw distance. */
             for (int n = 0; n != (this->number_of_run_ - 1); ++n)
             {
-                this->readResultFromXml(n);
+                readReferenceResult(n);
                 updateDTWDistance();
             }
-            this->writeResultToXml(this->number_of_run_ - 1);
-            writeDTWDistanceToXml();
+            writeReferenceResult(this->number_of_run_ - 1);
+            writeDTWDistance();
             compareDTWDistance(threshold_value);
         }
         else
@@ -118,16 +131,15 @@ class RegressionTestDynamicTimeWarping : public RegressionTestTimeAverage<Observ
         setupTheTest();
         if (filter == "true")
             this->filterExtremeValues();
-        readDTWDistanceFromXml();
+        readDTWDistance();
         for (int n = 0; n != this->number_of_run_; ++n)
         {
-            this->result_filefullpath_ = this->input_folder_path_ + "/" + this->dynamics_identifier_name_ + "_" + this->quantity_name_ + "_Run_" + std::to_string(n) + "_result.xml";
-            if (!fs::exists(this->result_filefullpath_))
+            if (!fs::exists(referenceResultPath(n)))
             {
                 std::cout << "This result has not been preserved and will not be compared." << std::endl;
                 continue;
             }
-            this->readResultFromXml(n);
+            readReferenceResult(n);
             resultTest();
         }
         std::cout << "The result of " << this->quantity_name_
@@ -13,44 +13,78 @@
 namespace SPH
 {
 //=================================================================================================//
+template <typename VariableType>
+Real bandedDTWDistance(const StdVec<VariableType> &series_a, const StdVec<VariableType> &series_b, Real upper_bound)
+{
+    int a_length = series_a.size();
+    int b_length = series_b.size();
+    int window_size = SMAX(5, ABS(a_length - b_length));
+
+    /** only the previous and current rows within the band are kept. */
+    StdVec<Real> previous_row(b_length, MaxReal), current_row(b_length, MaxReal);
+    int previous_begin = 0, previous_end = 0;
+    for (int index_i = 0; index_i != a_length; ++index_i)
+    {
+        int begin = SMAX(0, index_i - window_size);
+        int end = SMIN(b_length, index_i + window_size + 1);
+        Real row_minimum = MaxReal;
+        for (int index_j = begin; index_j != end; ++index_j)
+        {
+            Real upper = (index_j >= previous_begin && index_j < previous_end) ? previous_row[index_j] : MaxReal;
+            Real diagonal = (index_j > previous_begin && index_j <= previous_end) ? previous_row[index_j - 1] : MaxReal;
+            Real left = index_j > begin ? current_row[index_j - 1] : MaxReal;
+            Real accumulated = (index_i == 0 && index_j == 0) ? 0.0 : SMIN(upper, left, diagonal);
+            current_row[index_j] = accumulated + dtwPNorm(series_a[index_i], series_b[index_j]);
+            row_minimum = SMIN(row_minimum, current_row[index_j]);
+        }
+        /** each warping path passes this row, so its minimum is a lower bound of the distance. */
+        if (row_minimum > upper_bound)
+            return row_minimum;
+        std::swap(previous_row, current_row);
+        previous_begin = begin;
+        previous_end = end;
+    }
+    return previous_row[b_length - 1];
+};
+//=================================================================================================//
 template <class ObserveMethodType>
-StdVec<Real> RegressionTestDynamicTimeWarping<ObserveMethodType>::calculateDTWDistance(BiVector<VariableType> dataset_a_, BiVector<VariableType> dataset_b_)
+StdVec<Real> RegressionTestDynamicTimeWarping<ObserveMethodType>::
+    calculateBandedDTWDistance(const BiVector<VariableType> &dataset_a, const BiVector<VariableType> &dataset_b,
+                               const StdVec<Real> &upper_bounds)
 {
-    /* define the container to hold the dtw distance.*/
-    StdVec<Real> dtw_distance;
     for (int observation_index = 0; observation_index != this->observation_; ++observation_index)
     {
-        int window_size_ = 5;
-        int a_length = dataset_a_[observation_index].size();
-        int b_length = dataset_b_[observation_index].size();
-
+        int a_length = dataset_a[observation_index].size();
+        int b_length = dataset_b[observation_index].size();
         if (b_length > 1.1 * a_length || b_length < 0.9 * a_length)
         {
             std::cout << "\n Error: please check the time step change, because the data length changed a lot !" << std::endl;
             std::cout << __FILE__ << ':' << __LINE__ << std::endl;
             exit(1);
         }
-
-        /** create a 2D vector with [a_length, b_length] to contain the local DTW distance value. */
-        BiVector<Real> local_dtw_distance(a_length, StdVec<Real>(b_length, 0));
-        local_dtw_distance[0][0] = calculatePNorm(dataset_a_[observation_index][0], dataset_b_[observation_index][0]);
-        for (int index_i = 1; index_i < a_length; ++index_i)
-            local_dtw_distance[index_i][0] = local_dtw_distance[index_i - 1][0] + calculatePNorm(dataset_a_[observation_index][index_i], dataset_b_[observation_index][0]);
-        for (int index_j = 1; index_j < b_length; ++index_j)
-            local_dtw_distance[0][index_j] = local_dtw_distance[0][index_j - 1] + calculatePNorm(dataset_a_[observation_index][0], dataset_b_[observation_index][index_j]);
-
-        /** add locality constraint */
-        window_size_ = SMAX(window_size_, ABS(a_length - b_length));
-        for (int index_i = 1; index_i != a_length; ++index_i)
-            for (int index_j = SMAX(1, index_i - window_size_); index_j != SMIN(b_length, index_i + window_size_); ++index_j)
-                local_dtw_distance[index_i][index_j] = calculatePNorm(dataset_a_[observation_index][index_i], dataset_b_[observation_index][index_j]) +
-                                                       SMIN(local_dtw_distance[index_i - 1][index_j], local_dtw_distance[index_i][index_j - 1], local_dtw_distance[index_i - 1][index_j - 1]);
-        dtw_distance.push_back(local_dtw_distance[a_length - 1][b_length - 1]);
     }
+
+    StdVec<Real> dtw_distance(this->observation_, 0);
+    parallel_for(
+        IndexRange(0, this->observation_),
+        [&](const IndexRange &r)
+        {
+            for (size_t i = r.begin(); i != r.end(); ++i)
+            {
+                dtw_distance[i] = bandedDTWDistance(dataset_a[i], dataset_b[i], upper_bounds[i]);
+            }
+        });
     return dtw_distance;
 };
 //=================================================================================================//
 template <class ObserveMethodType>
+std::string RegressionTestDynamicTimeWarping<ObserveMethodType>::referenceResultPath(int index_of_run, const std::string &extension)
+{
+    return this->input_folder_path_ + "/" + this->dynamics_identifier_name_ + "_" + this->quantity_name_ +
+           "_Run_" + std::to_string(index_of_run) + "_result" + extension;
+};
+//=================================================================================================//
+template <class ObserveMethodType>
 void RegressionTestDynamicTimeWarping<ObserveMethodType>::setupTheTest()
 {
     this->snapshot_ = this->current_result_.size();
@@ -60,6 +94,9 @@ void RegressionTestDynamicTimeWarping<ObserveMethodType>::setupTheTest()
     dtw_distance_ = dtw_distance_temp_;
     dtw_distance_new_ = dtw_distance_;
 
+    if (this->number_of_run_ > 1 && !fs::exists(referenceResultPath(0)) && fs::exists(referenceResultPath(0, ".xml")))
+        convertLegacyDatabase();
+
     if ((this->number_of_run_ > 1) && (!fs::exists(dtw_distance_filefullpath_)))
     {
         std::cout << "\n Error: the input file:" << dtw_distance_filefullpath_ << " is not exists" << std::endl;
@@ -69,11 +106,43 @@ void RegressionTestDynamicTimeWarping<ObserveMethodType>::setupTheTest()
 };
 //=================================================================================================//
 template <class ObserveMethodType>
+void RegressionTestDynamicTimeWarping<ObserveMethodType>::convertLegacyDatabase()
+{
+    /** the legacy distances are kept as lower limits, as their runs may not all be preserved. */
+    if (fs::exists(legacy_dtw_distance_filefullpath_))
+        readDTWDistanceFromXml();
+    StdVec<Real> converted_dtw_distance = dtw_distance_;
+
+    TriVector<VariableType> legacy_results;
+    for (int n = 0; n != this->number_of_run_; ++n)
+    {
+        if (!fs::exists(referenceResultPath(n, ".xml")))
+            continue;
+        this->readResultFromXml(n);
+        writeReferenceResult(n, this->result_in_);
+        for (const BiVector<VariableType> &previous_result : legacy_results)
+        {
+            StdVec<Real> dtw_distance_local = calculateBandedDTWDistance(this->result_in_, previous_result,
+                                                                         StdVec<Real>(this->observation_, MaxReal));
+            for (int observation_index = 0; observation_index != this->observation_; ++observation_index)
+                converted_dtw_distance[observation_index] = SMAX(converted_dtw_distance[observation_index], dtw_distance_local[observation_index]);
+        }
+        legacy_results.push_back(this->result_in_);
+    }
+    this->result_in_.clear();
+
+    dtw_distance_new_ = converted_dtw_distance;
+    writeDTWDistance();
+    dtw_distance_new_ = dtw_distance_ = StdVec<Real>(this->observation_, 0);
+    std::cout << "The legacy xml database of " << this->quantity_name_ << " has been converted to the binary format." << std::endl;
+};
+//=================================================================================================//
+template <class ObserveMethodType>
 void RegressionTestDynamicTimeWarping<ObserveMethodType>::readDTWDistanceFromXml()
 {
     if (this->number_of_run_ > 1)
     {
-        dtw_distance_xml_engine_in_.loadXmlFile(dtw_distance_filefullpath_);
+        dtw_distance_xml_engine_in_.loadXmlFile(legacy_dtw_distance_filefullpath_);
         SimTK::Xml::Element element_name_dtw_distance_ = dtw_distance_xml_engine_in_.root_element_;
         SimTK::Xml::element_iterator ele_ite = element_name_dtw_distance_.element_begin();
         for (; ele_ite != element_name_dtw_distance_.element_end(); ++ele_ite)
@@ -86,12 +155,34 @@ void RegressionTestDynamicTimeWarping<ObserveMethodType>::readDTWDistanceFromXml
 };
 //=================================================================================================//
 template <class ObserveMethodType>
+void RegressionTestDynamicTimeWarping<ObserveMethodType>::readDTWDistance()
+{
+    if (this->number_of_run_ > 1)
+    {
+        BinaryDataReader reader(dtw_distance_filefullpath_, "SPHDTW02");
+        for (const BinaryBlockRecord &block : reader.Blocks())
+            for (const BinaryArrayRecord &array_record : block.arrays_)
+                if (array_record.name_ == this->quantity_name_ && block.number_of_elements_ == size_t(this->observation_) &&
+                    array_record.element_size_ == sizeof(Real))
+                {
+                    std::memcpy(dtw_distance_.data(), reader.ArrayData(array_record), array_record.bytes_);
+                    return;
+                }
+
+        std::cout << "\n Error: the DTW distance of " << this->quantity_name_ << " is not found in "
+                  << dtw_distance_filefullpath_ << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+};
+//=================================================================================================//
+template <class ObserveMethodType>
 void RegressionTestDynamicTimeWarping<ObserveMethodType>::updateDTWDistance()
 {
     if (this->number_of_run_ > 1)
     {
         StdVec<Real> dtw_distance_local_(this->observation_, 0);
-        dtw_distance_local_ = calculateDTWDistance(this->current_result_trans_, this->result_in_);
+        dtw_distance_local_ = calculateBandedDTWDistance(this->current_result_trans_, this->result_in_, StdVec<Real>(this->observation_, MaxReal));
         for (int observation_index = 0; observation_index != this->observation_; ++observation_index)
         {
             dtw_distance_new_[observation_index] = SMAX(dtw_distance_local_[observation_index], dtw_distance_[observation_index], dtw_distance_new_[observation_index]);
@@ -101,17 +192,70 @@ void RegressionTestDynamicTimeWarping<ObserveMethodType>::updateDTWDistance()
 };
 //=================================================================================================//
 template <class ObserveMethodType>
-void RegressionTestDynamicTimeWarping<ObserveMethodType>::writeDTWDistanceToXml()
+void RegressionTestDynamicTimeWarping<ObserveMethodType>::writeDTWDistance()
+{
+    BinaryDataWriter writer("SPHDTW02", 0.0);
+    writer.addBlock("DTWDistance", this->observation_);
+    writer.addArray(this->quantity_name_, DataTypeIndex<Real>::value, sizeof(Real),
+                    reinterpret_cast<const char *>(dtw_distance_new_.data()));
+    writer.writeToFile(dtw_distance_filefullpath_);
+};
+//=================================================================================================//
+template <class ObserveMethodType>
+void RegressionTestDynamicTimeWarping<ObserveMethodType>::readReferenceResult(int index_of_run)
 {
-    SimTK::Xml::Element DTWElement = dtw_distance_xml_engine_out_.root_element_;
-    dtw_distance_xml_engine_out_.addChildToElement(DTWElement, "DTWDistance");
-    SimTK::Xml::element_iterator ele_ite = DTWElement.element_begin();
+    if (this->number_of_run_ > 1)
+    {
+        this->result_filefullpath_ = referenceResultPath(index_of_run);
+        if (!fs::exists(this->result_filefullpath_))
+        {
+            std::cout << "\n Error: the input file:" << this->result_filefullpath_ << " is not exists" << std::endl;
+            std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+            exit(1);
+        }
+
+        BinaryDataReader reader(this->result_filefullpath_, "SPHREG02");
+        if (reader.Blocks().empty() || reader.Blocks()[0].name_ != this->quantity_name_ ||
+            reader.Blocks()[0].arrays_.size() != size_t(this->observation_))
+        {
+            std::cout << "\n Error: the result in " << this->result_filefullpath_ << " does not match "
+                      << this->quantity_name_ << " with " << this->observation_ << " observations!" << std::endl;
+            std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+            exit(1);
+        }
+
+        const BinaryBlockRecord &block = reader.Blocks()[0];
+        this->snapshot_ = block.number_of_elements_;
+        this->result_in_ = BiVector<VariableType>(this->observation_, StdVec<VariableType>(this->snapshot_));
+        for (int observation_index = 0; observation_index != this->observation_; ++observation_index)
+        {
+            const BinaryArrayRecord &array_record = block.arrays_[observation_index];
+            std::memcpy(reinterpret_cast<char *>(this->result_in_[observation_index].data()), reader.ArrayData(array_record),
+                        SMIN(size_t(array_record.bytes_), this->snapshot_ * sizeof(VariableType)));
+        }
+    }
+};
+//=================================================================================================//
+template <class ObserveMethodType>
+void RegressionTestDynamicTimeWarping<ObserveMethodType>::writeReferenceResult(int index_of_run)
+{
+    writeReferenceResult(index_of_run, this->current_result_trans_);
+};
+//=================================================================================================//
+template <class ObserveMethodType>
+void RegressionTestDynamicTimeWarping<ObserveMethodType>::
+    writeReferenceResult(int index_of_run, const BiVector<VariableType> &result)
+{
+    /** observation * snapshot as in the xml format, one array for each observation. */
+    this->result_filefullpath_ = referenceResultPath(index_of_run);
+    BinaryDataWriter writer("SPHREG02", 0.0);
+    writer.addBlock(this->quantity_name_, result[0].size());
     for (int observation_index = 0; observation_index != this->observation_; ++observation_index)
     {
-        std::string attribute_name_ = this->quantity_name_ + "_" + std::to_string(observation_index);
-        dtw_distance_xml_engine_out_.setAttributeToElement(ele_ite, attribute_name_, dtw_distance_new_[observation_index]);
+        writer.addArray("Particle_" + std::to_string(observation_index), DataTypeIndex<VariableType>::value, sizeof(VariableType),
+                        reinterpret_cast<const char *>(result[observation_index].data()));
     }
-    dtw_distance_xml_engine_out_.writeToXmlFile(dtw_distance_filefullpath_);
+    writer.writeToFile(this->result_filefullpath_);
 };
 //=================================================================================================//
 template <class ObserveMethodType>
@@ -161,13 +305,17 @@ void RegressionTestDynamicTimeWarping<ObserveMethodType>::resultTest()
 {
     int test_wrong = 0;
     StdVec<Real> dtw_distance_current_;
-    dtw_distance_current_ = calculateDTWDistance(this->result_in_, this->current_result_trans_);
+    /** the computation is abandoned once the distance is known to be beyond the allowed one. */
+    StdVec<Real> upper_bounds(this->observation_);
+    for (int observation_index = 0; observation_index != this->observation_; ++observation_index)
+        upper_bounds[observation_index] = 1.01 * dtw_distance_[observation_index];
+    dtw_distance_current_ = calculateBandedDTWDistance(this->result_in_, this->current_result_trans_, upper_bounds);
     for (int observation_index = 0; observation_index != this->observation_; ++observation_index)
     {
         if (dtw_distance_current_[observation_index] > 1.01 * dtw_distance_[observation_index])
         {
             std::cout << "The maximum distance of " << this->quantity_name_ << "[" << observation_index << "] is " << dtw_distance_[observation_index]
-                      << ", and the current distance is " << dtw_distance_current_[observation_index] << "." << std::endl;
+                      << ", and the current distance is not less than " << dtw_distance_current_[observation_index] << "." << std::endl;
             test_wrong++;
         }
     };
@@ -12,7 +12,7 @@ SPHSystem::SPHSystem(BoundingBox system_domain_bounds, Real resolution_ref, size
       resolution_ref_(resolution_ref),
       tbb_global_control_(tbb::global_control::max_allowed_parallelism, number_of_threads),
       io_environment_(nullptr), run_particle_relaxation_(false), reload_particles_(false),
-      restart_step_(0), generate_regression_data_(false), state_recording_(true) {}
+      cache_level_set_(false), restart_step_(0), generate_regression_data_(false), state_recording_(true) {}
 //=================================================================================================//
 IOEnvironment &SPHSystem::getIOEnvironment()
 {
@@ -68,6 +68,7 @@ SPHSystem *SPHSystem::handleCommandlineOptions(int ac, char *av[])
         desc.add_options()("help", "produce help message");
         desc.add_options()("relax", po::value<bool>(), "Particle relaxation.");
         desc.add_options()("reload", po::value<bool>(), "Particle reload from input file.");
+        desc.add_options()("cache_level_set", po::value<bool>(), "Level set cache in reload folder.");
         desc.add_options()("regression", po::value<bool>(), "Regression test.");
         desc.add_options()("state_recording", po::value<bool>(), "State recording in output folder.");
         desc.add_options()("restart_step", po::value<int>(), "Run form a restart file.");
@@ -106,6 +107,18 @@ SPHSystem *SPHSystem::handleCommandlineOptions(int ac, char *av[])
                       << reload_particles_ << ").\n";
         }
 
+        if (vm.count("cache_level_set"))
+        {
+            cache_level_set_ = vm["cache_level_set"].as<bool>();
+            std::cout << "Level set cache was set to "
+                      << vm["cache_level_set"].as<bool>() << ".\n";
+        }
+        else
+        {
+            std::cout << "Level set cache was set to default ("
+                      << cache_level_set_ << ").\n";
+        }
+
         if (vm.count("regression"))
         {
             generate_regression_data_ = vm["regression"].as<bool>();
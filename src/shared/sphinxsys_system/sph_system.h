@@ -84,6 +84,8 @@ class SPHSystem
     bool RunParticleRelaxation() { return run_particle_relaxation_; };
     void setReloadParticles(bool reload_particles) { reload_particles_ = reload_particles; };
     bool ReloadParticles() { return reload_particles_; };
+    void setCacheLevelSet(bool cache_level_set) { cache_level_set_ = cache_level_set; };
+    bool CacheLevelSet() { return cache_level_set_; };
     bool GenerateRegressionData() { return generate_regression_data_; };
     void setGenerateRegressionData(bool generate_regression_data) { generate_regression_data_ = generate_regression_data; };
     bool StateRecording() { return state_recording_; };
@@ -103,6 +105,7 @@ class SPHSystem
     IOEnvironment *io_environment_; /**< io environment */
     bool run_particle_relaxation_;  /**< run particle relaxation for body fitted particle distribution */
     bool reload_particles_;         /**< start the simulation with relaxed particles. */
+    bool cache_level_set_;          /**< read or write level sets of body shapes in reload folder. */
     size_t restart_step_;           /**< restart step */
     bool generate_regression_data_; /**< run and generate or enhance the regression test data set. */
     bool state_recording_;          /**< Record state in output folder. */
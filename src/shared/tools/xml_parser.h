@@ -124,6 +124,20 @@ inline void StringToData(std::string &value_str, Eigen::Matrix<Real, DIMENSION,
             value(j, k) = temp[j * DIMENSION + k];
 }
 
+template <int DIMENSION>
+inline std::string DataToString(const SymmetricMatrix<DIMENSION> &value)
+{
+    return DataToString(value.toMatrix());
+}
+
+template <int DIMENSION>
+inline void StringToData(std::string &value_str, SymmetricMatrix<DIMENSION> &value)
+{
+    typename SymmetricMatrix<DIMENSION>::MatrixType matrix;
+    StringToData(value_str, matrix);
+    value = SymmetricMatrix<DIMENSION>(matrix);
+}
+
 /**
  * @class XmlParser
  * @note The XmlParser represents a wrapper of tinyxml2.
@@ -29,7 +29,7 @@ int main(int ac, char *av[])
     Ghost<ReserveSizeFactor> ghost_boundary(0.5);
     wave_block.generateParticlesWithReserve<UnstructuredMesh>(ghost_boundary, ansys_mesh);
     wave_block.addBodyStateForRecording<Real>("Density");
-    wave_block.addBodyStateForRecording<Real>("Pressure");
+    wave_block.addBodyStateForRecording<StorageReal>("Pressure");
     /** Initial condition and register variables*/
     SimpleDynamics<DMFInitialCondition> initial_condition(wave_block);
     GhostCreationFromMesh ghost_creation(wave_block, ansys_mesh, ghost_boundary);
@@ -68,7 +68,7 @@ class DMFInitialCondition
     explicit DMFInitialCondition(SPHBody &sph_body)
         : FluidInitialCondition(sph_body), pos_(particles_->pos_), vel_(particles_->vel_),
           rho_(particles_->rho_), Vol_(particles_->Vol_), mass_(particles_->mass_),
-          p_(*particles_->getVariableByName<Real>("Pressure"))
+          p_(*particles_->getVariableByName<StorageReal>("Pressure"))
     {
         particles_->registerVariable(mom_, "Momentum");
         particles_->registerVariable(dmom_dt_, "MomentumChangeRate");
@@ -108,7 +108,10 @@ class DMFInitialCondition
 
   protected:
     StdLargeVec<Vecd> &pos_, &vel_;
-    StdLargeVec<Real> &rho_, &Vol_, &mass_, &p_;
+    StdLargeVec<Real> &rho_;
+    StdLargeVec<StorageReal> &Vol_;
+    StdLargeVec<Real> &mass_;
+    StdLargeVec<StorageReal> &p_;
     StdLargeVec<Vecd> mom_, dmom_dt_, dmom_dt_prior_;
     StdLargeVec<Real> E_, dE_dt_, dE_dt_prior_;
     Real gamma_;
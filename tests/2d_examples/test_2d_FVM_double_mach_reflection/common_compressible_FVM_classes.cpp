@@ -6,7 +6,7 @@ namespace SPH
 CompressibleAcousticTimeStepSizeInFVM::
     CompressibleAcousticTimeStepSizeInFVM(SPHBody &sph_body, Real min_distance_between_nodes, Real acousticCFL)
     : AcousticTimeStepSize(sph_body), rho_(particles_->rho_),
-      p_(*particles_->getVariableByName<Real>("Pressure")), vel_(particles_->vel_),
+      p_(*particles_->getVariableByName<StorageReal>("Pressure")), vel_(particles_->vel_),
       min_distance_between_nodes_(min_distance_between_nodes),
       compressible_fluid_(DynamicCast<Fluid>(this, particles_->getBaseMaterial())), acousticCFL_(acousticCFL){};
 //=================================================================================================//
@@ -17,7 +17,8 @@ namespace SPH
 class CompressibleAcousticTimeStepSizeInFVM : public fluid_dynamics::AcousticTimeStepSize
 {
   protected:
-    StdLargeVec<Real> &rho_, &p_;
+    StdLargeVec<Real> &rho_;
+    StdLargeVec<StorageReal> &p_;
     StdLargeVec<Vecd> &vel_;
     Real min_distance_between_nodes_;
 
@@ -41,7 +41,8 @@ namespace fluid_dynamics
 class WCAcousticTimeStepSizeInFVM : public fluid_dynamics::AcousticTimeStepSize
 {
   protected:
-    StdLargeVec<Real> &rho_, &p_;
+    StdLargeVec<Real> &rho_;
+    StdLargeVec<StorageReal> &p_;
     StdLargeVec<Vecd> &vel_;
     Fluid &fluid_;
     Real min_distance_between_nodes_;
@@ -66,7 +67,7 @@ class BaseForceFromFluidInFVM : public LocalDynamics, public fluid_dynamics::Flu
     StdLargeVec<Vecd> &getForceFromFluid() { return force_from_fluid_; };
 
   protected:
-    StdLargeVec<Real> &Vol_;
+    StdLargeVec<StorageReal> &Vol_;
     StdLargeVec<Vecd> force_from_fluid_;
 };
 
@@ -102,14 +103,15 @@ class PressureForceFromFluidInFVM : public BaseForceFromFluidInFVM
   public:
     explicit PressureForceFromFluidInFVM(BaseInnerRelation &inner_relation, vector<vector<size_t>> each_boundary_type_contact_real_index)
         : BaseForceFromFluidInFVM(inner_relation), fluid_(DynamicCast<WeaklyCompressibleFluid>(this, particles_->getBaseMaterial())), vel_(particles_->vel_),
-          p_(*particles_->getVariableByName<Real>("Pressure")), rho_(particles_->rho_), riemann_solver_(fluid_, fluid_),
+          p_(*particles_->getVariableByName<StorageReal>("Pressure")), rho_(particles_->rho_), riemann_solver_(fluid_, fluid_),
           each_boundary_type_contact_real_index_(each_boundary_type_contact_real_index)
     {
         particles_->registerVariable(force_from_fluid_, "PressureForceOnSolid");
     };
     Fluid &fluid_;
     StdLargeVec<Vecd> &vel_;
-    StdLargeVec<Real> &p_, &rho_;
+    StdLargeVec<StorageReal> &p_;
+    StdLargeVec<Real> &rho_;
     RiemannSolverType riemann_solver_;
     vector<vector<size_t>> each_boundary_type_contact_real_index_;
     virtual ~PressureForceFromFluidInFVM(){};
@@ -140,7 +140,7 @@ class AnisotropicCorrectConfiguration : public LocalDynamics, public GeneralData
   protected:
     int beta_;
     Real alpha_;
-    StdLargeVec<Real> &Vol_;
+    StdLargeVec<StorageReal> &Vol_;
     StdLargeVec<Matd> &B_;
     StdLargeVec<Vecd> &pos_;
     StdLargeVec<Real> show_neighbor_;
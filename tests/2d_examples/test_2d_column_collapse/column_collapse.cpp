@@ -76,7 +76,7 @@ int main(int ac, char *av[])
     RealBody soil_block(sph_system, makeShared<Soil>("GranularBody"));
     soil_block.defineParticlesAndMaterial<PlasticContinuumParticles, PlasticContinuum>(rho0_s, c_s, Youngs_modulus, poisson, friction_angle);
     soil_block.generateParticles<Lattice>();
-    soil_block.addBodyStateForRecording<Real>("Pressure");
+    soil_block.addBodyStateForRecording<StorageReal>("Pressure");
     soil_block.addBodyStateForRecording<Real>("Density");
     soil_block.addBodyStateForRecording<Real>("VerticalStress");
     soil_block.addBodyStateForRecording<Real>("AccDeviatoricPlasticStrain");
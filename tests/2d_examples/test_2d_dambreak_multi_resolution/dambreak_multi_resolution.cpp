@@ -93,7 +93,7 @@ int main(int ac, char *av[])
     ParticleBuffer<ReserveSizeFactor> particle_split_buffer(20.0);
     water_block.generateParticlesWithReserve<Lattice>(particle_split_buffer);
     water_block.addBodyStateForRecording<Real>("SmoothingLengthRatio");
-    water_block.addBodyStateForRecording<Real>("VolumetricMeasure");
+    water_block.addBodyStateForRecording<StorageReal>("VolumetricMeasure");
 
     SolidBody wall_boundary(sph_system, makeShared<WallBoundary>("WallBoundary"));
     wall_boundary.defineParticlesAndMaterial<SolidParticles, Solid>();
@@ -51,7 +51,7 @@ class TaylorGreenInitialCondition
     explicit TaylorGreenInitialCondition(SPHBody &sph_body)
         : FluidInitialCondition(sph_body), pos_(particles_->pos_), vel_(particles_->vel_),
           rho_(particles_->rho_), mass_(particles_->mass_), Vol_(particles_->Vol_),
-          p_(*particles_->getVariableByName<Real>("Pressure"))
+          p_(*particles_->getVariableByName<StorageReal>("Pressure"))
     {
         particles_->registerVariable(mom_, "Momentum");
         particles_->registerVariable(dmom_dt_, "MomentumChangeRate");
@@ -79,7 +79,8 @@ class TaylorGreenInitialCondition
 
   protected:
     StdLargeVec<Vecd> &pos_, &vel_;
-    StdLargeVec<Real> &rho_, &mass_, &Vol_, &p_;
+    StdLargeVec<Real> &rho_, &mass_;
+    StdLargeVec<StorageReal> &Vol_, &p_;
     StdLargeVec<Vecd> mom_, dmom_dt_, dmom_dt_prior_;
     StdLargeVec<Real> E_, dE_dt_, dE_dt_prior_;
     Real gamma_;
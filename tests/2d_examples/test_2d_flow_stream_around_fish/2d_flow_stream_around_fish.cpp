@@ -103,7 +103,7 @@ int main(int ac, char *av[])
     /** Evaluation of density by freestream approach. */
     InteractionWithUpdate<fluid_dynamics::DensitySummationFreeStreamComplex> update_fluid_density(water_block_inner, water_block_contact);
     /** We can output a method-specific particle data for debug */
-    water_block.addBodyStateForRecording<Real>("Pressure");
+    water_block.addBodyStateForRecording<StorageReal>("Pressure");
     water_block.addBodyStateForRecording<int>("Indicator");
     /** Time step size without considering sound wave speed. */
     ReduceDynamics<fluid_dynamics::AdvectionTimeStepSize> get_fluid_advection_time_step_size(water_block, U_f);
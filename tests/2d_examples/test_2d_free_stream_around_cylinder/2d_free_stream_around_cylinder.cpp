@@ -133,7 +133,7 @@ int main(int ac, char *av[])
     //----------------------------------------------------------------------
     //	Define the methods for I/O operations and observations of the simulation.
     //----------------------------------------------------------------------
-    water_block.addBodyStateForRecording<Real>("Pressure");
+    water_block.addBodyStateForRecording<StorageReal>("Pressure");
     water_block.addBodyStateForRecording<int>("Indicator");
     BodyStatesRecordingToVtp write_real_body_states(sph_system.real_bodies_);
     ObservedQuantityRecording<Vecd> write_fluid_velocity("Velocity", fluid_observer_contact);
@@ -262,7 +262,7 @@ void hydrostatic_fsi(const Real particle_spacing_gate, const Real particle_spaci
     //----------------------------------------------------------------------
     //	Define the methods for I/O operations and observations of the simulation.
     //----------------------------------------------------------------------
-    water_block.addBodyStateForRecording<Real>("Pressure");
+    water_block.addBodyStateForRecording<StorageReal>("Pressure");
     gate.addBodyStateForRecording<Real>("Average1stPrincipleCurvature");
     gate.addBodyStateForRecording<Real>("Average2ndPrincipleCurvature");
     gate.addBodyStateForRecording<Vecd>("PressureForceFromFluid");
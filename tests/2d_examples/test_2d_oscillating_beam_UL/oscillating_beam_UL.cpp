@@ -114,7 +114,7 @@ int main(int ac, char *av[])
     beam_body.generateParticles<Lattice>();
     beam_body.addBodyStateForRecording<Real>("VonMisesStress");
     beam_body.addBodyStateForRecording<Real>("VonMisesStrain");
-    beam_body.addBodyStateForRecording<Real>("Pressure");
+    beam_body.addBodyStateForRecording<StorageReal>("Pressure");
     beam_body.addBodyStateForRecording<Real>("Density");
 
     ObserverBody beam_observer(sph_system, "BeamObserver");
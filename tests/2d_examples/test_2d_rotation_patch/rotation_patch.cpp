@@ -60,7 +60,7 @@ class InitialVelocity
     InitialVelocity(SPHBody &sph_body)
         : fluid_dynamics::FluidInitialCondition(sph_body),
           fluid_particles_(dynamic_cast<BaseParticles *>(&sph_body.getBaseParticles())),
-          p_(*fluid_particles_->getVariableByName<Real>("Pressure")), rho_(fluid_particles_->rho_){};
+          p_(*fluid_particles_->getVariableByName<StorageReal>("Pressure")), rho_(fluid_particles_->rho_){};
 
     void update(size_t index_i, Real dt)
     {
@@ -87,7 +87,8 @@ class InitialVelocity
 
   protected:
     BaseParticles *fluid_particles_;
-    StdLargeVec<Real> &p_, &rho_;
+    StdLargeVec<StorageReal> &p_;
+    StdLargeVec<Real> &rho_;
 };
 //----------------------------------------------------------------------
 //	wave gauge
@@ -487,7 +487,7 @@ class DiffusionRelaxation<RobinFlux<ParticlesType, ContactParticlesType, Contact
     StdLargeVec<Vecd> &n_;
     StdVec<StdLargeVec<Vecd> *> ht_n_;
     StdVec<Real *> ht_T_infinity_;
-    StdVec<StdLargeVec<Real> *> contact_Vol_;
+    StdVec<StdLargeVec<StorageReal> *> contact_Vol_;
     StdVec<StdLargeVec<Real> *> ht_flux_;
     StdVec<StdLargeVec<Real> *> ht_convection_;//ht for heat transfer
     
@@ -523,7 +523,7 @@ class DiffusionRelaxation<RobinFlux<ParticlesType, ContactParticlesType, Contact
                 Real ht_flux_ = 0.0;
 
                 StdLargeVec<Vecd> &n_k = *(ht_n_[k]);
-                StdLargeVec<Real> &Vol_k = *(contact_Vol_[k]);
+                StdLargeVec<StorageReal> &Vol_k = *(contact_Vol_[k]);
                 StdLargeVec<Real> &ht_convection_k = *(ht_convection_[k]);
                 Real &ht_T_infinity_k = *(ht_T_infinity_[k]);
 
@@ -532,7 +532,7 @@ class DiffusionRelaxation<RobinFlux<ParticlesType, ContactParticlesType, Contact
                 {
                     size_t index_j = contact_neighborhood.j_[n];
                     Real dW_ijV_j_ = contact_neighborhood.dW_ij_[n] * Vol_k[index_j];
-                    Vecd &e_ij = contact_neighborhood.e_ij_[n];
+                    const Vecd &e_ij = contact_neighborhood.e_ij_[n];
 
                     const Vecd &grad_ijV_j = this->contact_kernel_gradients_[k](index_i, index_j, dW_ijV_j_, e_ij);
                     Vecd n_ij = n_[index_i] - n_k[index_j];
@@ -232,7 +232,7 @@ int main(int ac, char *av[])
     //	Define the methods for I/O operations, observations
     //	and regression tests of the simulation.
     //----------------------------------------------------------------------
-    water_block.addBodyStateForRecording<Real>("Pressure");
+    water_block.addBodyStateForRecording<StorageReal>("Pressure");
     plate.addBodyStateForRecording<Real>("Average1stPrincipleCurvature");
     plate.addBodyStateForRecording<Real>("Average2ndPrincipleCurvature");
     plate.addBodyStateForRecording<Vecd>("PressureForceFromFluid");
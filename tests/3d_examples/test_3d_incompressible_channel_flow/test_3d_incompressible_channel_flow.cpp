@@ -27,7 +27,7 @@ int main(int ac, char* av[])
     Ghost<ReserveSizeFactor> ghost_boundary(0.5);
     air_block.generateParticlesWithReserve<UnstructuredMesh>(ghost_boundary, read_mesh_data);
     air_block.addBodyStateForRecording<Real>("Density");
-    air_block.addBodyStateForRecording<Real>("Pressure");
+    air_block.addBodyStateForRecording<StorageReal>("Pressure");
     SimpleDynamics<InvCFInitialCondition> initial_condition(air_block);
     GhostCreationFromMesh ghost_creation(air_block, read_mesh_data, ghost_boundary);
     //----------------------------------------------------------------------
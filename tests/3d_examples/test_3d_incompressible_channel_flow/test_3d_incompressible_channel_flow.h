@@ -55,11 +55,12 @@ class InvCFInitialCondition
     public:
     explicit InvCFInitialCondition(SPHBody& sph_body)
         : FluidInitialCondition(sph_body), rho_(particles_->rho_),
-        p_(*particles_->getVariableByName<Real>("Pressure")),
+        p_(*particles_->getVariableByName<StorageReal>("Pressure")),
         vel_(particles_->vel_) {};
 
 protected:
-    StdLargeVec<Real>& rho_, & p_;
+    StdLargeVec<Real> &rho_;
+    StdLargeVec<StorageReal> &p_;
     void update(size_t index_i, Real dt)
     {
         rho_[index_i] = rho0_f;
@@ -112,7 +112,7 @@ int main(int ac, char *av[])
     // plate_body.addBodyStateForRecording<Real>("VolumetricStress");
     plate_body.addBodyStateForRecording<Real>("VonMisesStress");
     plate_body.addBodyStateForRecording<Real>("VonMisesStrain");
-    plate_body.addBodyStateForRecording<Real>("Pressure");
+    plate_body.addBodyStateForRecording<StorageReal>("Pressure");
     plate_body.addBodyStateForRecording<Real>("Density");
 
     /** Define Observer. */
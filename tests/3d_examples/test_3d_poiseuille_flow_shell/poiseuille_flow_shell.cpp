@@ -254,7 +254,7 @@ void poiseuille_flow(const Real resolution_ref, const Real resolution_shell, con
     //	Define the methods for I/O operations, observations
     //----------------------------------------------------------------------
     water_block.addBodyStateForRecording<int>("Indicator");
-    water_block.addBodyStateForRecording<Real>("Pressure");
+    water_block.addBodyStateForRecording<StorageReal>("Pressure");
     shell_boundary.addBodyStateForRecording<Real>("Average1stPrincipleCurvature");
     shell_boundary.addBodyStateForRecording<Real>("Average2ndPrincipleCurvature");
     BodyStatesRecordingToVtp body_states_recording(system.real_bodies_);
@@ -90,7 +90,7 @@ int main(int ac, char *av[])
     (!sph_system.RunParticleRelaxation() && sph_system.ReloadParticles())
         ? soil_block.generateParticles<Reload>(soil_block.getName())
         : soil_block.generateParticles<Lattice>();
-    soil_block.addBodyStateForRecording<Real>("Pressure");
+    soil_block.addBodyStateForRecording<StorageReal>("Pressure");
     soil_block.addBodyStateForRecording<Real>("Density");
     soil_block.addBodyStateForRecording<Real>("VerticalStress");
     soil_block.addBodyStateForRecording<Real>("AccDeviatoricPlasticStrain");
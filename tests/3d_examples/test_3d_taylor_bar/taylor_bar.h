@@ -119,7 +119,7 @@ class DynamicContactForceWithWall : public LocalDynamics,
 
             StdLargeVec<Vecd> &n_k = *(contact_n_[k]);
             StdLargeVec<Vecd> &vel_n_k = *(contact_vel_[k]);
-            StdLargeVec<Real>& Vol_k = *(contact_Vol_[k]);
+            StdLargeVec<StorageReal>& Vol_k = *(contact_Vol_[k]);
             Neighborhood &contact_neighborhood = (*contact_configuration_[k])[index_i];
             for (size_t n = 0; n != contact_neighborhood.current_size_; ++n)
             {
@@ -144,9 +144,9 @@ class DynamicContactForceWithWall : public LocalDynamics,
 
   protected:
     Solid &solid_;
-    StdLargeVec<Real> &Vol_;
+    StdLargeVec<StorageReal> &Vol_;
     StdLargeVec<Vecd> &vel_, &force_prior_; // note that prior force directly used here
-    StdVec<StdLargeVec<Real>*> contact_Vol_;
+    StdVec<StdLargeVec<StorageReal> *> contact_Vol_;
     StdVec<StdLargeVec<Vecd>*> contact_vel_, contact_n_;
     Real penalty_strength_;
     Real impedance_, reference_pressure_;
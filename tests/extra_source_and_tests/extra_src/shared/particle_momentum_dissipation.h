@@ -59,7 +59,8 @@ namespace multi_species_continuum
       void interaction(size_t index_i, Real dt = 0.0);
 
     protected:
-      StdLargeVec<Real> &Vol_, &mass_;
+      StdLargeVec<StorageReal> &Vol_;
+      StdLargeVec<Real> &mass_;
 
       StdLargeVec<VariableType> &variable_;
       Real eta_; /**< damping coefficient */
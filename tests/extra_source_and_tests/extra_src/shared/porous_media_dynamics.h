@@ -96,7 +96,7 @@ class BasePorousMediaRelaxation : public LocalDynamics, public PorousMediaSolidD
     virtual ~BasePorousMediaRelaxation(){};
 
   protected:
-    StdLargeVec<Real> &Vol_;
+    StdLargeVec<StorageReal> &Vol_;
     StdLargeVec<Vecd> &pos_, &vel_;
     StdLargeVec<Matd> &B_, &F_, &dF_dt_;
     Real rho0_, inv_rho0_;
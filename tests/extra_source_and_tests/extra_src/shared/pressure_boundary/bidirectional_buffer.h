@@ -42,7 +42,7 @@ struct NonPrescribedPressure
     template <class BoundaryConditionType>
     NonPrescribedPressure(BoundaryConditionType &boundary_condition) {}
 
-    Real operator()(Real &p_)
+    Real operator()(Real p_)
     {
         return p_;
     }
@@ -86,7 +86,7 @@ class BidirectionalBuffer
             : BaseLocalDynamics<BodyPartByCell>(aligned_box_part), FluidDataSimple(sph_body_),
               axis_(axis), particle_buffer_(particle_buffer), aligned_box_(aligned_box_part.aligned_box_),
               fluid_(DynamicCast<Fluid>(this, particles_->getBaseMaterial())),
-              pos_n_(particles_->pos_), rho_n_(particles_->rho_), p_(*particles_->getVariableByName<Real>("Pressure")),
+              pos_n_(particles_->pos_), rho_n_(particles_->rho_), p_(*particles_->getVariableByName<StorageReal>("Pressure")),
               previous_surface_indicator_(*particles_->getVariableByName<int>("PreviousSurfaceIndicator")),
               buffer_particle_indicator_(*particles_->getVariableByName<int>("BufferParticleIndicator")),
               target_pressure_(target_pressure)
@@ -95,6 +95,11 @@ class BidirectionalBuffer
         };
         virtual ~Injection(){};
 
+        virtual void setupDynamics(Real dt = 0.0) override
+        {
+            particle_buffer_.prepareBufferParticles(*particles_, identifier_.SizeOfLoopRange());
+        };
+
         void update(size_t index_i, Real dt = 0.0)
         {
             if (aligned_box_.checkUpperBound(axis_, pos_n_[index_i]) && buffer_particle_indicator_[index_i] == 1)
@@ -123,7 +128,8 @@ class BidirectionalBuffer
         AlignedBoxShape &aligned_box_;
         Fluid &fluid_;
         StdLargeVec<Vecd> &pos_n_;
-        StdLargeVec<Real> &rho_n_, &p_;
+        StdLargeVec<Real> &rho_n_;
+        StdLargeVec<StorageReal> &p_;
         StdLargeVec<int> &previous_surface_indicator_, &buffer_particle_indicator_;
 
       private:
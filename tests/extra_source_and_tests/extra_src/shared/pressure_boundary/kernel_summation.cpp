@@ -22,7 +22,7 @@ void NablaWV<Inner<>>::interaction(size_t index_i, Real dt)
     {
         for (size_t k = 0; k < contact_configuration_.size(); ++k)
         {
-            StdLargeVec<Real>& Vol_k = *(contact_Vol_[k]);
+            StdLargeVec<StorageReal>& Vol_k = *(contact_Vol_[k]);
             Neighborhood &contact_neighborhood = (*contact_configuration_[k])[index_i];
             for (size_t n = 0; n != contact_neighborhood.current_size_; ++n)
             {
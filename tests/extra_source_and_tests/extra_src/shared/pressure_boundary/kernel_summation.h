@@ -60,7 +60,7 @@ class NablaWV<Inner<>>
     void interaction(size_t index_i, Real dt = 0.0);
 
 protected:
-    StdLargeVec<Real>& Vol_;
+    StdLargeVec<StorageReal> &Vol_;
 };
 
 template <>
@@ -79,7 +79,7 @@ class NablaWV<Contact<>>
     virtual ~NablaWV(){};
     void interaction(size_t index_i, Real dt = 0.0);
 
-    StdVec<StdLargeVec<Real>*> contact_Vol_;
+    StdVec<StdLargeVec<StorageReal> *> contact_Vol_;
 };
 
 
@@ -172,7 +172,7 @@ int main(int ac, char *av[])
     SimpleDynamics<ParticleSnapshotAverage<Real>> average_viscosity(observer_body, "VariableViscosity");
 
     //	Define the methods for I/O operations, observations
-    fluid.addBodyStateForRecording<Real>("Pressure");
+    fluid.addBodyStateForRecording<StorageReal>("Pressure");
     no_slip_boundary.addBodyStateForRecording<Vecd>("NormalDirection");
     BodyStatesRecordingToVtp write_fluid_states(sph_system.real_bodies_);
     observer_body.addBodyStateForRecording<Real>("VariableViscosity");
@@ -1,7 +1,12 @@
 #include "geometric_shape.h"
 #include "transform_shape.h"
+#include "triangle_mesh_bvh.h"
+#include "triangle_mesh_shape.h"
 #include <gtest/gtest.h>
 
+#include <fstream>
+#include <iomanip>
+
 using namespace SPH;
 
 TEST(test_GeometricShapeBox, test_findBounds)
@@ -15,6 +20,64 @@ TEST(test_GeometricShapeBox, test_findBounds)
     EXPECT_EQ(BoundingBox(Vec3d(0.0, 0.0, 0.0), Vec3d(2.0, 1.0, 0.5)), box);
 }
 
+TEST(test_TriangleMeshBVH, test_queries)
+{
+    /** unit cube with outward faces. */
+    StdVec<Vec3d> vertices;
+    for (int i = 0; i != 8; ++i)
+        vertices.push_back(Vec3d(i & 1, (i >> 1) & 1, (i >> 2) & 1));
+    StdVec<Array3i> faces = {{0, 2, 1}, {1, 2, 3}, {4, 5, 6}, {5, 7, 6}, {0, 1, 4}, {1, 5, 4},
+                             {2, 6, 3}, {3, 6, 7}, {0, 4, 2}, {2, 4, 6}, {1, 3, 5}, {3, 7, 5}};
+    TriangleMeshBVH bvh(vertices, faces);
+
+    EXPECT_TRUE(bvh.checkContain(Vec3d(0.5, 0.5, 0.5)));
+    EXPECT_TRUE(bvh.checkContain(Vec3d(0.1, 0.9, 0.2)));
+    EXPECT_FALSE(bvh.checkContain(Vec3d(1.5, 0.5, 0.5)));
+    EXPECT_FALSE(bvh.checkContain(Vec3d(-0.1, -0.1, -0.1)));
+    EXPECT_TRUE(bvh.checkContain(Vec3d(0.5, 0.5, 1.0), true));
+    EXPECT_FALSE(bvh.checkContain(Vec3d(0.5, 0.5, 1.0), false));
+
+    int face_id = -1;
+    Vec3d closest_point = bvh.findClosestPoint(Vec3d(0.3, 0.4, 2.0), face_id);
+    EXPECT_TRUE(closest_point.isApprox(Vec3d(0.3, 0.4, 1.0)));
+    EXPECT_TRUE(bvh.getFaceNormal(face_id).isApprox(Vec3d(0.0, 0.0, 1.0)));
+    EXPECT_TRUE(bvh.findClosestPoint(Vec3d(2.0, 2.0, 2.0)).isApprox(Vec3d(1.0, 1.0, 1.0)));
+}
+
+TEST(test_TriangleMeshShapeSTL, test_BVHQueries)
+{
+    /** the same sphere mesh queried by SimTK and by the bounding volume hierarchy loaded from an STL file. */
+    TriangleMeshShapeSphere sphere(1.0, 2, Vec3d::Zero());
+    SimTK::ContactGeometry::TriangleMesh *triangle_mesh = sphere.getTriangleMesh();
+    std::string stl_file = "./test_sphere.stl";
+    std::ofstream out_file(stl_file);
+    out_file << std::setprecision(17) << "solid sphere\n";
+    for (int i = 0; i != triangle_mesh->getNumFaces(); ++i)
+    {
+        out_file << "facet normal " << SimTKToEigen(triangle_mesh->getFaceNormal(i)).transpose() << "\n outer loop\n";
+        for (int k = 0; k != 3; ++k)
+            out_file << "  vertex " << SimTKToEigen(triangle_mesh->getVertexPosition(triangle_mesh->getFaceVertex(i, k))).transpose() << "\n";
+        out_file << " endloop\nendfacet\n";
+    }
+    out_file << "endsolid sphere\n";
+    out_file.close();
+    TriangleMeshShapeSTL stl_sphere(stl_file, Vec3d::Zero(), 1.0);
+
+    srand(1);
+    for (size_t n = 0; n != 1000; ++n)
+    {
+        Vec3d probe_point = 1.5 * Vec3d::Random();
+        Vec3d closest_point = sphere.findClosestPoint(probe_point);
+        Vec3d bvh_closest_point = stl_sphere.findClosestPoint(probe_point);
+        Real distance = (probe_point - closest_point).norm();
+        EXPECT_NEAR(distance, (probe_point - bvh_closest_point).norm(), 1.0e-8);
+        if (distance > 1.0e-3)
+        {
+            EXPECT_EQ(sphere.checkContain(probe_point), stl_sphere.checkContain(probe_point));
+        }
+    }
+}
+
 int main(int argc, char *argv[])
 {
     testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,209 @@
+#include "level_set.h"
+#include "level_set_shape.h"
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
+using namespace SPH;
+
+/** A unit ball with the exact signed distance. */
+class UnitBall : public Shape
+{
+  public:
+    UnitBall() : Shape("UnitBall"){};
+    virtual bool checkContain(const Vecd &probe_point, bool BOUNDARY_INCLUDED = true) override
+    {
+        return probe_point.norm() < 1.0;
+    };
+    virtual Vecd findClosestPoint(const Vecd &probe_point) override { return probe_point.normalized(); };
+
+  protected:
+    virtual BoundingBox findBounds() override { return BoundingBox(-Vecd::Ones(), Vecd::Ones()); };
+};
+
+TEST(test_LevelSet, test_narrowBandConstruction)
+{
+    UnitBall ball;
+    BoundingBox bounds(-1.5 * Vecd::Ones(), 1.5 * Vecd::Ones());
+    SPHAdaptation full_adaptation(0.05), narrow_band_adaptation(0.05);
+    narrow_band_adaptation.setNarrowBandLevelSet();
+    LevelSet full_level_set(bounds, 0.1, ball, full_adaptation);
+    LevelSet narrow_band_level_set(bounds, 0.1, ball, narrow_band_adaptation);
+    LevelSet repeated_level_set(bounds, 0.1, ball, narrow_band_adaptation);
+
+    srand(1);
+    for (size_t n = 0; n != 10000; ++n)
+    {
+        Vecd probe_point = 1.4 * Vecd::Random();
+        Real exact_distance = probe_point.norm() - 1.0;
+        Real full_distance = full_level_set.probeSignedDistance(probe_point);
+        Real narrow_band_distance = narrow_band_level_set.probeSignedDistance(probe_point);
+        if (fabs(exact_distance) < 0.3)
+        {
+            EXPECT_NEAR(narrow_band_distance, full_distance, 0.02);
+        }
+        EXPECT_EQ(narrow_band_distance, repeated_level_set.probeSignedDistance(probe_point));
+        EXPECT_EQ(narrow_band_level_set.probeLevelSetGradient(probe_point),
+                  repeated_level_set.probeLevelSetGradient(probe_point));
+    }
+}
+
+TEST(test_LevelSet, test_probeBenchmark)
+{
+    UnitBall ball;
+    BoundingBox bounds(-1.5 * Vecd::Ones(), 1.5 * Vecd::Ones());
+    SPHAdaptation sph_adaptation(0.02);
+    LevelSet level_set(bounds, 0.02, ball, sph_adaptation);
+
+    srand(1);
+    StdVec<Vecd> probe_points(2000000);
+    for (Vecd &probe_point : probe_points)
+    {
+        probe_point = Vecd::Random().normalized() * (1.0 + 0.05 * rand() / RAND_MAX);
+    }
+
+    Real max_error = 0.0;
+    auto start = std::chrono::steady_clock::now();
+    for (const Vecd &probe_point : probe_points)
+    {
+        Real exact_distance = probe_point.norm() - 1.0;
+        max_error = SMAX(max_error, fabs(level_set.probeSignedDistance(probe_point) - exact_distance));
+        max_error = SMAX(max_error, (level_set.probeNormalDirection(probe_point) - probe_point.normalized()).norm());
+    }
+    std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+    std::cout << "Time for probing the level set at " << probe_points.size()
+              << " points: " << duration.count() << " seconds." << std::endl;
+    EXPECT_LT(max_error, 0.05);
+}
+
+/** A unit ball with a source hash, counting the queries used for building a level set. */
+class CachedUnitBall : public UnitBall
+{
+  public:
+    std::atomic<size_t> number_of_queries_{0};
+    virtual bool checkContain(const Vecd &probe_point, bool BOUNDARY_INCLUDED = true) override
+    {
+        ++number_of_queries_;
+        return UnitBall::checkContain(probe_point, BOUNDARY_INCLUDED);
+    };
+    virtual uint64_t getSourceHash() override { return 12345; };
+};
+
+/** Gives access to the level set for comparing cached data. */
+class CachedLevelSetShape : public LevelSetShape
+{
+  public:
+    using LevelSetShape::LevelSetShape;
+    std::string getBinaryData()
+    {
+        std::string file_name = "./level_set_binary_data.bin";
+        std::ofstream out_file(file_name.c_str(), std::ios::binary | std::ios::trunc);
+        level_set_.writeBinaryData(out_file);
+        out_file.close();
+        std::ifstream in_file(file_name.c_str(), std::ios::binary);
+        return std::string((std::istreambuf_iterator<char>(in_file)), std::istreambuf_iterator<char>());
+    };
+};
+
+TEST(test_LevelSet, test_cacheRoundTrip)
+{
+    std::string cache_folder = "./level_set_cache";
+    std::filesystem::remove_all(cache_folder);
+    std::filesystem::create_directory(cache_folder);
+    CachedUnitBall ball;
+    SharedPtr<SPHAdaptation> sph_adaptation = makeShared<SPHAdaptation>(0.05);
+
+    CachedLevelSetShape built_shape(ball, sph_adaptation, 1.0, cache_folder);
+    EXPECT_GT(ball.number_of_queries_.load(), 0u);
+    std::string cache_file;
+    for (const auto &entry : std::filesystem::directory_iterator(cache_folder))
+        cache_file = entry.path().string();
+    ASSERT_FALSE(cache_file.empty());
+
+    /** phi, near interface id and gradient are reloaded bitwise without querying the shape */
+    ball.number_of_queries_ = 0;
+    CachedLevelSetShape reloaded_shape(ball, sph_adaptation, 1.0, cache_folder);
+    EXPECT_EQ(ball.number_of_queries_.load(), 0u);
+    std::string built_data = built_shape.getBinaryData();
+    EXPECT_TRUE(built_data == reloaded_shape.getBinaryData());
+
+    /** a cache written with another key is rejected and rebuilt */
+    uint64_t wrong_key = 0;
+    {
+        std::fstream file(cache_file.c_str(), std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(8);
+        file.write(reinterpret_cast<const char *>(&wrong_key), sizeof(wrong_key));
+    }
+    CachedLevelSetShape rebuilt_shape(ball, sph_adaptation, 1.0, cache_folder);
+    EXPECT_GT(ball.number_of_queries_.load(), 0u);
+    EXPECT_TRUE(built_data == rebuilt_shape.getBinaryData());
+    uint64_t cache_key = 0;
+    {
+        std::ifstream file(cache_file.c_str(), std::ios::binary);
+        file.seekg(8);
+        file.read(reinterpret_cast<char *>(&cache_key), sizeof(cache_key));
+    }
+    EXPECT_NE(cache_key, wrong_key);
+}
+
+/** Gives access to computing the kernel integrals of all packages eagerly. */
+class EagerLevelSet : public LevelSet
+{
+  public:
+    using LevelSet::LevelSet;
+    void computeAllKernelIntegrals() { updateKernelIntegrals(); };
+};
+
+TEST(test_LevelSet, test_lazyKernelIntegrals)
+{
+    UnitBall ball;
+    BoundingBox bounds(-1.5 * Vecd::Ones(), 1.5 * Vecd::Ones());
+    SPHAdaptation sph_adaptation(0.05);
+    LevelSet lazy_level_set(bounds, 0.05, ball, sph_adaptation);
+    LevelSet prefetched_level_set(bounds, 0.05, ball, sph_adaptation);
+    EagerLevelSet eager_level_set(bounds, 0.05, ball, sph_adaptation);
+    eager_level_set.computeAllKernelIntegrals();
+
+    srand(1);
+    size_t number_of_probes = 100000;
+    StdLargeVec<Vecd> probe_points(number_of_probes);
+    for (Vecd &probe_point : probe_points)
+    {
+        probe_point = Vecd::Random().normalized() * (1.0 + 0.1 * (2.0 * rand() / RAND_MAX - 1.0));
+    }
+    prefetched_level_set.prefetchKernelIntegrals(probe_points, number_of_probes);
+
+    /** lazy packages are computed by concurrent probes */
+    StdLargeVec<Real> lazy_weights(number_of_probes);
+    StdLargeVec<Vecd> lazy_gradients(number_of_probes);
+    parallel_for(
+        IndexRange(0, number_of_probes),
+        [&](const IndexRange &r)
+        {
+            for (size_t i = r.begin(); i != r.end(); ++i)
+            {
+                lazy_weights[i] = lazy_level_set.probeKernelIntegral(probe_points[i]);
+                lazy_gradients[i] = lazy_level_set.probeKernelGradientIntegral(probe_points[i]);
+            }
+        });
+
+    for (size_t i = 0; i != number_of_probes; ++i)
+    {
+        Real eager_weight = eager_level_set.probeKernelIntegral(probe_points[i]);
+        Vecd eager_gradient = eager_level_set.probeKernelGradientIntegral(probe_points[i]);
+        EXPECT_EQ(lazy_weights[i], eager_weight);
+        EXPECT_EQ(lazy_gradients[i], eager_gradient);
+        EXPECT_EQ(prefetched_level_set.probeKernelIntegral(probe_points[i]), eager_weight);
+        EXPECT_EQ(prefetched_level_set.probeKernelGradientIntegral(probe_points[i]), eager_gradient);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
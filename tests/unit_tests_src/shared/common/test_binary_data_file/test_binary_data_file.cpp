@@ -0,0 +1,75 @@
+#include "binary_data_file.h"
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <type_traits>
+
+using namespace SPH;
+namespace fs = std::filesystem;
+
+TEST(test_BinaryDataFile, test_writeAndRead)
+{
+    static_assert(!std::is_copy_constructible_v<BinaryDataReader>, "The reader owns the mapped memory.");
+    static_assert(!std::is_copy_assignable_v<BinaryDataReader>, "The reader owns the mapped memory.");
+
+    StdVec<double> scalars = {1.0 / 3.0, -2.5, 1.0e10};
+    StdVec<int> indices = {7, -1, 42};
+    BinaryDataWriter writer("SPHTST01", 1.5, 12345);
+    writer.addBlock("TestBlock", 3);
+    writer.addArray("Scalars", 0, sizeof(double), reinterpret_cast<const char *>(scalars.data()));
+    writer.addArray("Indices", 5, sizeof(int), reinterpret_cast<const char *>(indices.data()));
+    writer.writeToFile("./test_binary_data.bin");
+
+    BinaryDataReader reader("./test_binary_data.bin", "SPHTST01");
+    EXPECT_EQ(reader.Time(), 1.5);
+    EXPECT_EQ(reader.SourceChecksum(), 12345u);
+    ASSERT_EQ(reader.Blocks().size(), 1u);
+    const BinaryBlockRecord &block = reader.Blocks()[0];
+    EXPECT_EQ(block.name_, "TestBlock");
+    EXPECT_EQ(block.number_of_elements_, 3u);
+    ASSERT_EQ(block.arrays_.size(), 2u);
+    EXPECT_EQ(block.arrays_[0].name_, "Scalars");
+    EXPECT_EQ(block.arrays_[1].name_, "Indices");
+    const double *read_scalars = reinterpret_cast<const double *>(reader.ArrayData(block.arrays_[0]));
+    const int *read_indices = reinterpret_cast<const int *>(reader.ArrayData(block.arrays_[1]));
+    for (size_t i = 0; i != 3; ++i)
+    {
+        EXPECT_EQ(read_scalars[i], scalars[i]);
+        EXPECT_EQ(read_indices[i], indices[i]);
+    }
+}
+
+TEST(test_BinaryDataFile, test_isUpToDateWith)
+{
+    std::string source_file = "./test_source.xml";
+    std::ofstream(source_file) << "<particles/>";
+    uint64_t source_checksum = fileChecksum(source_file);
+
+    int data = 1;
+    BinaryDataWriter converted_writer("SPHTST01", 0.0, source_checksum);
+    converted_writer.addBlock("TestBlock", 1);
+    converted_writer.addArray("Data", 5, sizeof(int), reinterpret_cast<const char *>(&data));
+    converted_writer.writeToFile("./test_converted.bin");
+    BinaryDataWriter direct_writer("SPHTST01", 0.0);
+    direct_writer.addBlock("TestBlock", 1);
+    direct_writer.addArray("Data", 5, sizeof(int), reinterpret_cast<const char *>(&data));
+    direct_writer.writeToFile("./test_direct.bin");
+
+    EXPECT_TRUE(BinaryDataReader("./test_converted.bin", "SPHTST01").isUpToDateWith(source_file));
+    EXPECT_TRUE(BinaryDataReader("./test_direct.bin", "SPHTST01").isUpToDateWith(source_file));
+    EXPECT_TRUE(BinaryDataReader("./test_converted.bin", "SPHTST01").isUpToDateWith("./no_source.xml"));
+
+    // the source is regenerated after the binary files
+    std::ofstream(source_file) << "<particles><particle/></particles>";
+    fs::last_write_time(source_file, fs::last_write_time("./test_direct.bin") + std::chrono::seconds(1));
+    EXPECT_FALSE(BinaryDataReader("./test_converted.bin", "SPHTST01").isUpToDateWith(source_file));
+    EXPECT_FALSE(BinaryDataReader("./test_direct.bin", "SPHTST01").isUpToDateWith(source_file));
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,97 @@
+#include "large_data_containers.h"
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <thread>
+
+using namespace SPH;
+
+template <typename T>
+using ArenaVec = std::vector<T, ParticleDataAllocator<T>>;
+
+TEST(test_ParticleDataArena, test_pageSize)
+{
+    size_t page_size = ParticleDataArena::pageSize();
+    EXPECT_GT(page_size, 0u);
+    EXPECT_EQ(ParticleDataArena::huge_page_size_ % page_size, 0u);
+}
+
+TEST(test_ParticleDataArena, test_largeBlock)
+{
+    size_t number_of_particles = 3 * ParticleDataArena::huge_page_size_ / sizeof(double) + 1;
+    ArenaVec<double> data(number_of_particles, 1.0);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(data.data()) % ParticleDataArena::huge_page_size_, 0u);
+    for (size_t i = 0; i != number_of_particles; ++i)
+    {
+        data[i] += Real(i);
+    }
+    for (size_t i = 0; i != number_of_particles; ++i)
+    {
+        EXPECT_EQ(data[i], 1.0 + Real(i));
+    }
+
+    ArenaVec<int> small_data(10, 2);
+    EXPECT_EQ(small_data[9], 2);
+}
+
+TEST(test_ParticleDataArena, test_firstTouchScope)
+{
+    EXPECT_EQ(ParticleDataArena::FirstTouchSize(), 0u);
+    size_t number_of_particles = 3 * ParticleDataArena::huge_page_size_ / sizeof(double);
+    {
+        ParticleDataArena::FirstTouchScope first_touch_scope(number_of_particles / 3);
+        EXPECT_EQ(ParticleDataArena::FirstTouchSize(), number_of_particles / 3);
+        {
+            /** a scope larger than the block touches the whole block with the local partitioner */
+            ParticleDataArena::FirstTouchScope inner_scope(2 * number_of_particles);
+            ArenaVec<double> data(number_of_particles, 1.0);
+            EXPECT_EQ(data.back(), 1.0);
+        }
+        EXPECT_EQ(ParticleDataArena::FirstTouchSize(), number_of_particles / 3);
+
+        /** the real particles are touched as particle_for loops them, the rest separately */
+        ArenaVec<double> data(number_of_particles, 2.0);
+        for (size_t i = 0; i != number_of_particles; ++i)
+        {
+            EXPECT_EQ(data[i], 2.0);
+        }
+    }
+    EXPECT_EQ(ParticleDataArena::FirstTouchSize(), 0u);
+}
+
+TEST(test_ParticleDataArena, test_concurrentAllocation)
+{
+    size_t number_of_particles = 2 * ParticleDataArena::huge_page_size_ / sizeof(int);
+    size_t number_of_threads = 4;
+    StdVec<size_t> number_of_errors(number_of_threads, 0);
+    StdVec<std::thread> threads;
+    for (size_t k = 0; k != number_of_threads; ++k)
+    {
+        threads.emplace_back(
+            [&, k]()
+            {
+                for (size_t repeat = 0; repeat != 8; ++repeat)
+                {
+                    ArenaVec<int> data(number_of_particles, int(k));
+                    for (size_t i = 0; i != number_of_particles; ++i)
+                    {
+                        number_of_errors[k] += data[i] != int(k);
+                    }
+                }
+            });
+    }
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+    for (size_t k = 0; k != number_of_threads; ++k)
+    {
+        EXPECT_EQ(number_of_errors[k], 0u);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -11,6 +11,64 @@ TEST(sph_data_containers, getIntersectionOfBoundingBoxes)
     EXPECT_EQ(bb_ref, getIntersectionOfBoundingBoxes(bb_1, bb_2));
 }
 
+TEST(sph_data_containers, StorageLargeVec)
+{
+    StorageLargeVec<Real> scalars;
+    StorageLargeVec<Vec3d> vectors;
+    scalars.push_back(1.0 / 3.0);
+    vectors.push_back(Vec3d(1.0 / 3.0, 2.0, -0.5));
+    scalars.setValue(0, 0.25);
+    EXPECT_EQ(1u, vectors.size());
+    EXPECT_EQ(0.25, scalars[0]);
+    EXPECT_NEAR(1.0 / 3.0, vectors[0][0], 1.0e-6);
+    EXPECT_EQ(Vec3d(1.0 / 3.0, 2.0, -0.5).cast<StorageReal>().cast<Real>(), vectors[0]);
+}
+
+TEST(sph_data_containers, SoALargeVec)
+{
+    SoALargeVec<Mat2d> matrices;
+    matrices.resize(2, Mat2d::Identity());
+    Mat2d matrix_ref{{1.0, 2.0}, {3.0, 4.0}};
+    matrices[1] = matrix_ref;
+    matrices[0] += matrices[1];
+    EXPECT_EQ(Mat2d(Mat2d::Identity() + matrix_ref), matrices[0]);
+    EXPECT_EQ(3.0, matrices.component(1)[1]);
+
+    matrices.resize(3);
+    EXPECT_EQ(matrix_ref, matrices[1]);
+    EXPECT_EQ(Mat2d(Mat2d::Zero()), matrices[2]);
+
+    matrices.swapValues(1, 2);
+    matrices.copyValue(0, 2);
+    EXPECT_EQ(matrix_ref, matrices[0]);
+    EXPECT_EQ(Mat2d(Mat2d::Zero()), matrices[1]);
+
+    SoALargeVec<Real> scalars;
+    scalars.resize(1, 0.5);
+    scalars[0] *= 2.0;
+    EXPECT_EQ(1.0, scalars[0]);
+}
+
+TEST(sph_data_containers, SymmetricMatrix)
+{
+    Mat3d matrix{{1.0, 2.0, 3.0}, {2.0, 4.0, 5.0}, {3.0, 5.0, 6.0}};
+    SymMat3d sym_matrix(matrix);
+    Vec3d vector(1.0, -1.0, 2.0);
+    Mat3d rotation = Rotation3d(0.3, Vec3d(1.0, 1.0, 0.0).normalized()).toRotationMatrix();
+    EXPECT_EQ(matrix, sym_matrix.toMatrix());
+    EXPECT_EQ(matrix.trace(), sym_matrix.trace());
+    EXPECT_EQ(Vec3d(matrix * vector), sym_matrix * vector);
+    EXPECT_NEAR(matrix.cwiseProduct(matrix).sum(), sym_matrix.squaredNorm(), 1.0e-12);
+    EXPECT_NEAR(getVonMisesStressFromMatrix(matrix), getVonMisesStressFromMatrix(sym_matrix), 1.0e-12);
+    EXPECT_TRUE((rotation * matrix * rotation.transpose()).isApprox(sym_matrix.congruence(rotation).toMatrix()));
+
+    SoALargeVec<SymMat2d> sym_matrices;
+    sym_matrices.resize(2, SymMat2d::Identity());
+    sym_matrices[1] = 2.0 * sym_matrices[0];
+    EXPECT_EQ(2.0, sym_matrices.component(1)[1]);
+    EXPECT_EQ(0.0, sym_matrices.component(2)[1]);
+}
+
 //=================================================================================================//
 //=================================================================================================//
 int main(int argc, char *argv[])
@@ -0,0 +1,118 @@
+#include "vtk_appended_data.h"
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <sstream>
+
+using namespace SPH;
+
+/** Decode a base64 string which may be padded only at its end. */
+std::vector<char> decodeBase64(const std::string &encoded)
+{
+    static const std::string alphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    std::vector<char> decoded;
+    uint32_t buffer = 0;
+    int bits = 0;
+    for (char c : encoded)
+    {
+        if (c == '=')
+            break;
+        size_t value = alphabet.find(c);
+        EXPECT_NE(value, std::string::npos);
+        buffer = (buffer << 6) | uint32_t(value);
+        bits += 6;
+        if (bits >= 8)
+        {
+            bits -= 8;
+            decoded.push_back(char((buffer >> bits) & 0xFF));
+        }
+    }
+    return decoded;
+}
+
+/** Read the offsets of the data arrays and the appended data section of a written file. */
+std::string parseAppendedData(const std::string &file_content, std::vector<size_t> &offsets)
+{
+    size_t position = 0;
+    while ((position = file_content.find("offset=\"", position)) != std::string::npos)
+    {
+        position += 8;
+        offsets.push_back(std::stoul(file_content.substr(position)));
+    }
+    size_t begin = file_content.find('_', file_content.find("<AppendedData")) + 1;
+    size_t end = file_content.rfind("\n </AppendedData>");
+    return file_content.substr(begin, end - begin);
+}
+
+void writeTestFile(VtkAppendedData &appended_data, std::ostream &output_stream)
+{
+    double *scalars = appended_data.addDataArray<double>("Scalars", 3);
+    scalars[0] = 1.0 / 3.0;
+    scalars[1] = -2.5;
+    scalars[2] = 1.0e10;
+    int *indices = appended_data.addDataArray<int>("Indices", 2);
+    indices[0] = 7;
+    indices[1] = -1;
+    appended_data.encodeDataArrays();
+    for (size_t k = 0; k != appended_data.size(); ++k)
+        appended_data.writeDataArray(output_stream, k);
+    appended_data.writeAppendedData(output_stream);
+}
+
+void checkDecodedArrays(const std::vector<std::vector<char>> &arrays)
+{
+    ASSERT_EQ(arrays.size(), 2u);
+    const double scalars[3] = {1.0 / 3.0, -2.5, 1.0e10};
+    const int indices[2] = {7, -1};
+    VtkAppendedData::HeaderType header;
+    ASSERT_EQ(arrays[0].size(), sizeof(header) + sizeof(scalars));
+    std::memcpy(&header, arrays[0].data(), sizeof(header));
+    EXPECT_EQ(header, sizeof(scalars));
+    EXPECT_EQ(std::memcmp(arrays[0].data() + sizeof(header), scalars, sizeof(scalars)), 0);
+    ASSERT_EQ(arrays[1].size(), sizeof(header) + sizeof(indices));
+    std::memcpy(&header, arrays[1].data(), sizeof(header));
+    EXPECT_EQ(header, sizeof(indices));
+    EXPECT_EQ(std::memcmp(arrays[1].data() + sizeof(header), indices, sizeof(indices)), 0);
+}
+
+TEST(test_VtkAppendedData, test_base64)
+{
+    VtkAppendedData appended_data(VtkAppendedData::Encoding::Base64);
+    std::stringstream output_stream;
+    writeTestFile(appended_data, output_stream);
+
+    std::vector<size_t> offsets;
+    std::string encoded = parseAppendedData(output_stream.str(), offsets);
+    offsets.push_back(encoded.size());
+    std::vector<std::vector<char>> arrays;
+    for (size_t k = 0; k + 1 != offsets.size(); ++k)
+    {
+        std::string encoded_array = encoded.substr(offsets[k], offsets[k + 1] - offsets[k]);
+        // padding is only allowed at the end of the encoded array
+        size_t padding = encoded_array.find('=');
+        EXPECT_TRUE(padding == std::string::npos || encoded_array.find_first_not_of('=', padding) == std::string::npos);
+        arrays.push_back(decodeBase64(encoded_array));
+    }
+    checkDecodedArrays(arrays);
+}
+
+TEST(test_VtkAppendedData, test_raw)
+{
+    VtkAppendedData appended_data(VtkAppendedData::Encoding::Raw);
+    std::stringstream output_stream;
+    writeTestFile(appended_data, output_stream);
+
+    std::vector<size_t> offsets;
+    std::string raw = parseAppendedData(output_stream.str(), offsets);
+    offsets.push_back(raw.size());
+    std::vector<std::vector<char>> arrays;
+    for (size_t k = 0; k + 1 != offsets.size(); ++k)
+        arrays.emplace_back(raw.begin() + offsets[k], raw.begin() + offsets[k + 1]);
+    checkDecodedArrays(arrays);
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
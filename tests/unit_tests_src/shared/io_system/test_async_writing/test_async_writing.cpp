@@ -0,0 +1,79 @@
+/**
+ * @file 	test_async_writing.cpp
+ * @brief 	test that asynchronous writing gives the same files as direct writing
+ *          and that it is rejected by the recordings without staging.
+ */
+#include "sphinxsys.h"
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <iterator>
+
+using namespace SPH;
+
+std::string readFile(const std::string &file_path)
+{
+    std::ifstream in_file(file_path.c_str(), std::ios::binary);
+    return std::string((std::istreambuf_iterator<char>(in_file)), std::istreambuf_iterator<char>());
+}
+
+TEST(test_BodyStatesRecording, test_asyncWriting)
+{
+    SPHSystem sph_system(BoundingBox(-Vecd::Ones(), Vecd::Ones()), 0.1);
+    sph_system.setIOEnvironment();
+    SolidBody ball(sph_system, makeShared<GeometricShapeBall>(Vecd::Zero(), 0.5, "Ball"));
+    ball.defineParticlesAndMaterial<ElasticSolidParticles, LinearElasticSolid>(1.0, 1.0, 0.3);
+    ball.generateParticles<Lattice>();
+    StdLargeVec<Vecd> &pos = ball.getBaseParticles().pos_;
+    size_t total_real_particles = ball.getBaseParticles().total_real_particles_;
+
+    BodyStatesRecordingToVtpBinary recording(ball);
+    BodyStatesRecordingToVtpBinary async_recording(ball);
+    async_recording.setAsyncWriting();
+    std::string output_folder = sph_system.getIOEnvironment().output_folder_;
+    StdVec<std::string> file_paths, expected_files;
+    for (size_t step = 1; step != 4; ++step)
+    {
+        for (size_t i = 0; i != total_real_particles; ++i)
+            pos[i] += 0.01 * Vecd::Ones();
+        ball.setNewlyUpdated();
+        recording.writeToFile(step);
+        std::string sequence = std::to_string(step);
+        file_paths.push_back(output_folder + "/Ball_" + sequence.insert(0, 10 - sequence.size(), '0') + ".vtp");
+        expected_files.push_back(readFile(file_paths.back()));
+        ASSERT_FALSE(expected_files.back().empty());
+
+        /** the states are changed while the staged states are written in the background */
+        async_recording.writeToFile(step);
+        for (size_t i = 0; i != total_real_particles; ++i)
+            pos[i] += Vecd::Ones();
+    }
+    async_recording.flushAsyncWriting();
+
+    for (size_t k = 0; k != file_paths.size(); ++k)
+    {
+        EXPECT_TRUE(readFile(file_paths[k]) == expected_files[k]);
+    }
+}
+
+TEST(test_BodyStatesRecording, test_asyncWritingRejected)
+{
+    SPHSystem sph_system(BoundingBox(-Vecd::Ones(), Vecd::Ones()), 0.1);
+    sph_system.setIOEnvironment(false);
+    SolidBody ball(sph_system, makeShared<GeometricShapeBall>(Vecd::Zero(), 0.5, "Ball"));
+    ball.defineParticlesAndMaterial<ElasticSolidParticles, LinearElasticSolid>(1.0, 1.0, 0.3);
+    ball.generateParticles<Lattice>();
+
+    BodyStatesRecordingToVtp recording(ball);
+    BodyStatesRecordingToPlt plt_recording(ball);
+    EXPECT_FALSE(recording.isAsyncWritingSupported());
+    EXPECT_FALSE(plt_recording.isAsyncWritingSupported());
+    EXPECT_EXIT(recording.setAsyncWriting(), testing::ExitedWithCode(1), "");
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    testing::FLAGS_gtest_death_test_style = "threadsafe";
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,71 @@
+/**
+ * @file 	test_body_part_recording.cpp
+ * @brief 	test that the body part recording selects the same particles
+ *          after the particles are sorted.
+ */
+#include "sphinxsys.h"
+#include <gtest/gtest.h>
+
+using namespace SPH;
+
+/** Gives the original ids of the particles selected for writing. */
+class TestBodyPartRecording : public BodyPartStatesRecordingToVtp
+{
+  public:
+    using BodyPartStatesRecordingToVtp::BodyPartStatesRecordingToVtp;
+    StdVec<size_t> selectedOriginalIds()
+    {
+        size_t number_of_selected = selectParticles(0);
+        StdVec<size_t> original_ids;
+        for (size_t n = 0; n != number_of_selected; ++n)
+        {
+            EXPECT_LT(selected_particles_[n], base_particles_.total_real_particles_);
+            original_ids.push_back(base_particles_.unsorted_id_[selected_particles_[n]]);
+        }
+        std::sort(original_ids.begin(), original_ids.end());
+        return original_ids;
+    };
+};
+
+TEST(test_BodyPartStatesRecordingToVtp, test_sortedBody)
+{
+    SPHSystem sph_system(BoundingBox(-Vecd::Ones(), Vecd::Ones()), 0.05);
+    sph_system.setIOEnvironment();
+    FluidBody water_block(sph_system, makeShared<GeometricShapeBox>(0.5 * Vecd::Ones(), "WaterBody"));
+    water_block.defineParticlesAndMaterial<BaseParticles, WeaklyCompressibleFluid>(1.0, 10.0);
+    water_block.generateParticles<Lattice>();
+    BaseParticles &base_particles = water_block.getBaseParticles();
+    BodyRegionByParticle region(water_block, makeShared<GeometricShapeBall>(0.2 * Vecd::Ones(), 0.2, "Region"));
+
+    TestBodyPartRecording particle_part_recording(region);
+    TestBodyPartRecording shape_recording(water_block, region.getBodyPartShape());
+    StdVec<size_t> selected_ids = particle_part_recording.selectedOriginalIds();
+    ASSERT_FALSE(selected_ids.empty());
+    EXPECT_EQ(selected_ids, shape_recording.selectedOriginalIds());
+
+    /** the same particles are selected after sorting */
+    water_block.updateCellLinkedList();
+    base_particles.sortParticles(water_block.getCellLinkedList());
+    size_t number_of_moved = 0;
+    for (size_t i = 0; i != base_particles.total_real_particles_; ++i)
+    {
+        if (base_particles.unsorted_id_[i] != i)
+            number_of_moved++;
+    }
+    EXPECT_GT(number_of_moved, 0u);
+    EXPECT_EQ(particle_part_recording.selectedOriginalIds(), selected_ids);
+    EXPECT_EQ(shape_recording.selectedOriginalIds(), selected_ids);
+
+    /** the listed particles which are no longer real are not selected */
+    base_particles.total_real_particles_ /= 2;
+    for (size_t original_id : particle_part_recording.selectedOriginalIds())
+    {
+        EXPECT_TRUE(std::binary_search(selected_ids.begin(), selected_ids.end(), original_id));
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
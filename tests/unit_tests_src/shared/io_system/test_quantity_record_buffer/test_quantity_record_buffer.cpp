@@ -0,0 +1,67 @@
+#include "io_observation.h"
+#include <gtest/gtest.h>
+
+#include <fstream>
+
+using namespace SPH;
+
+StdVec<std::string> readLines(const std::string &file_name)
+{
+    StdVec<std::string> lines;
+    std::ifstream in_file(file_name);
+    std::string line;
+    while (std::getline(in_file, line))
+        lines.push_back(line);
+    return lines;
+}
+
+void writeRecord(const std::string &file_path, bool is_restarting, Real start_time, size_t number_of_rows)
+{
+    Real quantity = 0.0;
+    QuantityRecordBuffer record_buffer(file_path, is_restarting, QuantityRecordBuffer::Format::Csv);
+    record_buffer.addColumn("Quantity", quantity);
+    for (size_t i = 0; i != number_of_rows; ++i)
+    {
+        record_buffer.beginRow(start_time + Real(i));
+        record_buffer.addValue(Real(i));
+    }
+}
+
+TEST(test_QuantityRecordBuffer, test_restartAppending)
+{
+    std::string file_path = "./test_quantity_record";
+    std::string file_name = file_path + ".csv";
+    fs::remove(file_name);
+
+    writeRecord(file_path, false, 0.0, 3);
+    StdVec<std::string> lines = readLines(file_name);
+    ASSERT_EQ(lines.size(), 4u);
+    EXPECT_EQ(lines[0], "run_time,Quantity");
+
+    /** a restarted run keeps the history and does not repeat the header */
+    writeRecord(file_path, true, 3.0, 2);
+    lines = readLines(file_name);
+    ASSERT_EQ(lines.size(), 6u);
+    EXPECT_EQ(lines[0], "run_time,Quantity");
+    EXPECT_EQ(lines[3].substr(0, 2), "2,");
+    EXPECT_EQ(lines[4].substr(0, 2), "3,");
+
+    /** a new run starts a new history */
+    writeRecord(file_path, false, 0.0, 1);
+    lines = readLines(file_name);
+    ASSERT_EQ(lines.size(), 2u);
+    EXPECT_EQ(lines[1].substr(0, 2), "0,");
+
+    /** a restarted run without previous history writes the header */
+    fs::remove(file_name);
+    writeRecord(file_path, true, 3.0, 1);
+    lines = readLines(file_name);
+    ASSERT_EQ(lines.size(), 2u);
+    EXPECT_EQ(lines[0], "run_time,Quantity");
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,95 @@
+#include "io_streaming.h"
+#include <gtest/gtest.h>
+
+#include <csignal>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+using namespace SPH;
+
+/** read a quantity frame and check its header and payload */
+void checkQuantityFrame(int fd, const std::string &quantity_name, Real quantity)
+{
+    std::string frame;
+    char buffer[256];
+    size_t expected_size = 24 + 4 + quantity_name.size() + 4 + 8;
+    while (frame.size() < expected_size)
+    {
+        ssize_t bytes = ::read(fd, buffer, sizeof(buffer));
+        ASSERT_GT(bytes, 0);
+        frame.append(buffer, bytes);
+    }
+    ASSERT_EQ(frame.size(), expected_size);
+
+    uint32_t magic, frame_type, name_length;
+    uint64_t payload_size;
+    double time, value;
+    std::memcpy(&magic, frame.data(), 4);
+    std::memcpy(&frame_type, frame.data() + 4, 4);
+    std::memcpy(&payload_size, frame.data() + 8, 8);
+    std::memcpy(&time, frame.data() + 16, 8);
+    std::memcpy(&name_length, frame.data() + 24, 4);
+    EXPECT_EQ(magic, 0x53485053u);
+    EXPECT_EQ(frame_type, uint32_t(StreamingSink::FrameType::Quantity));
+    EXPECT_EQ(payload_size, expected_size - 24);
+    EXPECT_EQ(time, GlobalStaticVariables::physical_time_);
+    EXPECT_EQ(frame.substr(28, name_length), quantity_name);
+    uint32_t number_of_values;
+    std::memcpy(&number_of_values, frame.data() + 28 + name_length, 4);
+    std::memcpy(&value, frame.data() + 32 + name_length, 8);
+    EXPECT_EQ(number_of_values, 1u);
+    EXPECT_EQ(value, quantity);
+}
+
+TEST(test_StreamingSink, test_unixSocket)
+{
+    GlobalStaticVariables::physical_time_ = 2.5;
+    std::string path = "./test_streaming.sock";
+    StreamingSink streaming_sink(path, StreamingSink::Transport::UnixSocket);
+    EXPECT_FALSE(streaming_sink.publishFrame(StreamingSink::FrameType::Quantity, ""));
+    EXPECT_EQ(streaming_sink.NumberOfDroppedFrames(), 1u);
+
+    int reader = socket(AF_UNIX, SOCK_STREAM, 0);
+    sockaddr_un address;
+    std::memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    std::strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+    ASSERT_EQ(connect(reader, reinterpret_cast<sockaddr *>(&address), sizeof(address)), 0);
+
+    streaming_sink.publishQuantity("KineticEnergy", Real(0.125));
+    checkQuantityFrame(reader, "KineticEnergy", 0.125);
+    ::close(reader);
+}
+
+TEST(test_StreamingSink, test_namedPipe)
+{
+    GlobalStaticVariables::physical_time_ = 3.5;
+    std::string path = "./test_streaming.fifo";
+    StreamingSink streaming_sink(path, StreamingSink::Transport::NamedPipe);
+    int reader = ::open(path.c_str(), O_RDONLY | O_NONBLOCK);
+    ASSERT_NE(reader, -1);
+
+    streaming_sink.publishQuantity("TotalMass", Real(4.0));
+    checkQuantityFrame(reader, "TotalMass", 4.0);
+
+    /** a closed reader neither terminates the run nor changes the signal handling of the process */
+    ::close(reader);
+    streaming_sink.publishQuantity("TotalMass", Real(4.0));
+    streaming_sink.publishQuantity("TotalMass", Real(4.0));
+    struct sigaction sigpipe_action;
+    sigaction(SIGPIPE, nullptr, &sigpipe_action);
+    EXPECT_EQ(sigpipe_action.sa_handler, SIG_DFL);
+    sigset_t pending_set;
+    sigpending(&pending_set);
+    EXPECT_FALSE(sigismember(&pending_set, SIGPIPE));
+    unlink(path.c_str());
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
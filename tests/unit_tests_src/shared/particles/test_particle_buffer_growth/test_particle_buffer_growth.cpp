@@ -0,0 +1,112 @@
+/**
+ * @file 	test_particle_buffer_growth.cpp
+ * @brief 	test that an elastic particle buffer grows on demand,
+ *          keeps the particle data and resizes the body relations.
+ *          The variables in storage precision are resized, copied and sorted as the others.
+ */
+#include "sphinxsys.h"
+#include <gtest/gtest.h>
+
+using namespace SPH;
+
+TEST(test_ParticleBuffer, test_elasticGrowth)
+{
+    SPHSystem sph_system(BoundingBox(-Vecd::Ones(), Vecd::Ones()), 0.1);
+    sph_system.setIOEnvironment();
+    FluidBody water_block(sph_system, makeShared<GeometricShapeBox>(0.5 * Vecd::Ones(), "WaterBody"));
+    water_block.defineParticlesAndMaterial<BaseParticles, WeaklyCompressibleFluid>(1.0, 10.0);
+    ParticleBuffer<ReserveSizeFactor> particle_buffer(0.1);
+    particle_buffer.setElasticGrowth(0.5);
+    water_block.generateParticlesWithReserve<Lattice>(particle_buffer);
+    InnerRelation water_block_inner(water_block);
+
+    BaseParticles &base_particles = water_block.getBaseParticles();
+    size_t total_real_particles = base_particles.total_real_particles_;
+    size_t initial_bound = base_particles.real_particles_bound_;
+    size_t available_size = initial_bound - total_real_particles;
+    StdLargeVec<Vecd> initial_pos(base_particles.pos_.begin(), base_particles.pos_.begin() + total_real_particles);
+
+    /** no growth as long as the buffer is enough */
+    particle_buffer.prepareBufferParticles(base_particles, available_size);
+    EXPECT_EQ(base_particles.real_particles_bound_, initial_bound);
+
+    /** growth by the growth factor when it is more than the shortage */
+    particle_buffer.prepareBufferParticles(base_particles, available_size + 1);
+    size_t grown_bound = base_particles.real_particles_bound_;
+    EXPECT_EQ(grown_bound, initial_bound + size_t(std::ceil(Real(initial_bound) * 0.5)));
+
+    /** growth by the shortage when it is more than the growth factor */
+    size_t expected_size = 3 * grown_bound;
+    particle_buffer.prepareBufferParticles(base_particles, expected_size);
+    size_t new_bound = base_particles.real_particles_bound_;
+    EXPECT_EQ(new_bound, total_real_particles + expected_size);
+
+    EXPECT_EQ(base_particles.total_real_particles_, total_real_particles);
+    EXPECT_EQ(base_particles.particles_bound_, new_bound);
+    EXPECT_EQ(base_particles.pos_.size(), new_bound);
+    EXPECT_EQ(base_particles.Vol_.size(), new_bound);
+    EXPECT_EQ(base_particles.unsorted_id_.size(), new_bound);
+    EXPECT_EQ(base_particles.sorted_id_.size(), new_bound);
+    EXPECT_EQ(base_particles.sequence_.size(), new_bound);
+    EXPECT_EQ(water_block_inner.inner_configuration_.size(), new_bound);
+    for (size_t i = 0; i != total_real_particles; ++i)
+    {
+        EXPECT_EQ(base_particles.pos_[i], initial_pos[i]);
+    }
+
+    /** the grown buffer particles can be switched to real particles */
+    for (size_t i = 0; i != expected_size; ++i)
+    {
+        base_particles.copyFromAnotherParticle(base_particles.total_real_particles_, i % total_real_particles);
+        base_particles.total_real_particles_ += 1;
+    }
+    EXPECT_EQ(base_particles.total_real_particles_, new_bound);
+    water_block.updateCellLinkedList();
+    water_block_inner.updateConfiguration();
+    EXPECT_EQ(water_block_inner.inner_configuration_[new_bound - 1].current_size_,
+              water_block_inner.inner_configuration_[(expected_size - 1) % total_real_particles].current_size_);
+}
+
+TEST(test_ParticleBuffer, test_storagePrecisionVariables)
+{
+    SPHSystem sph_system(BoundingBox(-Vecd::Ones(), Vecd::Ones()), 0.1);
+    sph_system.setIOEnvironment();
+    FluidBody water_block(sph_system, makeShared<GeometricShapeBox>(0.5 * Vecd::Ones(), "WaterBody"));
+    water_block.defineParticlesAndMaterial<BaseParticles, WeaklyCompressibleFluid>(1.0, 10.0);
+    ParticleBuffer<ReserveSizeFactor> particle_buffer(0.1);
+    particle_buffer.setElasticGrowth(0.5);
+    water_block.generateParticlesWithReserve<Lattice>(particle_buffer);
+
+    BaseParticles &base_particles = water_block.getBaseParticles();
+    StdLargeVec<StorageReal> *pressure = base_particles.getVariableByName<StorageReal>("Pressure");
+    ASSERT_NE(pressure, nullptr);
+    EXPECT_EQ(base_particles.getVariableByName<StorageReal>("VolumetricMeasure"), &base_particles.Vol_);
+    size_t total_real_particles = base_particles.total_real_particles_;
+    for (size_t i = 0; i != total_real_particles; ++i)
+    {
+        (*pressure)[i] = StorageReal(i);
+        base_particles.Vol_[i] = StorageReal(i + 1);
+    }
+
+    particle_buffer.prepareBufferParticles(base_particles, 2 * base_particles.real_particles_bound_);
+    EXPECT_EQ(pressure->size(), base_particles.particles_bound_);
+    base_particles.copyFromAnotherParticle(total_real_particles, 1);
+    EXPECT_EQ((*pressure)[total_real_particles], StorageReal(1));
+    EXPECT_EQ(base_particles.Vol_[total_real_particles], StorageReal(2));
+
+    base_particles.registerSortableVariable<StorageReal>("Pressure");
+    base_particles.registerSortableVariable<StorageReal>("VolumetricMeasure");
+    water_block.updateCellLinkedList();
+    base_particles.sortParticles(water_block.getCellLinkedList());
+    for (size_t i = 0; i != total_real_particles; ++i)
+    {
+        EXPECT_EQ((*pressure)[i], StorageReal(base_particles.unsorted_id_[i]));
+        EXPECT_EQ(base_particles.Vol_[i], StorageReal(base_particles.unsorted_id_[i] + 1));
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
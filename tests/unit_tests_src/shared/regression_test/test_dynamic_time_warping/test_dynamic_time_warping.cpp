@@ -0,0 +1,75 @@
+#include "dynamic_time_warping_method.hpp"
+#include <gtest/gtest.h>
+
+using namespace SPH;
+
+/** the full cost matrix without band if the window size is not given. */
+template <typename VariableType>
+Real fullDTWDistance(const StdVec<VariableType> &series_a, const StdVec<VariableType> &series_b,
+                     int window_size = std::numeric_limits<int>::max())
+{
+    int a_length = series_a.size();
+    int b_length = series_b.size();
+    BiVector<Real> cost(a_length, StdVec<Real>(b_length, MaxReal));
+    for (int i = 0; i != a_length; ++i)
+        for (int j = 0; j != b_length; ++j)
+        {
+            if (ABS(i - j) > window_size)
+                continue;
+            Real accumulated = 0.0;
+            if (i > 0 || j > 0)
+            {
+                Real upper = i > 0 ? cost[i - 1][j] : MaxReal;
+                Real left = j > 0 ? cost[i][j - 1] : MaxReal;
+                Real diagonal = i > 0 && j > 0 ? cost[i - 1][j - 1] : MaxReal;
+                accumulated = SMIN(upper, left, diagonal);
+            }
+            cost[i][j] = accumulated + dtwPNorm(series_a[i], series_b[j]);
+        }
+    return cost[a_length - 1][b_length - 1];
+}
+
+StdVec<Real> sineSeries(int length, Real phase)
+{
+    StdVec<Real> series;
+    for (int i = 0; i != length; ++i)
+        series.push_back(std::sin(0.3 * Real(i) + phase) + 0.01 * Real(i % 7));
+    return series;
+}
+
+TEST(test_DynamicTimeWarping, test_bandedAgainstFull)
+{
+    StdVec<Real> series_a = sineSeries(40, 0.0);
+    StdVec<Real> series_b = sineSeries(42, 0.2);
+    EXPECT_DOUBLE_EQ(bandedDTWDistance(series_a, series_b), fullDTWDistance(series_a, series_b, 5));
+    EXPECT_DOUBLE_EQ(bandedDTWDistance(series_a, series_a), 0.0);
+
+    /** the band covers the whole matrix for short series. */
+    StdVec<Real> short_a = sineSeries(6, 0.0);
+    StdVec<Real> short_b = sineSeries(6, 0.5);
+    EXPECT_DOUBLE_EQ(bandedDTWDistance(short_a, short_b), fullDTWDistance(short_a, short_b));
+
+    StdVec<Vec2d> vector_a, vector_b;
+    for (int i = 0; i != 30; ++i)
+    {
+        vector_a.push_back(Vec2d(series_a[i], series_b[i]));
+        vector_b.push_back(Vec2d(series_b[i + 2], series_a[i + 1]));
+    }
+    EXPECT_DOUBLE_EQ(bandedDTWDistance(vector_a, vector_b), fullDTWDistance(vector_a, vector_b, 5));
+}
+
+TEST(test_DynamicTimeWarping, test_earlyAbandoning)
+{
+    StdVec<Real> series_a = sineSeries(40, 0.0);
+    StdVec<Real> series_b = sineSeries(40, 1.0);
+    Real distance = fullDTWDistance(series_a, series_b, 5);
+    ASSERT_GT(distance, 0.0);
+    EXPECT_DOUBLE_EQ(bandedDTWDistance(series_a, series_b, distance), distance);
+    EXPECT_GT(bandedDTWDistance(series_a, series_b, 0.5 * distance), 0.5 * distance);
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}